@@ -14,6 +14,14 @@ void eeprom_driver_erase(void) {
     wear_leveling_erase();
 }
 
+void eeprom_driver_flush(void) {
+    wear_leveling_flush();
+}
+
+void eeprom_driver_task(void) {
+    wear_leveling_task();
+}
+
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
     wear_leveling_read((uint32_t)addr, buf, len);
 }
@@ -0,0 +1,57 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/* Per-chunk dirty tracking for LED driver register buffers.
+ *
+ * The I2C LED drivers mirror their PWM registers in RAM and transmit
+ * them in fixed size chunks. Rather than a single dirty flag which
+ * forces every chunk onto the bus, each chunk gets a bit in a
+ * led_dirty_chunks_t so that only the chunks containing changed
+ * registers are written on the next flush.
+ *
+ * A single bitmap can track up to 32 chunks.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c_master.h"
+
+typedef uint32_t led_dirty_chunks_t;
+
+/**
+ * \brief Get the bit for the chunk containing a buffer offset.
+ *
+ * \param offset The offset into the register buffer.
+ * \param chunk_size The number of registers per chunk.
+ */
+static inline led_dirty_chunks_t led_dirty_chunk(uint8_t offset, uint8_t chunk_size) {
+    return (led_dirty_chunks_t)1 << (offset / chunk_size);
+}
+
+/**
+ * \brief Transmit the dirty chunks of a register buffer.
+ *
+ * \param address The 8-bit (already shifted) I2C address of the device.
+ * \param reg The register that the first byte of the buffer maps to.
+ * \param buffer The register buffer.
+ * \param count The size of the register buffer.
+ * \param chunk_size The number of registers per chunk.
+ * \param dirty The bitmap of chunks to transmit.
+ * \param timeout The I2C timeout for each chunk.
+ * \param persistence The number of attempts per chunk, or 0 for a single attempt.
+ */
+static inline void led_dirty_chunks_write(uint8_t address, uint8_t reg, const uint8_t *buffer, uint8_t count, uint8_t chunk_size, led_dirty_chunks_t dirty, uint16_t timeout, uint8_t persistence) {
+    for (uint8_t i = 0; dirty && i < count; i += chunk_size, dirty >>= 1) {
+        if (!(dirty & 1)) {
+            continue;
+        }
+
+        uint8_t length = count - i < chunk_size ? count - i : chunk_size;
+        uint8_t j      = 0;
+        do {
+            if (i2c_write_register(address, reg + i, buffer + i, length, timeout) == I2C_STATUS_SUCCESS) break;
+        } while (++j < persistence);
+    }
+}
@@ -274,15 +274,6 @@ __attribute__((weak)) void oled_driver_init(void) {
 #endif
 }
 
-// Flips the rendering bits for a character at the current cursor position
-static void InvertCharacter(uint8_t *cursor) {
-    const uint8_t *end = cursor + OLED_FONT_WIDTH;
-    while (cursor < end) {
-        *cursor = ~(*cursor);
-        cursor++;
-    }
-}
-
 bool oled_init(oled_rotation_t rotation) {
 #if defined(USE_I2C) && defined(SPLIT_KEYBOARD) && defined(OLED_TRANSPORT_I2C)
     if (!is_keyboard_master()) {
@@ -382,10 +373,10 @@ void oled_clear(void) {
     oled_dirty  = OLED_ALL_BLOCKS_MASK;
 }
 
-static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
+static void calc_bounds(uint16_t start, uint16_t length, uint8_t *cmd_array) {
     // Calculate commands to set memory addressing bounds.
-    uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
-    uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH;
+    uint8_t start_page   = start / OLED_DISPLAY_WIDTH;
+    uint8_t start_column = start % OLED_DISPLAY_WIDTH;
 #if !OLED_IC_HAS_HORIZONTAL_MODE
     // Commands for Page Addressing Mode. Sets starting page and column; has no end bound.
     // Column value must be split into high and low nybble and sent as two commands.
@@ -396,9 +387,21 @@ static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
     // Commands for use in Horizontal Addressing mode.
     cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
     cmd_array[4] = start_page;
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
+    cmd_array[2] = (length < OLED_DISPLAY_WIDTH ? length : OLED_DISPLAY_WIDTH) - 1 + cmd_array[1];
+    cmd_array[5] = (length + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
+#endif
+}
+
+// Returns how many bytes from start can be sent as a single transfer, which is the rest of the page, or as many
+// whole pages as possible when starting at the beginning of a page in horizontal addressing mode.
+static uint16_t calc_segment_length(uint16_t start, uint16_t length) {
+    uint8_t start_column = start % OLED_DISPLAY_WIDTH;
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    if (start_column == 0 && length >= OLED_DISPLAY_WIDTH) {
+        return length - length % OLED_DISPLAY_WIDTH;
+    }
 #endif
+    return (length < OLED_DISPLAY_WIDTH - start_column) ? length : OLED_DISPLAY_WIDTH - start_column;
 }
 
 static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
@@ -431,19 +434,118 @@ static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
 #endif
 }
 
-uint8_t crot(uint8_t a, int8_t n) {
-    const uint8_t mask = 0x7;
-    n &= mask;
-    return a << n | a >> (-n & mask);
+// Rotates an 8x8 block of pixels, using a bit matrix transpose (Hacker's Delight, 7-3) rather than moving bits one at
+// a time. Each destination byte is made from one bit of every source byte, with the first source byte in the top bit.
+static void rotate_90(const uint8_t *src, uint8_t *dest) {
+    uint32_t x = ((uint32_t)src[0] << 24) | ((uint32_t)src[1] << 16) | ((uint32_t)src[2] << 8) | src[3];
+    uint32_t y = ((uint32_t)src[4] << 24) | ((uint32_t)src[5] << 16) | ((uint32_t)src[6] << 8) | src[7];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    dest[7] = x >> 24;
+    dest[6] = x >> 16;
+    dest[5] = x >> 8;
+    dest[4] = x;
+    dest[3] = y >> 24;
+    dest[2] = y >> 16;
+    dest[1] = y >> 8;
+    dest[0] = y;
 }
 
-static void rotate_90(const uint8_t *src, uint8_t *dest) {
-    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
-        uint8_t selector = (1 << i);
-        for (uint8_t j = 0; j < 8; ++j) {
-            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
+// Sends a run of bytes from the buffer, splitting it into as few address windows as the controller allows
+static bool oled_render_range(uint16_t start, uint16_t length) {
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+#else
+    static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+#endif
+    while (length > 0) {
+        uint16_t segment_length = calc_segment_length(start, length);
+        calc_bounds(start, segment_length, &display_start[1]); // Offset from I2C_CMD byte at the start
+
+        // Send column & page position
+        if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+            print("oled_render offset command failed\n");
+            return false;
         }
+
+        // Send render data as is
+        if (!oled_send_data(&oled_buffer[start], segment_length)) {
+            print("oled_render data failed\n");
+            return false;
+        }
+
+        start += segment_length;
+        length -= segment_length;
     }
+    return true;
+}
+
+// Rotates and sends a single block
+static bool oled_render_block_90(uint8_t update_start) {
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+#else
+    static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+#endif
+    calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+
+    // Send column & page position
+    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+        print("oled_render offset command failed\n");
+        return false;
+    }
+
+    // Rotate the render chunks
+    const static uint8_t source_map[] = OLED_SOURCE_MAP;
+    const static uint8_t target_map[] = OLED_TARGET_MAP;
+
+    static uint8_t temp_buffer[OLED_BLOCK_SIZE];
+    memset(temp_buffer, 0, sizeof(temp_buffer));
+    for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+        rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
+    }
+
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    // Send render data chunk after rotating
+    if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
+        print("oled_render90 data failed\n");
+        return false;
+    }
+#else
+    // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
+    const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
+    const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
+    for (uint8_t i = 0; i < num_pages; ++i) {
+        // Send column & page position for all pages except the first one
+        if (i > 0) {
+            display_start[1]++;
+            if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+                print("oled_render offset command failed\n");
+                return false;
+            }
+        }
+        // Send data for the page
+        if (!oled_send_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
+            print("oled_render90 data failed\n");
+            return false;
+        }
+    }
+#endif
+    return true;
 }
 
 void oled_render_dirty(bool all) {
@@ -458,77 +560,36 @@ void oled_render_dirty(bool all) {
 
     uint8_t update_start  = 0;
     uint8_t num_processed = 0;
-    while (oled_dirty && (num_processed++ < OLED_UPDATE_PROCESS_LIMIT || all)) { // render all dirty blocks (up to the configured limit)
+    while (oled_dirty && (num_processed < OLED_UPDATE_PROCESS_LIMIT || all)) { // render all dirty blocks (up to the configured limit)
         // Find next dirty block
         while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
             ++update_start;
         }
 
-        // Set column & page position
-#if OLED_IC_HAS_HORIZONTAL_MODE
-        static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
-#else
-        static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
-#endif
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        } else {
-            calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        }
-
-        // Send column & page position
-        if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-            print("oled_render offset command failed\n");
-            return;
-        }
-
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
-                print("oled_render data failed\n");
-                return;
+            // Extend over the following dirty blocks (up to the configured limit), and send them together
+            uint8_t update_count = 1;
+            while (update_start + update_count < OLED_BLOCK_COUNT && (oled_dirty & ((OLED_BLOCK_TYPE)1 << (update_start + update_count))) && (num_processed + update_count < OLED_UPDATE_PROCESS_LIMIT || all)) {
+                ++update_count;
             }
-        } else {
-            // Rotate the render chunks
-            const static uint8_t source_map[] = OLED_SOURCE_MAP;
-            const static uint8_t target_map[] = OLED_TARGET_MAP;
-
-            static uint8_t temp_buffer[OLED_BLOCK_SIZE];
-            memset(temp_buffer, 0, sizeof(temp_buffer));
-            for (uint8_t i = 0; i < sizeof(source_map); ++i) {
-                rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
+            if (!oled_render_range(OLED_BLOCK_SIZE * update_start, OLED_BLOCK_SIZE * update_count)) {
+                return;
             }
 
-#if OLED_IC_HAS_HORIZONTAL_MODE
-            // Send render data chunk after rotating
-            if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
-                print("oled_render90 data failed\n");
-                return;
+            // Clear dirty flags of just rendered blocks
+            num_processed += update_count;
+            while (update_count--) {
+                oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start++);
             }
-#else
-            // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
-            const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
-            const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
-            for (uint8_t i = 0; i < num_pages; ++i) {
-                // Send column & page position for all pages except the first one
-                if (i > 0) {
-                    display_start[1]++;
-                    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-                        print("oled_render offset command failed\n");
-                        return;
-                    }
-                }
-                // Send data for the page
-                if (!oled_send_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
-                    print("oled_render90 data failed\n");
-                    return;
-                }
+        } else {
+            if (!oled_render_block_90(update_start)) {
+                return;
             }
-#endif
-        }
 
-        // Clear dirty flag of just rendered block
-        oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+            // Clear dirty flag of just rendered block
+            num_processed++;
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+        }
     }
 }
 
@@ -597,28 +658,26 @@ void oled_write_char(const char data, bool invert) {
         return;
     }
 
-    // copy the current render buffer to check for dirty after
-    static uint8_t oled_temp_buffer[OLED_FONT_WIDTH];
-    memcpy(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH);
-
     _Static_assert(sizeof(font) >= ((OLED_FONT_END + 1 - OLED_FONT_START) * OLED_FONT_WIDTH), "OLED_FONT_END references outside array");
 
-    // set the reder buffer data
-    uint8_t cast_data = (uint8_t)data; // font based on unsigned type for index
-    if (cast_data < OLED_FONT_START || cast_data > OLED_FONT_END) {
-        memset(oled_cursor, 0x00, OLED_FONT_WIDTH);
-    } else {
-        const uint8_t *glyph = &font[(cast_data - OLED_FONT_START) * OLED_FONT_WIDTH];
-        memcpy_P(oled_cursor, glyph, OLED_FONT_WIDTH);
+    // set the render buffer data a column at a time, checking for changes as we go
+    uint8_t        cast_data = (uint8_t)data; // font based on unsigned type for index
+    const uint8_t *glyph     = NULL;
+    if (cast_data >= OLED_FONT_START && cast_data <= OLED_FONT_END) {
+        glyph = &font[(cast_data - OLED_FONT_START) * OLED_FONT_WIDTH];
     }
-
-    // Invert if needed
-    if (invert) {
-        InvertCharacter(oled_cursor);
+    const uint8_t invert_mask = invert ? 0xFF : 0x00;
+    bool          changed     = false;
+    for (uint8_t i = 0; i < OLED_FONT_WIDTH; i++) {
+        uint8_t column = (glyph ? pgm_read_byte(&glyph[i]) : 0x00) ^ invert_mask;
+        if (oled_cursor[i] != column) {
+            oled_cursor[i] = column;
+            changed        = true;
+        }
     }
 
     // Dirty check
-    if (memcmp(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH)) {
+    if (changed) {
         uint16_t index = oled_cursor - &oled_buffer[0];
         oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
         // Edgecase check if the written data spans the 2 chunks
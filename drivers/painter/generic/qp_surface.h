@@ -21,6 +21,15 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_RECTS
+/**
+ * @def This controls the number of separate dirty rectangles tracked by RGB565 surfaces. With more than one, changes
+ *      in distant areas of the surface are transferred to the target as separate regions instead of one bounding box,
+ *      at the cost of 8 bytes of RAM per rectangle.
+ */
+#    define SURFACE_DIRTY_RECTS 1
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
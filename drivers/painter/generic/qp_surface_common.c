@@ -49,6 +49,130 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
     }
 }
 
+#if SURFACE_DIRTY_RECTS > 1
+
+// Approximate cost of streaming an extra region to the target, in pixels -- covers the viewport commands and the
+// transaction setup for each region
+#    define SURFACE_DIRTY_RECT_OVERHEAD_PIXELS 16
+
+static inline uint32_t dirty_rect_area(const surface_dirty_rect_t *rect) {
+    return (uint32_t)(rect->r - rect->l + 1) * (uint32_t)(rect->b - rect->t + 1);
+}
+
+static inline surface_dirty_rect_t dirty_rect_union(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return (surface_dirty_rect_t){
+        .l = a->l < b->l ? a->l : b->l,
+        .t = a->t < b->t ? a->t : b->t,
+        .r = a->r > b->r ? a->r : b->r,
+        .b = a->b > b->b ? a->b : b->b,
+    };
+}
+
+// Whether the pixel is inside the rect, or immediately next to it
+static inline bool dirty_rect_touches(const surface_dirty_rect_t *rect, uint16_t x, uint16_t y) {
+    return x + 1 >= rect->l && x <= rect->r + 1 && y + 1 >= rect->t && y <= rect->b + 1;
+}
+
+static inline void dirty_rect_grow(surface_dirty_rect_t *rect, uint16_t x, uint16_t y) {
+    if (rect->l > x) {
+        rect->l = x;
+    }
+    if (rect->r < x) {
+        rect->r = x;
+    }
+    if (rect->t > y) {
+        rect->t = y;
+    }
+    if (rect->b < y) {
+        rect->b = y;
+    }
+}
+
+// Extra area streamed if the two rects were sent as their bounding box, instead of separately
+static inline int32_t dirty_rect_merge_cost(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    surface_dirty_rect_t u = dirty_rect_union(a, b);
+    return (int32_t)dirty_rect_area(&u) - (int32_t)dirty_rect_area(a) - (int32_t)dirty_rect_area(b);
+}
+
+// Finds the pair of rects which are cheapest to merge
+static int32_t dirty_rects_cheapest_pair(surface_dirty_rects_t *dirty_rects, uint8_t *first, uint8_t *second) {
+    int32_t best = INT32_MAX;
+    for (uint8_t i = 0; i < dirty_rects->count; ++i) {
+        for (uint8_t j = i + 1; j < dirty_rects->count; ++j) {
+            int32_t cost = dirty_rect_merge_cost(&dirty_rects->rects[i], &dirty_rects->rects[j]);
+            if (cost < best) {
+                best    = cost;
+                *first  = i;
+                *second = j;
+            }
+        }
+    }
+    return best;
+}
+
+// Merges the second rect into the first, filling its slot with the last rect
+static void dirty_rects_merge(surface_dirty_rects_t *dirty_rects, uint8_t first, uint8_t second) {
+    dirty_rects->rects[first]  = dirty_rect_union(&dirty_rects->rects[first], &dirty_rects->rects[second]);
+    dirty_rects->rects[second] = dirty_rects->rects[--dirty_rects->count];
+    dirty_rects->last          = first;
+}
+
+void qp_surface_update_dirty_rects(surface_dirty_rects_t *dirty_rects, uint16_t x, uint16_t y) {
+    // Most pixels continue the area drawn by the previous one
+    if (dirty_rects->count > 0 && dirty_rect_touches(&dirty_rects->rects[dirty_rects->last], x, y)) {
+        dirty_rect_grow(&dirty_rects->rects[dirty_rects->last], x, y);
+        return;
+    }
+
+    for (uint8_t i = 0; i < dirty_rects->count; ++i) {
+        if (dirty_rect_touches(&dirty_rects->rects[i], x, y)) {
+            dirty_rect_grow(&dirty_rects->rects[i], x, y);
+            dirty_rects->last = i;
+            return;
+        }
+    }
+
+    // If there's no room for a new rect, either grow the rect closest to the pixel or merge the cheapest pair to make
+    // room, whichever adds the least area
+    if (dirty_rects->count == SURFACE_DIRTY_RECTS) {
+        surface_dirty_rect_t pixel      = {.l = x, .t = y, .r = x, .b = y};
+        int32_t              grow_cost  = INT32_MAX;
+        uint8_t              grow_index = 0;
+        for (uint8_t i = 0; i < dirty_rects->count; ++i) {
+            int32_t cost = dirty_rect_merge_cost(&dirty_rects->rects[i], &pixel);
+            if (cost < grow_cost) {
+                grow_cost  = cost;
+                grow_index = i;
+            }
+        }
+
+        uint8_t first = 0, second = 0;
+        if (dirty_rects_cheapest_pair(dirty_rects, &first, &second) >= grow_cost) {
+            dirty_rect_grow(&dirty_rects->rects[grow_index], x, y);
+            dirty_rects->last = grow_index;
+            return;
+        }
+        dirty_rects_merge(dirty_rects, first, second);
+    }
+
+    dirty_rects->last                        = dirty_rects->count;
+    dirty_rects->rects[dirty_rects->count++] = (surface_dirty_rect_t){.l = x, .t = y, .r = x, .b = y};
+}
+
+uint8_t qp_surface_coalesce_dirty_rects(surface_dirty_rects_t *dirty_rects) {
+    // Merge any pair which costs less to send as one region, including rects which grew into each other
+    while (dirty_rects->count > 1) {
+        uint8_t first = 0, second = 0;
+        if (dirty_rects_cheapest_pair(dirty_rects, &first, &second) > SURFACE_DIRTY_RECT_OVERHEAD_PIXELS) {
+            break;
+        }
+        dirty_rects_merge(dirty_rects, first, second);
+    }
+    return dirty_rects->count;
+}
+
+#endif // SURFACE_DIRTY_RECTS > 1
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Driver vtable
 
@@ -63,6 +187,12 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface->dirty.b        = surface->base.panel_height - 1;
     surface->dirty.is_dirty = true;
 
+#if SURFACE_DIRTY_RECTS > 1
+    surface->dirty_rects.count    = 1;
+    surface->dirty_rects.last     = 0;
+    surface->dirty_rects.rects[0] = (surface_dirty_rect_t){.l = 0, .t = 0, .r = surface->base.panel_width - 1, .b = surface->base.panel_height - 1};
+#endif // SURFACE_DIRTY_RECTS > 1
+
     return true;
 }
 
@@ -83,6 +213,9 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+#if SURFACE_DIRTY_RECTS > 1
+    surface->dirty_rects.count = 0;
+#endif // SURFACE_DIRTY_RECTS > 1
     return true;
 }
 
@@ -24,6 +24,21 @@ typedef struct surface_dirty_data_t {
     uint16_t b;
 } surface_dirty_data_t;
 
+#    if SURFACE_DIRTY_RECTS > 1
+typedef struct surface_dirty_rect_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} surface_dirty_rect_t;
+
+typedef struct surface_dirty_rects_t {
+    uint8_t              count;
+    uint8_t              last; // most recently updated rect, checked first
+    surface_dirty_rect_t rects[SURFACE_DIRTY_RECTS];
+} surface_dirty_rects_t;
+#    endif // SURFACE_DIRTY_RECTS > 1
+
 typedef struct surface_viewport_data_t {
     // Manually manage the viewport for streaming pixel data to the display
     uint16_t viewport_l;
@@ -52,6 +67,11 @@ typedef struct surface_painter_device_t {
 
     // Maintain a dirty region so we can stream only what we need
     surface_dirty_data_t dirty;
+
+#    if SURFACE_DIRTY_RECTS > 1
+    // Separate dirty rectangles within the dirty region, so distant changes are streamed individually
+    surface_dirty_rects_t dirty_rects;
+#    endif // SURFACE_DIRTY_RECTS > 1
 } surface_painter_device_t;
 
 /**
@@ -89,6 +109,10 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+#    if SURFACE_DIRTY_RECTS > 1
+void    qp_surface_update_dirty_rects(surface_dirty_rects_t *dirty_rects, uint16_t x, uint16_t y);
+uint8_t qp_surface_coalesce_dirty_rects(surface_dirty_rects_t *dirty_rects);
+#    endif // SURFACE_DIRTY_RECTS > 1
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
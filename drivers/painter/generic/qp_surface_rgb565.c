@@ -24,6 +24,9 @@ static inline void setpixel_rgb565(surface_painter_device_t *surface, uint16_t x
     if (surface->u16buffer[y * w + x] != rgb565) {
         // Update the dirty region
         qp_surface_update_dirty(&surface->dirty, x, y);
+#    if SURFACE_DIRTY_RECTS > 1
+        qp_surface_update_dirty_rects(&surface->dirty_rects, x, y);
+#    endif // SURFACE_DIRTY_RECTS > 1
 
         // Update the pixel data in the buffer
         surface->u16buffer[y * w + x] = rgb565;
@@ -68,14 +71,9 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool rgb565_target_pixdata_transfer_region(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
-
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
     if (!ok) {
@@ -119,6 +117,28 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     return true;
 }
 
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    if (entire_surface) {
+        return rgb565_target_pixdata_transfer_region(surface_driver, target_driver, x, y, 0, 0, surface_handle->base.panel_width - 1, surface_handle->base.panel_height - 1);
+    }
+
+#    if SURFACE_DIRTY_RECTS > 1
+    // Send each dirty rect as its own region
+    uint8_t count = qp_surface_coalesce_dirty_rects(&surface_handle->dirty_rects);
+    for (uint8_t i = 0; i < count; ++i) {
+        surface_dirty_rect_t *rect = &surface_handle->dirty_rects.rects[i];
+        if (!rgb565_target_pixdata_transfer_region(surface_driver, target_driver, x, y, rect->l, rect->t, rect->r, rect->b)) {
+            return false;
+        }
+    }
+    return true;
+#    else
+    return rgb565_target_pixdata_transfer_region(surface_driver, target_driver, x, y, surface_handle->dirty.l, surface_handle->dirty.t, surface_handle->dirty.r, surface_handle->dirty.b);
+#    endif // SURFACE_DIRTY_RECTS > 1
+}
+
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
     target_buffer[pixdata_offset] = pixdata_byte;
     return true;
@@ -10,6 +10,31 @@
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
 
+/**
+ * @brief Send a transaction buffer. Framed transactions only send the used
+ * part of their buffer, whose length is stored in the first byte.
+ */
+static inline bool send_transaction_buffer(uint8_t transaction_id, const uint8_t* buffer, uint8_t size) {
+    if (split_trans_is_framed(transaction_id)) {
+        size = buffer[0];
+    }
+    return serial_transport_send(buffer, size);
+}
+
+/**
+ * @brief Receive a transaction buffer. Framed transactions read the length
+ * byte first and then only the used part of their buffer.
+ */
+static inline bool receive_transaction_buffer(uint8_t transaction_id, uint8_t* buffer, uint8_t size) {
+    if (split_trans_is_framed(transaction_id)) {
+        if (unlikely(!serial_transport_receive(buffer, 1) || buffer[0] == 0 || buffer[0] > size)) {
+            return false;
+        }
+        return buffer[0] == 1 || serial_transport_receive(buffer + 1, buffer[0] - 1);
+    }
+    return serial_transport_receive(buffer, size);
+}
+
 /**
  * @brief This thread runs on the slave and responds to transactions initiated
  * by the master.
@@ -66,14 +91,14 @@ static inline bool react_to_transaction(void) {
 
     /* Send back the handshake which is XORed as a simple checksum,
      to signal that the slave is ready to receive possible transaction buffers  */
-    transaction_id ^= NUM_TOTAL_TRANSACTIONS;
-    if (unlikely(!serial_transport_send(&transaction_id, sizeof(transaction_id)))) {
+    uint8_t transaction_id_shake = transaction_id ^ NUM_TOTAL_TRANSACTIONS;
+    if (unlikely(!serial_transport_send(&transaction_id_shake, sizeof(transaction_id_shake)))) {
         return false;
     }
 
     /* Receive transaction buffer from the master. If this transaction requires it.*/
     if (transaction->initiator2target_buffer_size) {
-        if (unlikely(!serial_transport_receive(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        if (unlikely(!receive_transaction_buffer(transaction_id, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
             return false;
         }
     }
@@ -85,7 +110,7 @@ static inline bool react_to_transaction(void) {
 
     /* Send transaction buffer to the master. If this transaction requires it. */
     if (transaction->target2initiator_buffer_size) {
-        if (unlikely(!serial_transport_send(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        if (unlikely(!send_transaction_buffer(transaction_id, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
             return false;
         }
     }
@@ -140,7 +165,7 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     /* Send transaction buffer to the slave. If this transaction requires it. */
     if (transaction->initiator2target_buffer_size) {
-        if (unlikely(!serial_transport_send(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        if (unlikely(!send_transaction_buffer(transaction_id, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
             serial_dprintf("SPLIT: sending buffer failed\n");
             return false;
         }
@@ -148,7 +173,7 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     /* Receive transaction buffer from the slave. If this transaction requires it. */
     if (transaction->target2initiator_buffer_size) {
-        if (unlikely(!serial_transport_receive(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        if (unlikely(!receive_transaction_buffer(transaction_id, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
             serial_dprintf("SPLIT: receiving buffer failed\n");
             return false;
         }
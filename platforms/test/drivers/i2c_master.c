@@ -0,0 +1,70 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "i2c_master.h"
+
+static i2c_test_stats_t             i2c_test_stats;
+static i2c_test_write_callback_t    i2c_test_write_callback;
+static i2c_test_transmit_callback_t i2c_test_transmit_callback;
+
+void i2c_test_reset(void) {
+    memset(&i2c_test_stats, 0, sizeof(i2c_test_stats));
+}
+
+void i2c_test_set_write_callback(i2c_test_write_callback_t callback) {
+    i2c_test_write_callback = callback;
+}
+
+void i2c_test_set_transmit_callback(i2c_test_transmit_callback_t callback) {
+    i2c_test_transmit_callback = callback;
+}
+
+i2c_test_stats_t i2c_test_get_stats(void) {
+    return i2c_test_stats;
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_test_stats.transfers++;
+    i2c_test_stats.bytes += length;
+    if (i2c_test_transmit_callback) {
+        i2c_test_transmit_callback(address, data, length);
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    memset(data, 0, length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_test_stats.transfers++;
+    i2c_test_stats.bytes += 1 + length;
+    if (i2c_test_write_callback) {
+        i2c_test_write_callback(devaddr, regaddr, data, length);
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_test_stats.transfers++;
+    i2c_test_stats.bytes += 2 + length;
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    memset(data, 0, length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    memset(data, 0, length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
+    return I2C_STATUS_SUCCESS;
+}
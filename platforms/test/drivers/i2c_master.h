@@ -0,0 +1,39 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/* Mock I2C master for host tests.
+ * Mirrors the API of the platform I2C drivers, counting the traffic that
+ * goes through it and forwarding every write to an optional callback so
+ * that tests can model the device on the other end of the bus.
+ */
+#pragma once
+
+#include <stdint.h>
+
+typedef int16_t i2c_status_t;
+
+#define I2C_STATUS_SUCCESS (0)
+#define I2C_STATUS_ERROR (-1)
+#define I2C_STATUS_TIMEOUT (-2)
+
+void         i2c_init(void);
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout);
+
+typedef void (*i2c_test_write_callback_t)(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length);
+typedef void (*i2c_test_transmit_callback_t)(uint8_t address, const uint8_t* data, uint16_t length);
+
+typedef struct {
+    uint32_t transfers; // Number of write transactions
+    uint32_t bytes;     // Number of bytes written, including register addresses
+} i2c_test_stats_t;
+
+void             i2c_test_reset(void);
+void             i2c_test_set_write_callback(i2c_test_write_callback_t callback);
+void             i2c_test_set_transmit_callback(i2c_test_transmit_callback_t callback);
+i2c_test_stats_t i2c_test_get_stats(void);
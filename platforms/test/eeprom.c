@@ -16,10 +16,17 @@
 
 #include "eeprom.h"
 
-static uint8_t buffer[TOTAL_EEPROM_BYTE_COUNT];
+static uint8_t  buffer[TOTAL_EEPROM_BYTE_COUNT];
+static uint32_t read_count;
+
+/* Number of bytes read so far, for tests checking that EEPROM is kept off hot paths */
+uint32_t eeprom_test_get_read_count(void) {
+    return read_count;
+}
 
 uint8_t eeprom_read_byte(const uint8_t *addr) {
     uintptr_t offset = (uintptr_t)addr;
+    read_count++;
     return buffer[offset];
 }
 
@@ -23,3 +23,10 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+usb_report_queue_INC := $(TMK_PATH)/protocol/chibios
+usb_report_queue_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/usb_report_queue_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/usb_endpoint_mock.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(TMK_PATH)/protocol/chibios/usb_report_queue.c
@@ -0,0 +1,101 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "transactions.h"
+#include "transport.h"
+#include "split_transport_loopback.h"
+
+// Handshake byte in each direction
+#define LOOPBACK_HANDSHAKE_BYTES 2
+
+static split_shared_memory_t  shared_memory;
+static split_shared_memory_t  other_memory;
+static split_loopback_stats_t stats;
+static bool                   corrupt_next_response;
+
+split_shared_memory_t *const split_shmem = &shared_memory;
+
+static void swap_halves(void) {
+    split_shared_memory_t temp = shared_memory;
+    shared_memory              = other_memory;
+    other_memory               = temp;
+}
+
+static uint8_t wire_length(int8_t id, const uint8_t *buffer, uint8_t size) {
+    return split_trans_is_framed(id) ? buffer[0] : size;
+}
+
+void split_loopback_reset(void) {
+    memset(&shared_memory, 0, sizeof(shared_memory));
+    memset(&other_memory, 0, sizeof(other_memory));
+    memset(&stats, 0, sizeof(stats));
+    corrupt_next_response = false;
+}
+
+split_loopback_stats_t split_loopback_get_stats(void) {
+    return stats;
+}
+
+void split_loopback_corrupt_next_response(void) {
+    corrupt_next_response = true;
+}
+
+void split_loopback_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    swap_halves();
+    transactions_slave(master_matrix, slave_matrix);
+    swap_halves();
+}
+
+void transport_master_init(void) {}
+void transport_slave_init(void) {}
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    uint8_t                  *m2s   = split_trans_initiator2target_buffer(trans);
+    uint8_t                  *s2m   = split_trans_target2initiator_buffer(trans);
+
+    if (initiator2target_length > 0) {
+        size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+        memcpy(m2s, initiator2target_buf, len);
+    }
+
+    stats.transactions++;
+    stats.bytes += LOOPBACK_HANDSHAKE_BYTES;
+
+    // Master to slave
+    uint8_t length = trans->initiator2target_buffer_size ? wire_length(id, m2s, trans->initiator2target_buffer_size) : 0;
+    swap_halves();
+    memcpy(m2s, (uint8_t *)&other_memory + trans->initiator2target_offset, length);
+    stats.bytes += length;
+
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, m2s, trans->target2initiator_buffer_size, s2m);
+    }
+
+    // Slave to master
+    length = trans->target2initiator_buffer_size ? wire_length(id, s2m, trans->target2initiator_buffer_size) : 0;
+    swap_halves();
+    memcpy(s2m, (uint8_t *)&other_memory + trans->target2initiator_offset, length);
+    stats.bytes += length;
+
+    if (corrupt_next_response && length > 0) {
+        s2m[length - 1] ^= 0xFF;
+    }
+    corrupt_next_response = false;
+
+    if (target2initiator_length > 0) {
+        size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+        memcpy(target2initiator_buf, s2m, len);
+    }
+
+    return true;
+}
+
+bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    return transactions_master(master_matrix, slave_matrix);
+}
+
+void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    transactions_slave(master_matrix, slave_matrix);
+}
@@ -0,0 +1,28 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/* Loopback split transport for host tests.
+ * Stands in for transport.c, running both halves in one process. Each half
+ * gets its own shared memory, which is swapped into split_shmem while that
+ * half is running, and transactions are carried between them the way the
+ * full-duplex serial protocol would, counting the traffic on the way.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+
+typedef struct {
+    uint32_t transactions; // Number of round trips
+    uint32_t bytes;        // Number of bytes on the wire, including handshakes
+} split_loopback_stats_t;
+
+void                   split_loopback_reset(void);
+split_loopback_stats_t split_loopback_get_stats(void);
+
+// Corrupt the slave's response to the next transaction
+void split_loopback_corrupt_next_response(void);
+
+// Run a scan of the slave half
+void split_loopback_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
@@ -0,0 +1,60 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "usb_endpoint_mock.h"
+#include "timer.h"
+
+static struct {
+    usb_endpoint_mock_received_t    received;
+    usb_endpoint_mock_transmitted_t transmitted;
+    const uint8_t                  *data;
+    uint8_t                         size;
+    bool                            busy;
+    bool                            polling;
+    uint32_t                        last_poll;
+} endpoint;
+
+void usb_endpoint_mock_init(usb_endpoint_mock_received_t received, usb_endpoint_mock_transmitted_t transmitted) {
+    memset(&endpoint, 0, sizeof(endpoint));
+    endpoint.received    = received;
+    endpoint.transmitted = transmitted;
+    endpoint.polling     = true;
+    endpoint.last_poll   = timer_read32();
+}
+
+bool usb_endpoint_mock_busy(void) {
+    return endpoint.busy;
+}
+
+void usb_endpoint_mock_start_transmit(const uint8_t *data, uint8_t size) {
+    // Like the hardware, the report is read from the caller's buffer when the host collects it
+    endpoint.data = data;
+    endpoint.size = size;
+    endpoint.busy = true;
+}
+
+void usb_endpoint_mock_abort(void) {
+    endpoint.busy = false;
+}
+
+void usb_endpoint_mock_set_polling(bool polling) {
+    endpoint.polling = polling;
+}
+
+void usb_endpoint_mock_task(void) {
+    uint32_t now = timer_read32();
+    while (TIMER_DIFF_32(now, endpoint.last_poll) > 0) {
+        endpoint.last_poll++;
+        if (!endpoint.polling || !endpoint.busy) {
+            continue;
+        }
+        endpoint.busy = false;
+        if (endpoint.received) {
+            endpoint.received(endpoint.data, endpoint.size);
+        }
+        if (endpoint.transmitted) {
+            endpoint.transmitted();
+        }
+    }
+}
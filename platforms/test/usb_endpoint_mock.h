@@ -0,0 +1,41 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Emulates a single interrupt IN endpoint, polled by the host once per
+ * millisecond of mock time. */
+
+typedef void (*usb_endpoint_mock_received_t)(const uint8_t *data, uint8_t size);
+typedef void (*usb_endpoint_mock_transmitted_t)(void);
+
+/**
+ * \brief Resets the endpoint, with `received` called for each report collected by the host and `transmitted` as the
+ * IN notification callback.
+ */
+void usb_endpoint_mock_init(usb_endpoint_mock_received_t received, usb_endpoint_mock_transmitted_t transmitted);
+
+bool usb_endpoint_mock_busy(void);
+
+/**
+ * \brief Arms the endpoint with a report, which the host collects on its next poll.
+ */
+void usb_endpoint_mock_start_transmit(const uint8_t *data, uint8_t size);
+
+/**
+ * \brief Abandons the report in flight without an IN notification, as a bus reset does.
+ */
+void usb_endpoint_mock_abort(void);
+
+/**
+ * \brief Stops or resumes host polling, as when the host is busy or the bus is held up.
+ */
+void usb_endpoint_mock_set_polling(bool polling);
+
+/**
+ * \brief Runs every host poll due up to the current mock time.
+ */
+void usb_endpoint_mock_task(void);
@@ -0,0 +1,346 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+extern "C" {
+#include "report.h"
+#include "timer.h"
+#include "usb_endpoint_mock.h"
+#include "usb_report_queue.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* Scans run SCANS_PER_MS times per millisecond of mock time. */
+#define SCANS_PER_MS 4
+/* How long send_report() waits for a busy endpoint before giving up. */
+#define SEND_TIMEOUT_MS 10
+
+typedef std::vector<uint8_t> report_t;
+
+static usb_report_queue_t    queue;
+static std::vector<report_t> received;
+
+static void on_received(const uint8_t *data, uint8_t size) {
+    received.emplace_back(data, data + size);
+}
+
+/* Mirrors start_report_transmit_i() and report_transmitted_cb() in usb_main.c. */
+static void start_report_transmit(void) {
+    if (usb_endpoint_mock_busy()) {
+        return;
+    }
+    const usb_report_t *report = usb_report_queue_next(&queue);
+    if (report != NULL) {
+        usb_endpoint_mock_start_transmit(report->data, report->size);
+    }
+}
+
+static void on_transmitted(void) {
+    usb_report_queue_transmitted(&queue);
+    start_report_transmit();
+}
+
+class UsbReportQueue : public ::testing::Test {
+   protected:
+    bool                  queued;
+    uint32_t              stall_ms;
+    uint32_t              dropped;
+    std::vector<report_t> sent;
+
+    void SetUp() override {
+        set_time(0);
+        init(true);
+    }
+
+    void init(bool use_queue) {
+        queued   = use_queue;
+        stall_ms = 0;
+        dropped  = 0;
+        sent.clear();
+        received.clear();
+        usb_report_queue_clear(&queue);
+        usb_endpoint_mock_init(on_received, queued ? on_transmitted : NULL);
+    }
+
+    /* Sleeps the main loop until `done` returns true, as osalThreadSuspendTimeoutS() does. */
+    template <typename F>
+    bool wait_for(F &&done) {
+        for (int ms = 0; ms < SEND_TIMEOUT_MS; ++ms) {
+            advance_time(1);
+            stall_ms++;
+            usb_endpoint_mock_task();
+            if (done()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /* send_report() from usb_main.c, before and after the report queue. */
+    void send(const void *report, uint8_t size, usb_report_merge_t merge = NULL) {
+        sent.emplace_back((const uint8_t *)report, (const uint8_t *)report + size);
+        if (!queued) {
+            static uint8_t caller_buffer[USB_REPORT_QUEUE_REPORT_SIZE];
+            if (usb_endpoint_mock_busy() && !wait_for([] { return !usb_endpoint_mock_busy(); })) {
+                dropped++;
+                return;
+            }
+            // The caller's report is only valid until the next send, like the host driver's report structs
+            memcpy(caller_buffer, report, size);
+            usb_endpoint_mock_start_transmit(caller_buffer, size);
+            return;
+        }
+        if (!usb_report_queue_push(&queue, report, size, merge) && !wait_for([&] { return usb_report_queue_push(&queue, report, size, merge); })) {
+            dropped++;
+            return;
+        }
+        start_report_transmit();
+    }
+
+    /* One pass of the main loop; the clock moves on every SCANS_PER_MS scans. */
+    void scan(uint32_t n) {
+        if (n % SCANS_PER_MS == SCANS_PER_MS - 1) {
+            advance_time(1);
+        }
+        usb_endpoint_mock_task();
+    }
+
+    void drain(void) {
+        for (int ms = 0; ms < 100; ++ms) {
+            advance_time(1);
+            usb_endpoint_mock_task();
+        }
+    }
+
+    /* Sent reports which the host never saw, in order. */
+    uint32_t lost_transitions(void) {
+        size_t matched = 0;
+        for (auto &report : received) {
+            if (matched < sent.size() && report == sent[matched]) {
+                matched++;
+            }
+        }
+        return sent.size() - matched;
+    }
+
+    void report(const char *name) {
+        std::cout << name << (queued ? " (queued): " : " (blocking): ") << sent.size() << " reports, " << stall_ms << "ms stalled, " << dropped << " dropped, " << received.size() << " received" << std::endl;
+    }
+};
+
+/* Overlapping key presses, where each press is followed a scan later by the previous key's release. */
+TEST_F(UsbReportQueue, FastTyping) {
+    for (bool use_queue : {false, true}) {
+        init(use_queue);
+        uint8_t keys[8] = {0};
+        for (uint32_t n = 0; n < 600; ++n) {
+            // Key k goes down on scan 10k, and up 11 scans later while the next key is held
+            bool changed = false;
+            if (n % 10 == 0 && n < 580) {
+                keys[2 + (n / 10) % 2] = 4 + (n / 10) % 26;
+                changed                = true;
+            }
+            if (n % 10 == 1 && n >= 11) {
+                keys[2 + ((n - 11) / 10) % 2] = 0;
+                changed                       = true;
+            }
+            if (changed) {
+                send(keys, sizeof(keys));
+            }
+            scan(n);
+        }
+        drain();
+        report("fast typing");
+
+        EXPECT_EQ(lost_transitions(), 0u);
+        if (queued) {
+            EXPECT_EQ(received, sent);
+            EXPECT_EQ(stall_ms, 0u);
+        }
+    }
+}
+
+/* A sensor reporting movement on every scan, with a click part way through. */
+TEST_F(UsbReportQueue, MouseMovement) {
+    uint32_t blocking_stall = 0;
+    for (bool use_queue : {false, true}) {
+        init(use_queue);
+        int32_t        total_x = 0, total_v = 0;
+        report_mouse_t mouse   = {};
+        for (uint32_t n = 0; n < 2000; ++n) {
+            mouse.buttons = (n >= 800 && n < 804) ? 1 : 0;
+            mouse.x       = 3;
+            mouse.v       = n % 50 == 0 ? 1 : 0;
+            total_x += mouse.x;
+            total_v += mouse.v;
+            send(&mouse, sizeof(mouse), usb_report_merge_mouse);
+            scan(n);
+        }
+        drain();
+        report("mouse movement");
+
+        int32_t host_x = 0, host_v = 0, clicks = 0;
+        uint8_t buttons = 0;
+        for (auto &r : received) {
+            report_mouse_t m;
+            memcpy(&m, r.data(), sizeof(m));
+            host_x += m.x;
+            host_v += m.v;
+            clicks += (m.buttons & ~buttons) & 1;
+            buttons = m.buttons;
+        }
+        EXPECT_EQ(host_x, total_x);
+        EXPECT_EQ(host_v, total_v);
+        EXPECT_EQ(clicks, 1);
+        EXPECT_EQ(buttons, 0);
+        if (queued) {
+            EXPECT_EQ(stall_ms, 0u);
+            EXPECT_LT(received.size(), sent.size() / 2);
+        } else {
+            blocking_stall = stall_ms;
+        }
+    }
+    EXPECT_GT(blocking_stall, 0u);
+}
+
+/* send_string() tapping 32 characters with no delay between reports. */
+TEST_F(UsbReportQueue, SendStringBurst) {
+    uint32_t blocking_stall = 0;
+    for (bool use_queue : {false, true}) {
+        init(use_queue);
+        uint8_t keys[8] = {0};
+        for (int c = 0; c < 32; ++c) {
+            keys[2] = 4 + c % 26;
+            send(keys, sizeof(keys));
+            keys[2] = 0;
+            send(keys, sizeof(keys));
+        }
+        drain();
+        report("send_string burst");
+
+        EXPECT_EQ(dropped, 0u);
+        EXPECT_EQ(lost_transitions(), 0u);
+        if (queued) {
+            EXPECT_EQ(received, sent);
+            EXPECT_LT(stall_ms, blocking_stall);
+        } else {
+            blocking_stall = stall_ms;
+        }
+    }
+}
+
+/* The host stops polling for 30ms, while a few keys are typed. */
+TEST_F(UsbReportQueue, HostPause) {
+    for (bool use_queue : {false, true}) {
+        init(use_queue);
+        uint8_t keys[8] = {0};
+        usb_endpoint_mock_set_polling(false);
+        for (uint32_t n = 0; n < 30 * SCANS_PER_MS; ++n) {
+            if (n % 20 == 0) {
+                keys[2] = keys[2] ? 0 : 4 + n / 20;
+                send(keys, sizeof(keys));
+            }
+            scan(n);
+        }
+        usb_endpoint_mock_set_polling(true);
+        drain();
+        report("host pause");
+
+        if (queued) {
+            EXPECT_EQ(dropped, 0u);
+            EXPECT_EQ(received, sent);
+            EXPECT_EQ(stall_ms, 0u);
+        } else {
+            EXPECT_GT(lost_transitions(), 0u);
+        }
+    }
+}
+
+TEST_F(UsbReportQueue, MouseMergeKeepsButtonChanges) {
+    report_mouse_t mouse = {};
+    mouse.x              = 5;
+    // The first report goes out straight away, the rest wait for the host
+    send(&mouse, sizeof(mouse), usb_report_merge_mouse);
+    send(&mouse, sizeof(mouse), usb_report_merge_mouse);
+    send(&mouse, sizeof(mouse), usb_report_merge_mouse);
+    mouse.buttons = 1;
+    send(&mouse, sizeof(mouse), usb_report_merge_mouse);
+    mouse.buttons = 0;
+    send(&mouse, sizeof(mouse), usb_report_merge_mouse);
+    drain();
+
+    ASSERT_EQ(received.size(), 4u);
+    report_mouse_t host[4];
+    for (int i = 0; i < 4; ++i) {
+        memcpy(&host[i], received[i].data(), sizeof(report_mouse_t));
+    }
+    EXPECT_EQ(host[0].x, 5);
+    EXPECT_EQ(host[1].x, 10);
+    EXPECT_EQ(host[1].buttons, 0);
+    EXPECT_EQ(host[2].buttons, 1);
+    EXPECT_EQ(host[3].buttons, 0);
+}
+
+TEST_F(UsbReportQueue, MouseMergeSaturates) {
+    report_mouse_t mouse = {};
+    mouse.x              = 100;
+    for (int i = 0; i < 4; ++i) {
+        send(&mouse, sizeof(mouse), usb_report_merge_mouse);
+    }
+    drain();
+
+    // 100 is sent, then 100 + 100 would overflow, so each report waits in its own slot
+    EXPECT_EQ(received, sent);
+}
+
+TEST_F(UsbReportQueue, OversizeReportRejected) {
+    uint8_t report[USB_REPORT_QUEUE_REPORT_SIZE + 1] = {0};
+    EXPECT_FALSE(usb_report_queue_push(&queue, report, sizeof(report), NULL));
+    EXPECT_EQ(usb_report_queue_next(&queue), nullptr);
+}
+
+/* A transfer which did not come from the queue, such as an idle report, must not release a queued report. */
+TEST_F(UsbReportQueue, UnqueuedTransferCompletes) {
+    uint8_t idle[8] = {0};
+    usb_endpoint_mock_start_transmit(idle, sizeof(idle));
+
+    uint8_t keys[8] = {0, 0, 4};
+    send(keys, sizeof(keys));
+    drain();
+
+    ASSERT_EQ(received.size(), 2u);
+    EXPECT_EQ(received[1], report_t(keys, keys + sizeof(keys)));
+}
+
+/* A bus reset part way through a transfer, which never completes. */
+TEST_F(UsbReportQueue, TransferAbortedByReset) {
+    uint8_t keys[8] = {0, 0, 4};
+    usb_endpoint_mock_set_polling(false);
+    send(keys, sizeof(keys));
+    keys[2] = 0;
+    send(keys, sizeof(keys));
+
+    usb_endpoint_mock_abort();
+    // The queue still waits on the abandoned transfer, so nothing more would ever be sent
+    EXPECT_EQ(usb_report_queue_next(&queue), nullptr);
+    // As usb_event_cb() does on USB_EVENT_SUSPEND, USB_EVENT_UNCONFIGURED and USB_EVENT_RESET
+    usb_report_queue_clear(&queue);
+    usb_endpoint_mock_set_polling(true);
+
+    sent.clear();
+    keys[2] = 5;
+    send(keys, sizeof(keys));
+    keys[2] = 0;
+    send(keys, sizeof(keys));
+    drain();
+
+    EXPECT_EQ(dropped, 0u);
+    EXPECT_EQ(received, sent);
+}
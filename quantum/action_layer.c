@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -31,6 +32,39 @@ __attribute__((weak)) layer_state_t default_layer_state_set_kb(layer_state_t sta
     return default_layer_state_set_user(state);
 }
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+/** \brief layer resolution cache
+ *
+ * Topmost non-transparent layer of every matrix position, resolved lazily for
+ * the layer mask in resolved_layer_state.
+ */
+static uint8_t       resolved_layers[MATRIX_ROWS * MATRIX_COLS];
+static uint8_t       resolved_layers_valid[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)] = {0};
+static layer_state_t resolved_layer_state = 0;
+
+/** \brief Layer resolution cache invalidate
+ *
+ * Drops every resolved layer, they are recomputed on next lookup.
+ */
+void layer_resolution_cache_invalidate(void) {
+    memset(resolved_layers_valid, 0, sizeof(resolved_layers_valid));
+}
+
+/** \brief Layer resolution cache update
+ *
+ * Drops every resolved layer if the effective layer mask has changed.
+ */
+static void layer_resolution_cache_update(void) {
+    layer_state_t layers = layer_state | default_layer_state;
+    if (layers != resolved_layer_state) {
+        resolved_layer_state = layers;
+        layer_resolution_cache_invalidate();
+    }
+}
+#else
+#    define layer_resolution_cache_update()
+#endif
+
 /** \brief Default Layer State Set
  *
  * Static function to set the default layer state, prints debug info and clears keys
@@ -41,6 +75,7 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_debug();
     ac_dprintf(" to ");
     default_layer_state = state;
+    layer_resolution_cache_update();
     default_layer_debug();
     ac_dprintf("\n");
 #if defined(STRICT_LAYER_RELEASE)
@@ -121,6 +156,7 @@ void layer_state_set(layer_state_t state) {
     layer_debug();
     ac_dprintf(" to ");
     layer_state = state;
+    layer_resolution_cache_update();
     layer_debug();
     ac_dprintf("\n");
 #    if defined(STRICT_LAYER_RELEASE)
@@ -338,11 +374,29 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action.code = ACTION_TRANSPARENT;
 
     layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_RESOLUTION_CACHE
+    uint16_t entry_number = 0;
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        // Also catches direct assignments to layer_state, such as the one in dynamic_macro.h
+        layer_resolution_cache_update();
+        entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
+        if (resolved_layers_valid[entry_number / (CHAR_BIT)] & (1U << (entry_number % (CHAR_BIT)))) {
+            return resolved_layers[entry_number];
+        }
+        resolved_layers_valid[entry_number / (CHAR_BIT)] |= (1U << (entry_number % (CHAR_BIT)));
+        resolved_layers[entry_number] = 0;
+    }
+#    endif
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
             action = action_for_key(i, key);
             if (action.code != ACTION_TRANSPARENT) {
+#    ifdef LAYER_RESOLUTION_CACHE
+                if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+                    resolved_layers[entry_number] = i;
+                }
+#    endif
                 return i;
             }
         }
@@ -166,5 +166,12 @@ action_t store_or_get_action(bool pressed, keypos_t key);
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+/* drop all resolved layers, called by the dynamic keymap writes and by anything else changing the keymap contents */
+void layer_resolution_cache_invalidate(void);
+#else
+#    define layer_resolution_cache_invalidate()
+#endif
+
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
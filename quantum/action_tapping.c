@@ -67,6 +67,8 @@ static uint8_t     waiting_buffer_tail                 = 0;
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
 static void waiting_buffer_clear(void);
+static bool waiting_buffer_process(void);
+static bool waiting_buffer_release_settled(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
 static void waiting_buffer_scan_tap(void);
@@ -85,12 +87,16 @@ void action_tapping_process(keyrecord_t record) {
             ac_dprintf("\n");
         }
     } else {
-        if (!waiting_buffer_enq(record)) {
-            // clear all in case of overflow.
-            ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
-            clear_keyboard();
-            waiting_buffer_clear();
-            tapping_key = (keyrecord_t){0};
+        while (!waiting_buffer_enq(record)) {
+            // the events ahead of this one may have been settled by it, so try to make room first
+            if (!waiting_buffer_process()) {
+                // clear all in case of overflow.
+                ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
+                clear_keyboard();
+                waiting_buffer_clear();
+                tapping_key = (keyrecord_t){0};
+                break;
+            }
         }
     }
 
@@ -98,15 +104,7 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
-        if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
-            ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
-            debug_record(waiting_buffer[waiting_buffer_tail]);
-            ac_dprintf("\n\n");
-        } else {
-            break;
-        }
-    }
+    waiting_buffer_process();
     if (IS_EVENT(record.event)) {
         ac_dprintf("\n");
     }
@@ -463,6 +461,66 @@ void waiting_buffer_clear(void) {
     waiting_buffer_tail = 0;
 }
 
+/** \brief Waiting buffer process
+ *
+ * Replays buffered events until one has to wait for the tapping key again.
+ *
+ * \return true if any event was taken out of the buffer
+ */
+bool waiting_buffer_process(void) {
+    uint8_t tail = waiting_buffer_tail;
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+        if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
+            ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
+            debug_record(waiting_buffer[waiting_buffer_tail]);
+            ac_dprintf("\n\n");
+        } else {
+            break;
+        }
+    }
+    bool released = waiting_buffer_release_settled();
+    return released || waiting_buffer_tail != tail;
+}
+
+/** \brief Waiting buffer release settled keys
+ *
+ * Releases of keys which were already settled when the current tapping key was
+ * pressed would have been processed straight away had they arrived now. They
+ * only sit in the buffer because an earlier tapping key held them back, so take
+ * them out ahead of the events which are waiting on the current tapping key.
+ *
+ * \return true if any event was taken out of the buffer
+ */
+static bool waiting_buffer_release_settled(void) {
+    if (IS_NOEVENT(tapping_key.event) || !tapping_key.event.pressed || tapping_key.tap.count > 0 || waiting_buffer_tail == waiting_buffer_head) {
+        return false;
+    }
+
+    bool    released = false;
+    uint8_t i        = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+    while (i != waiting_buffer_head) {
+        keyrecord_t *candidate = &waiting_buffer[i];
+        // clang-format off
+        if (IS_EVENT(candidate->event) && !candidate->event.pressed && !IS_TAPPING_RECORD(candidate) &&
+            !waiting_buffer_typed(candidate->event) && WITHIN_TAPPING_TERM(candidate->event) &&
+            process_tapping(candidate)
+        ) {
+            // clang-format on
+            ac_dprintf("processed: settled release waiting_buffer[%u] =", i);
+            debug_record(*candidate);
+            ac_dprintf("\n");
+            for (uint8_t j = i; (j + 1) % WAITING_BUFFER_SIZE != waiting_buffer_head; j = (j + 1) % WAITING_BUFFER_SIZE) {
+                waiting_buffer[j] = waiting_buffer[(j + 1) % WAITING_BUFFER_SIZE];
+            }
+            waiting_buffer_head = (waiting_buffer_head + WAITING_BUFFER_SIZE - 1) % WAITING_BUFFER_SIZE;
+            released            = true;
+        } else {
+            i = (i + 1) % WAITING_BUFFER_SIZE;
+        }
+    }
+    return released;
+}
+
 /** \brief Waiting buffer typed
  *
  * FIXME: Needs docs
@@ -53,7 +53,8 @@ RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
     v = hsv.v;
 #endif
 
-    region    = h * 6 / 255;
+    // h * 6 / 255 without the division, exact for every h
+    region    = (h * 6 + ((h * 6) >> 8) + 1) >> 8;
     remainder = (h * 2 - region * 85) * 3;
 
     p = (v * (255 - s)) >> 8;
@@ -0,0 +1,179 @@
+/*
+Copyright 2024 QMK
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Basic per-key algorithm, behaving the same as sym_eager_pk.
+The per-key counters are stored as vertical counters: bit n of the counter
+for every key in a row lives in one matrix_row_t, so a whole row of counters
+is updated with a few bitwise operations instead of a loop over each key.
+After pressing a key, it immediately changes state, and sets a counter.
+No further inputs are accepted until DEBOUNCE milliseconds have occurred.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <string.h>
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+
+// Number of bits needed to count down from DEBOUNCE
+#    if DEBOUNCE < 2
+#        define COUNTER_BITS 1
+#    elif DEBOUNCE < 4
+#        define COUNTER_BITS 2
+#    elif DEBOUNCE < 8
+#        define COUNTER_BITS 3
+#    elif DEBOUNCE < 16
+#        define COUNTER_BITS 4
+#    elif DEBOUNCE < 32
+#        define COUNTER_BITS 5
+#    elif DEBOUNCE < 64
+#        define COUNTER_BITS 6
+#    elif DEBOUNCE < 128
+#        define COUNTER_BITS 7
+#    else
+#        define COUNTER_BITS 8
+#    endif
+
+static matrix_row_t debounce_counters[COUNTER_BITS][MATRIX_ROWS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         matrix_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time);
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    memset(debounce_counters, 0, sizeof(debounce_counters));
+    counters_need_update = false;
+    matrix_need_update   = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters(num_rows, elapsed_time);
+        }
+    }
+
+    if (changed || matrix_need_update) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        transfer_matrix_values(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+// Keys in the row whose counters are running
+static matrix_row_t active_counters(uint8_t row) {
+    matrix_row_t active = 0;
+    for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+        active |= debounce_counters[bit][row];
+    }
+    return active;
+}
+
+// Subtract elapsed_time from every running counter in the row, returning the keys whose counters ran out
+static matrix_row_t expire_debounce_counters(uint8_t row, uint8_t elapsed_time) {
+    matrix_row_t active    = active_counters(row);
+    matrix_row_t borrow    = 0;
+    matrix_row_t remaining = 0;
+    if (!active) {
+        return 0;
+    }
+
+    for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+        matrix_row_t counter = debounce_counters[bit][row];
+        matrix_row_t elapsed = (elapsed_time >> bit) & 1 ? ~(matrix_row_t)0 : 0;
+
+        debounce_counters[bit][row] = counter ^ elapsed ^ borrow;
+        borrow                      = (~counter & elapsed) | (~(counter ^ elapsed) & borrow);
+        remaining |= debounce_counters[bit][row];
+    }
+    if (elapsed_time >> COUNTER_BITS) {
+        borrow = ~(matrix_row_t)0;
+    }
+
+    matrix_row_t expired = active & (borrow | ~remaining);
+    for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+        debounce_counters[bit][row] &= active & ~expired;
+    }
+    if (active & ~expired) {
+        counters_need_update = true;
+    }
+    return expired;
+}
+
+// If the current time is > debounce counter, set the counter to enable input.
+static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    matrix_need_update   = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        if (expire_debounce_counters(row, elapsed_time)) {
+            matrix_need_update = true;
+        }
+    }
+}
+
+// upload from raw_matrix to final matrix;
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    matrix_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        // Flip every changed key which isn't still locked out by its counter
+        matrix_row_t flip = (raw[row] ^ cooked[row]) & ~active_counters(row);
+        if (flip) {
+            for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+                if ((DEBOUNCE >> bit) & 1) {
+                    debounce_counters[bit][row] |= flip;
+                }
+            }
+            counters_need_update = true;
+            cooked_changed       = true;
+            cooked[row] ^= flip;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
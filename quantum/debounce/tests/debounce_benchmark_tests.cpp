@@ -0,0 +1,84 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+extern "C" {
+#include "debounce.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* Scans run SCANS_PER_MS times per millisecond. */
+#define SCANS_PER_MS 4
+#define BENCHMARK_MS 20000
+
+/* Times debounce() over BENCHMARK_MS of scanning, while one key at a time is
+ * pressed and released every 50ms, with each edge bouncing twice. The raw
+ * matrix for every millisecond is generated up front, so only the debounce
+ * calls and the simulated clock are inside the timed loop.
+ */
+TEST(DebounceBenchmark, OneKeyBouncing) {
+    static matrix_row_t raw[BENCHMARK_MS][MATRIX_ROWS];
+    static bool         changed[BENCHMARK_MS];
+    matrix_row_t        cooked[MATRIX_ROWS] = {0};
+
+    memset(raw, 0, sizeof(raw));
+    for (uint32_t ms = 0; ms < BENCHMARK_MS; ms++) {
+        uint32_t key   = ms / 50;
+        uint8_t  row   = key % MATRIX_ROWS;
+        uint8_t  col   = (key / MATRIX_ROWS) % MATRIX_COLS;
+        uint32_t phase = ms % 50;
+        bool     down  = phase < 25;
+
+        /* Bounce for the first 2ms after each edge */
+        if (phase % 25 < 2) {
+            down = !down;
+        }
+        if (down) {
+            raw[ms][row] |= (matrix_row_t)1 << col;
+        }
+        changed[ms] = ms == 0 || memcmp(raw[ms], raw[ms - 1], sizeof(raw[ms])) != 0;
+    }
+
+    set_time(0);
+    debounce_init(MATRIX_ROWS);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t ms = 0; ms < BENCHMARK_MS; ms++) {
+        debounce(raw[ms], cooked, MATRIX_ROWS, changed[ms]);
+        for (int i = 1; i < SCANS_PER_MS; i++) {
+            debounce(raw[ms], cooked, MATRIX_ROWS, false);
+        }
+        advance_time(1);
+    }
+    uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    /* Let the last release settle */
+    for (int i = 0; i < DEBOUNCE + 1; i++) {
+        advance_time(1);
+        debounce(raw[BENCHMARK_MS - 1], cooked, MATRIX_ROWS, false);
+    }
+    EXPECT_EQ(memcmp(raw[BENCHMARK_MS - 1], cooked, sizeof(cooked)), 0);
+    debounce_free();
+
+    std::cout << MATRIX_ROWS * MATRIX_COLS << " keys: " << BENCHMARK_MS * SCANS_PER_MS << " scans, " << (double)elapsed / (BENCHMARK_MS * SCANS_PER_MS) << "ns per scan" << std::endl;
+}
@@ -52,3 +52,35 @@ debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+debounce_sym_defer_pk_vc_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_pk_vc_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_vc.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+
+debounce_sym_eager_pk_vc_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_eager_pk_vc_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_pk_vc.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_eager_pk_tests.cpp
+
+# 144 keys, to compare the per-key algorithms with their vertical counter versions
+DEBOUNCE_BENCHMARK_DEFS := -DMATRIX_ROWS=8 -DMATRIX_COLS=18 -DDEBOUNCE=5
+
+DEBOUNCE_BENCHMARK_SRC := $(QUANTUM_PATH)/debounce/tests/debounce_benchmark_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+debounce_sym_defer_pk_benchmark_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_sym_defer_pk_benchmark_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c
+
+debounce_sym_defer_pk_vc_benchmark_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_sym_defer_pk_vc_benchmark_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_vc.c
+
+debounce_sym_eager_pk_benchmark_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_sym_eager_pk_benchmark_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_pk.c
+
+debounce_sym_eager_pk_vc_benchmark_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_sym_eager_pk_vc_benchmark_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_pk_vc.c
@@ -9,34 +9,139 @@
 #    define MAX_DEFERRED_EXECUTORS 8
 #endif
 
+_Static_assert(MAX_DEFERRED_EXECUTORS <= DEFERRED_EXEC_MAX_TABLE_COUNT, "MAX_DEFERRED_EXECUTORS is larger than the maximum table size");
+
 //------------------------------------
 // Helpers
 //
+// Each table is kept as a binary min-heap ordered by trigger time, so only the root needs to be checked to know whether
+// anything is due. Executors stay in the slot they were allocated, and the heap is a permutation of the slots -- each
+// entry's heap_slot is the slot at that heap position, and its heap_index is that slot's heap position. Both are stored
+// XOR'ed with the entry's own index, so that a zero-initialised table starts out as the identity permutation. The slots
+// of pending executors make up the start of the heap, followed by the free slots.
+//
+// Tokens are made up of the slot and a per-slot generation, which is advanced whenever the slot is freed. This allows
+// tokens to be checked without searching the table, and rejects stale tokens for a slot that has since been reused.
 
-static deferred_token current_token = 0;
+static inline size_t slot_at(deferred_executor_t *table, size_t index) {
+    return (uint8_t)(table[index].heap_slot ^ index);
+}
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static inline size_t index_of(deferred_executor_t *table, size_t slot) {
+    return (uint8_t)(table[slot].heap_index ^ slot);
+}
+
+static inline void place(deferred_executor_t *table, size_t index, size_t slot) {
+    table[index].heap_slot = (uint8_t)(slot ^ index);
+    table[slot].heap_index = (uint8_t)(index ^ slot);
+}
+
+static inline bool is_valid_table(deferred_executor_t *table, size_t table_count) {
+    return table && table_count > 0 && table_count <= DEFERRED_EXEC_MAX_TABLE_COUNT;
+}
+
+static inline bool triggers_before(deferred_executor_t *table, size_t slot_a, size_t slot_b) {
+    return ((int32_t)TIMER_DIFF_32(table[slot_a].trigger_time, table[slot_b].trigger_time)) < 0;
+}
+
+// Pending executors occupy the start of the heap, so the count can be found with a binary search
+static size_t pending_count(deferred_executor_t *table, size_t table_count) {
+    size_t lo = 0, hi = table_count;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (table[slot_at(table, mid)].token != INVALID_DEFERRED_TOKEN) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
     }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+    return lo;
+}
+
+static void sift_up(deferred_executor_t *table, size_t index) {
+    size_t slot = slot_at(table, index);
+    while (index > 0) {
+        size_t parent      = (index - 1) / 2;
+        size_t parent_slot = slot_at(table, parent);
+        if (!triggers_before(table, slot, parent_slot)) {
+            break;
         }
+        place(table, index, parent_slot);
+        index = parent;
     }
-    return true;
+    place(table, index, slot);
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static void sift_down(deferred_executor_t *table, size_t count, size_t index) {
+    size_t slot = slot_at(table, index);
+    while (true) {
+        size_t child = 2 * index + 1;
+        if (child >= count) {
+            break;
+        }
+        size_t child_slot = slot_at(table, child);
+        if (child + 1 < count && triggers_before(table, slot_at(table, child + 1), child_slot)) {
+            child_slot = slot_at(table, ++child);
         }
+        if (!triggers_before(table, child_slot, slot)) {
+            break;
+        }
+        place(table, index, child_slot);
+        index = child;
+    }
+    place(table, index, slot);
+}
+
+// Restores the heap order after the trigger time of the executor at the given heap position has changed
+static void reschedule(deferred_executor_t *table, size_t count, size_t index) {
+    if (index > 0 && triggers_before(table, slot_at(table, index), slot_at(table, (index - 1) / 2))) {
+        sift_up(table, index);
+    } else {
+        sift_down(table, count, index);
+    }
+}
+
+// Returns the number of generations a slot can go through before its tokens repeat
+static inline size_t generation_count(size_t table_count) {
+    size_t count = ((deferred_token)~0) / table_count;
+    return count < 256 ? count : 256;
+}
+
+static inline deferred_token make_token(size_t table_count, size_t slot, uint8_t generation) {
+    return (deferred_token)(1 + slot + (size_t)generation * table_count);
+}
+
+// Returns the slot of the pending executor for the token, or table_count if the token isn't valid
+static inline size_t token_slot(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return table_count;
+    }
+    size_t slot = (token - 1) % table_count;
+    return table[slot].token == token ? slot : table_count;
+}
+
+// Removes the executor in the given slot from the heap, and frees the slot
+static void release_slot(deferred_executor_t *table, size_t table_count, size_t slot) {
+    size_t count = pending_count(table, table_count);
+    size_t index = index_of(table, slot);
+    size_t last  = count - 1;
+
+    // Move the last pending executor into the freed heap position, and put the freed slot where it was
+    if (index != last) {
+        place(table, index, slot_at(table, last));
+        place(table, last, slot);
+    }
+
+    deferred_executor_t *entry = &table[slot];
+    entry->token               = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time        = 0;
+    entry->callback            = NULL;
+    entry->cb_arg              = NULL;
+    entry->generation          = (entry->generation + 1) % generation_count(table_count);
+
+    if (index != last) {
+        reschedule(table, last, index);
     }
-    return current_token;
 }
 
 //------------------------------------
@@ -45,112 +150,108 @@ static inline deferred_token allocate_token(deferred_executor_t *table, size_t t
 
 deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
     // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || !callback) {
+    if (!is_valid_table(table, table_count) || delay_ms == 0 || !callback) {
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Claim the first free slot in the heap, if there are any
+    size_t count = pending_count(table, table_count);
+    if (count == table_count) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry
+    size_t               slot  = slot_at(table, count);
+    deferred_executor_t *entry = &table[slot];
+    entry->token               = make_token(table_count, slot, entry->generation);
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    sift_up(table, count);
+    return entry->token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
     // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || token == INVALID_DEFERRED_TOKEN) {
+    if (!is_valid_table(table, table_count) || delay_ms == 0) {
         return false;
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    size_t slot = token_slot(table, table_count, token);
+    if (slot == table_count) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    table[slot].trigger_time = timer_read32() + delay_ms;
+    reschedule(table, pending_count(table, table_count), index_of(table, slot));
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
     // Ignore request if the table/token are not valid
-    if (!table || table_count == 0 || token == INVALID_DEFERRED_TOKEN) {
+    if (!is_valid_table(table, table_count)) {
         return false;
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    size_t slot = token_slot(table, table_count, token);
+    if (slot == table_count) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    release_slot(table, table_count, slot);
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
+    if (!is_valid_table(table, table_count)) {
+        return;
+    }
+
     uint32_t now = timer_read32();
 
     // Throttle only once per millisecond
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        // Run through the executors which are due, earliest first
+        while (true) {
+            size_t               slot       = slot_at(table, 0);
+            deferred_executor_t *entry      = &table[slot];
             deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+            // Check if we're supposed to execute the earliest entry
+            if (curr_token == INVALID_DEFERRED_TOKEN || ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
+            }
+
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
 
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
+            // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
+            if (entry->token != curr_token) {
+                continue;
+            }
 
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations. If it has
+                // fallen more than a whole period behind, it's run again on the next pass rather than repeatedly in
+                // this one.
+                entry->trigger_time += delay_ms;
+                if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+                    entry->trigger_time = now + 1;
                 }
+                reschedule(table, pending_count(table, table_count), index_of(table, slot));
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                release_slot(table, table_count, slot);
             }
         }
     }
@@ -14,7 +14,7 @@
 /**
  * @typedef A token that can be used to cancel or extend an existing deferred execution.
  */
-typedef uint8_t deferred_token;
+typedef uint16_t deferred_token;
 
 /**
  * @def The constant used to denote an invalid deferred execution token.
@@ -69,16 +69,25 @@ void deferred_exec_task(void);
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //------------------------------------
 
+/**
+ * @def The maximum number of executors in a self-hosted deferred executor table.
+ */
+#define DEFERRED_EXEC_MAX_TABLE_COUNT 256
+
 /**
  * @struct Structure for containing self-hosted deferred executor tables.
  * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
- *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
+ *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array,
+ *        zero-initialised, of no more than DEFERRED_EXEC_MAX_TABLE_COUNT entries.
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
+    uint8_t                generation;
+    uint8_t                heap_slot;
+    uint8_t                heap_index;
 } deferred_executor_t;
 
 /**
@@ -17,6 +17,7 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
@@ -132,52 +133,118 @@ _Static_assert(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR >= DYNAMIC_KEYMAP_MACRO_EEPROM_ADD
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#define DYNAMIC_KEYMAP_EEPROM_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// Native-endian mirror of the keymap (and encoder map) stored in EEPROM.
+// Lookups are served from here; every write goes through to EEPROM as well.
+static uint16_t dynamic_keymap_cache[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+#    ifdef ENCODER_MAP_ENABLE
+static uint16_t dynamic_keymap_encoder_cache[DYNAMIC_KEYMAP_LAYER_COUNT][NUM_ENCODERS][2];
+#    endif
+
+// Reloads the cached keycodes covering the byte range [offset, offset + size) of the keymap buffer
+static void dynamic_keymap_cache_load(uint16_t offset, uint16_t size) {
+    uint16_t *cache = &dynamic_keymap_cache[0][0][0];
+    uint32_t  end   = (uint32_t)offset + size;
+    if (end > DYNAMIC_KEYMAP_EEPROM_SIZE) {
+        end = DYNAMIC_KEYMAP_EEPROM_SIZE;
+    }
+    uint32_t i     = offset / 2;
+    uint32_t i_end = (end + 1) / 2;
+    while (i < i_end) {
+        uint8_t  data[32];
+        uint32_t count = (i_end - i) < sizeof(data) / 2 ? (i_end - i) : sizeof(data) / 2;
+        eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + i * 2), count * 2);
+        for (uint32_t j = 0; j < count; j++, i++) {
+            // Big endian in EEPROM
+            cache[i] = (data[j * 2] << 8) | data[j * 2 + 1];
+        }
+    }
+}
+
+#    ifdef ENCODER_MAP_ENABLE
+static void dynamic_keymap_encoder_cache_load(void) {
+    uint16_t *cache = &dynamic_keymap_encoder_cache[0][0][0];
+    for (uint16_t i = 0; i < DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2; i++) {
+        uint8_t data[2];
+        eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR + i * 2), sizeof(data));
+        cache[i] = (data[0] << 8) | data[1];
+    }
+}
+#    endif // ENCODER_MAP_ENABLE
+#endif     // DYNAMIC_KEYMAP_RAM_CACHE
+
+void dynamic_keymap_init(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache_load(0, DYNAMIC_KEYMAP_EEPROM_SIZE);
+#    ifdef ENCODER_MAP_ENABLE
+    dynamic_keymap_encoder_cache_load();
+#    endif
+#endif
+}
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
 void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column) {
     // TODO: optimize this with some left shifts
-    return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+    return (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2));
 }
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    return dynamic_keymap_cache[layer][row][column];
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    uint8_t data[2] = {keycode >> 8, keycode & 0xFF};
+    eeprom_update_block(data, address, sizeof(data));
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache[layer][row][column] = keycode;
+#endif
+    layer_resolution_cache_invalidate();
 }
 
 #ifdef ENCODER_MAP_ENABLE
 void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id) {
-    return ((void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) + (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2);
+    return (void *)(uintptr_t)(DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR + (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2));
 }
 
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    return dynamic_keymap_encoder_cache[layer][encoder_id][clockwise ? 0 : 1];
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
     keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
+#    endif
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+    uint8_t data[2] = {keycode >> 8, keycode & 0xFF};
+    eeprom_update_block(data, address + (clockwise ? 0 : 2), sizeof(data));
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_encoder_cache[layer][encoder_id][clockwise ? 0 : 1] = keycode;
+#    endif
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -186,7 +253,7 @@ uint8_t dynamic_keymap_get_qmk_settings(uint16_t offset) {
     if (offset >= VIAL_QMK_SETTINGS_SIZE)
         return 0;
 
-    void *address = (void*)(VIAL_QMK_SETTINGS_EEPROM_ADDR + offset);
+    void *address = (void *)(uintptr_t)(VIAL_QMK_SETTINGS_EEPROM_ADDR + offset);
     return eeprom_read_byte(address);
 }
 
@@ -194,7 +261,7 @@ void dynamic_keymap_set_qmk_settings(uint16_t offset, uint8_t value) {
     if (offset >= VIAL_QMK_SETTINGS_SIZE)
         return;
 
-    void *address = (void*)(VIAL_QMK_SETTINGS_EEPROM_ADDR + offset);
+    void *address = (void *)(uintptr_t)(VIAL_QMK_SETTINGS_EEPROM_ADDR + offset);
     eeprom_update_byte(address, value);
 }
 #endif
@@ -204,7 +271,7 @@ int dynamic_keymap_get_tap_dance(uint8_t index, vial_tap_dance_entry_t *entry) {
     if (index >= VIAL_TAP_DANCE_ENTRIES)
         return -1;
 
-    void *address = (void*)(VIAL_TAP_DANCE_EEPROM_ADDR + index * sizeof(vial_tap_dance_entry_t));
+    void *address = (void *)(uintptr_t)(VIAL_TAP_DANCE_EEPROM_ADDR + index * sizeof(vial_tap_dance_entry_t));
     eeprom_read_block(entry, address, sizeof(vial_tap_dance_entry_t));
 
     return 0;
@@ -214,8 +281,8 @@ int dynamic_keymap_set_tap_dance(uint8_t index, const vial_tap_dance_entry_t *en
     if (index >= VIAL_TAP_DANCE_ENTRIES)
         return -1;
 
-    void *address = (void*)(VIAL_TAP_DANCE_EEPROM_ADDR + index * sizeof(vial_tap_dance_entry_t));
-    eeprom_write_block(entry, address, sizeof(vial_tap_dance_entry_t));
+    void *address = (void *)(uintptr_t)(VIAL_TAP_DANCE_EEPROM_ADDR + index * sizeof(vial_tap_dance_entry_t));
+    eeprom_update_block(entry, address, sizeof(vial_tap_dance_entry_t));
 
     return 0;
 }
@@ -226,7 +293,7 @@ int dynamic_keymap_get_combo(uint8_t index, vial_combo_entry_t *entry) {
     if (index >= VIAL_COMBO_ENTRIES)
         return -1;
 
-    void *address = (void*)(VIAL_COMBO_EEPROM_ADDR + index * sizeof(vial_combo_entry_t));
+    void *address = (void *)(uintptr_t)(VIAL_COMBO_EEPROM_ADDR + index * sizeof(vial_combo_entry_t));
     eeprom_read_block(entry, address, sizeof(vial_combo_entry_t));
 
     return 0;
@@ -236,8 +303,8 @@ int dynamic_keymap_set_combo(uint8_t index, const vial_combo_entry_t *entry) {
     if (index >= VIAL_COMBO_ENTRIES)
         return -1;
 
-    void *address = (void*)(VIAL_COMBO_EEPROM_ADDR + index * sizeof(vial_combo_entry_t));
-    eeprom_write_block(entry, address, sizeof(vial_combo_entry_t));
+    void *address = (void *)(uintptr_t)(VIAL_COMBO_EEPROM_ADDR + index * sizeof(vial_combo_entry_t));
+    eeprom_update_block(entry, address, sizeof(vial_combo_entry_t));
 
     return 0;
 }
@@ -248,7 +315,7 @@ int dynamic_keymap_get_key_override(uint8_t index, vial_key_override_entry_t *en
     if (index >= VIAL_KEY_OVERRIDE_ENTRIES)
         return -1;
 
-    void *address = (void*)(VIAL_KEY_OVERRIDE_EEPROM_ADDR + index * sizeof(vial_key_override_entry_t));
+    void *address = (void *)(uintptr_t)(VIAL_KEY_OVERRIDE_EEPROM_ADDR + index * sizeof(vial_key_override_entry_t));
     eeprom_read_block(entry, address, sizeof(vial_key_override_entry_t));
 
     return 0;
@@ -258,8 +325,8 @@ int dynamic_keymap_set_key_override(uint8_t index, const vial_key_override_entry
     if (index >= VIAL_KEY_OVERRIDE_ENTRIES)
         return -1;
 
-    void *address = (void*)(VIAL_KEY_OVERRIDE_EEPROM_ADDR + index * sizeof(vial_key_override_entry_t));
-    eeprom_write_block(entry, address, sizeof(vial_key_override_entry_t));
+    void *address = (void *)(uintptr_t)(VIAL_KEY_OVERRIDE_EEPROM_ADDR + index * sizeof(vial_key_override_entry_t));
+    eeprom_update_block(entry, address, sizeof(vial_key_override_entry_t));
 
     return 0;
 }
@@ -272,12 +339,16 @@ void dynamic_keymap_reset(void) {
     vial_unlocked = 1;
 #endif
 
-    // Reset the keymaps in EEPROM to what is in flash.
+    // Reset the keymaps in EEPROM to what is in flash, one row per block write.
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int row = 0; row < MATRIX_ROWS; row++) {
+            uint8_t data[MATRIX_COLS * 2];
             for (int column = 0; column < MATRIX_COLS; column++) {
-                dynamic_keymap_set_keycode(layer, row, column, keycode_at_keymap_location_raw(layer, row, column));
+                uint16_t keycode     = keycode_at_keymap_location_raw(layer, row, column);
+                data[column * 2]     = keycode >> 8;
+                data[column * 2 + 1] = keycode & 0xFF;
             }
+            eeprom_update_block(data, dynamic_keymap_key_to_eeprom_address(layer, row, 0), sizeof(data));
         }
 #ifdef ENCODER_MAP_ENABLE
         for (int encoder = 0; encoder < NUM_ENCODERS; encoder++) {
@@ -286,6 +357,10 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache_load(0, DYNAMIC_KEYMAP_EEPROM_SIZE);
+#endif
+    layer_resolution_cache_invalidate();
 
 #ifdef QMK_SETTINGS
     qmk_settings_reset();
@@ -313,30 +388,31 @@ void dynamic_keymap_reset(void) {
 #endif
 
 #ifdef VIAL_ENABLE
+    /* pick up the entries written above */
+    vial_reload();
+
     /* re-lock the keyboard */
     vial_unlocked = vial_unlocked_prev;
 #endif
 }
 
-void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+// Number of bytes of a [offset, offset + size) transfer that fall within a region of region_size bytes
+static uint16_t dynamic_keymap_buffer_length(uint16_t offset, uint16_t size, uint16_t region_size) {
+    if (offset >= region_size) {
+        return 0;
     }
+    return (region_size - offset) < size ? (region_size - offset) : size;
+}
+
+void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    uint16_t length = dynamic_keymap_buffer_length(offset, size, DYNAMIC_KEYMAP_EEPROM_SIZE);
+    eeprom_read_block(data, (const void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), length);
+    memset(data + length, 0x00, size - length);
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
+    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_EEPROM_SIZE;
+    void *   target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
 
 #ifdef VIAL_ENABLE
     /* ensure the writes are bounded */
@@ -382,13 +458,12 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 #endif
 #endif
 
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
-    }
+    eeprom_update_block(data, target, dynamic_keymap_buffer_length(offset, size, dynamic_keymap_eeprom_size));
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache_load(offset, size);
+#endif
+    layer_resolution_cache_invalidate();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -407,6 +482,19 @@ uint16_t keycode_at_encodermap_location(uint8_t layer_num, uint8_t encoder_idx,
 }
 #endif // ENCODER_MAP_ENABLE
 
+#ifndef DYNAMIC_KEYMAP_MACRO_CHUNK_SIZE
+#    define DYNAMIC_KEYMAP_MACRO_CHUNK_SIZE 32
+#endif
+
+#define DYNAMIC_KEYMAP_MACRO_NOT_FOUND 0xFFFF
+
+#ifdef DYNAMIC_KEYMAP_MACRO_INDEX
+// Start offset of each macro within the macro buffer, rebuilt on the first
+// send after the buffer has been written or reset.
+static uint16_t dynamic_keymap_macro_offsets[DYNAMIC_KEYMAP_MACRO_COUNT];
+static bool     dynamic_keymap_macro_offsets_valid = false;
+#endif
+
 uint8_t dynamic_keymap_macro_get_count(void) {
     return DYNAMIC_KEYMAP_MACRO_COUNT;
 }
@@ -416,46 +504,115 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
-    }
+    uint16_t length = dynamic_keymap_buffer_length(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    eeprom_read_block(data, (const void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
+    memset(data + length, 0x00, size - length);
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *source = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
-    }
+    eeprom_update_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), dynamic_keymap_buffer_length(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE));
+#ifdef DYNAMIC_KEYMAP_MACRO_INDEX
+    dynamic_keymap_macro_offsets_valid = false;
+#endif
 }
 
 void dynamic_keymap_macro_reset(void) {
-    void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (p != end) {
-        eeprom_update_byte(p, 0);
-        ++p;
+    static const uint8_t zeros[32] = {0};
+    for (uint16_t offset = 0; offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE; offset += sizeof(zeros)) {
+        eeprom_update_block(zeros, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), dynamic_keymap_buffer_length(offset, sizeof(zeros), DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE));
     }
+#ifdef DYNAMIC_KEYMAP_MACRO_INDEX
+    dynamic_keymap_macro_offsets_valid = false;
+#endif
 }
 
+// Sequential reader over the macro buffer, refilled one chunk at a time.
+typedef struct {
+    uint16_t offset;
+    uint8_t  pos;
+    uint8_t  len;
+    uint8_t  data[DYNAMIC_KEYMAP_MACRO_CHUNK_SIZE];
+} dynamic_keymap_macro_reader_t;
+
+static void dynamic_keymap_macro_reader_init(dynamic_keymap_macro_reader_t *reader, uint16_t offset) {
+    reader->offset = offset;
+    reader->pos    = 0;
+    reader->len    = 0;
+}
+
+// Returns false once the end of the macro buffer has been reached.
+static bool dynamic_keymap_macro_reader_fill(dynamic_keymap_macro_reader_t *reader) {
+    if (reader->pos < reader->len) {
+        return true;
+    }
+    reader->pos = 0;
+    reader->len = dynamic_keymap_buffer_length(reader->offset, sizeof(reader->data), DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    if (reader->len == 0) {
+        return false;
+    }
+    eeprom_read_block(reader->data, (const void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + reader->offset), reader->len);
+    reader->offset += reader->len;
+    return true;
+}
+
+// Reads past the end of the buffer return 0, i.e. a terminator.
+static uint8_t dynamic_keymap_macro_reader_next(dynamic_keymap_macro_reader_t *reader) {
+    if (!dynamic_keymap_macro_reader_fill(reader)) {
+        return 0;
+    }
+    return reader->data[reader->pos++];
+}
+
+// Returns the offset of macro `id`, or DYNAMIC_KEYMAP_MACRO_NOT_FOUND if the
+// buffer holds fewer than `id` null terminators.
+static uint16_t dynamic_keymap_macro_find(uint8_t id) {
+#ifdef DYNAMIC_KEYMAP_MACRO_INDEX
+    if (!dynamic_keymap_macro_offsets_valid) {
+        dynamic_keymap_macro_reader_t reader;
+        dynamic_keymap_macro_reader_init(&reader, 0);
+        uint8_t  count  = 0;
+        uint16_t offset = 0;
+        dynamic_keymap_macro_offsets[count++] = 0;
+        while (count < DYNAMIC_KEYMAP_MACRO_COUNT && dynamic_keymap_macro_reader_fill(&reader)) {
+            ++offset;
+            if (reader.data[reader.pos++] == 0) {
+                dynamic_keymap_macro_offsets[count++] = offset;
+            }
+        }
+        while (count < DYNAMIC_KEYMAP_MACRO_COUNT) {
+            dynamic_keymap_macro_offsets[count++] = DYNAMIC_KEYMAP_MACRO_NOT_FOUND;
+        }
+        dynamic_keymap_macro_offsets_valid = true;
+    }
+    return dynamic_keymap_macro_offsets[id];
+#else
+    dynamic_keymap_macro_reader_t reader;
+    dynamic_keymap_macro_reader_init(&reader, 0);
+    uint16_t offset = 0;
+    while (id > 0) {
+        // If we are past the end of the buffer, then the buffer
+        // contents are garbage, i.e. there were not DYNAMIC_KEYMAP_MACRO_COUNT
+        // nulls in the buffer.
+        if (!dynamic_keymap_macro_reader_fill(&reader)) {
+            return DYNAMIC_KEYMAP_MACRO_NOT_FOUND;
+        }
+        ++offset;
+        if (reader.data[reader.pos++] == 0) {
+            --id;
+        }
+    }
+    return offset;
+#endif
+}
+
+#ifdef VIAL_ENABLE
 static uint16_t decode_keycode(uint16_t kc) {
     /* map 0xFF01 => 0x0100; 0xFF02 => 0x0200, etc */
     if (kc > 0xFF00)
         return (kc & 0xFF) << 8;
     return kc;
 }
+#endif
 
 void dynamic_keymap_macro_send(uint8_t id) {
     if (id >= DYNAMIC_KEYMAP_MACRO_COUNT) {
@@ -466,36 +623,46 @@ void dynamic_keymap_macro_send(uint8_t id) {
     // If it's not zero, then we are in the middle
     // of buffer writing, possibly an aborted buffer
     // write. So do nothing.
-    void *p = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - 1);
+    void *p = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - 1);
     if (eeprom_read_byte(p) != 0) {
         return;
     }
 
-    // Skip N null characters
-    // p will then point to the Nth macro
-    p         = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (id > 0) {
-        // If we are past the end of the buffer, then the buffer
-        // contents are garbage, i.e. there were not DYNAMIC_KEYMAP_MACRO_COUNT
-        // nulls in the buffer.
-        if (p == end) {
-            return;
-        }
-        if (eeprom_read_byte(p) == 0) {
-            --id;
-        }
-        ++p;
+    uint16_t offset = dynamic_keymap_macro_find(id);
+    if (offset == DYNAMIC_KEYMAP_MACRO_NOT_FOUND) {
+        return;
     }
 
-    // Send the macro string one or three chars at a time
-    // by making temporary 1 or 3 char strings
-    char data[4] = {0, 0, 0, 0};
+    dynamic_keymap_macro_reader_t reader;
+    dynamic_keymap_macro_reader_init(&reader, offset);
+
+    // Runs of plain characters are collected and sent with a single
+    // send_string_with_delay() call; magic sequences are sent by
+    // making temporary 1 or 3 char strings
+    char    text[DYNAMIC_KEYMAP_MACRO_CHUNK_SIZE + 1];
+    uint8_t text_len = 0;
+    char    data[4]  = {0, 0, 0, 0};
     // We already checked there was a null at the end of
     // the buffer, so this cannot go past the end
     while (1) {
-        data[0] = eeprom_read_byte(p++);
+        data[0] = dynamic_keymap_macro_reader_next(&reader);
         data[1] = 0;
+        if (data[0] != 0 && data[0] != SS_QMK_PREFIX) {
+            // If the char wasn't magic, queue it up to be sent
+            text[text_len++] = data[0];
+            if (text_len < DYNAMIC_KEYMAP_MACRO_CHUNK_SIZE) {
+                continue;
+            }
+        }
+        if (text_len > 0) {
+            text[text_len] = 0;
+#ifdef SENDSTRING_ASYNC
+            send_string_async_with_delay(text, DYNAMIC_KEYMAP_MACRO_DELAY);
+#else
+            send_string_with_delay(text, DYNAMIC_KEYMAP_MACRO_DELAY);
+#endif
+            text_len = 0;
+        }
         // Stop at the null terminator of this macro string
         if (data[0] == 0) {
             break;
@@ -503,22 +670,32 @@ void dynamic_keymap_macro_send(uint8_t id) {
         if (data[0] == SS_QMK_PREFIX) {
             // If the char is magic, process it as indicated by the next character
             // (tap, down, up, delay)
-            data[1] = eeprom_read_byte(p++);
+            data[1] = dynamic_keymap_macro_reader_next(&reader);
             if (data[1] == 0)
                 break;
             if (data[1] == SS_TAP_CODE || data[1] == SS_DOWN_CODE || data[1] == SS_UP_CODE) {
                 // For tap, down, up, just stuff it into the array and send_string it
-                data[2] = eeprom_read_byte(p++);
-                if (data[2] != 0)
+                data[2] = dynamic_keymap_macro_reader_next(&reader);
+                if (data[2] != 0) {
+#ifdef SENDSTRING_ASYNC
+                    send_string_async(data);
+#else
                     send_string(data);
+#endif
+                }
+#ifdef VIAL_ENABLE
             } else if (data[1] == VIAL_MACRO_EXT_TAP || data[1] == VIAL_MACRO_EXT_DOWN || data[1] == VIAL_MACRO_EXT_UP) {
-                data[2] = eeprom_read_byte(p++);
+                data[2] = dynamic_keymap_macro_reader_next(&reader);
                 if (data[2] != 0) {
-                    data[3] = eeprom_read_byte(p++);
+                    data[3] = dynamic_keymap_macro_reader_next(&reader);
                     if (data[3] != 0) {
                         uint16_t kc;
                         memcpy(&kc, &data[2], sizeof(kc));
                         kc = decode_keycode(kc);
+#ifdef SENDSTRING_ASYNC
+                        // These are typed directly, so they have to wait for the text before them
+                        send_string_async_flush();
+#endif
                         switch (data[1]) {
                         case VIAL_MACRO_EXT_TAP:
                             vial_keycode_tap(kc);
@@ -532,19 +709,21 @@ void dynamic_keymap_macro_send(uint8_t id) {
                         }
                     }
                 }
+#endif
             } else if (data[1] == SS_DELAY_CODE) {
                 // For delay, decode the delay and wait_ms for that amount
-                uint8_t d0 = eeprom_read_byte(p++);
-                uint8_t d1 = eeprom_read_byte(p++);
+                uint8_t d0 = dynamic_keymap_macro_reader_next(&reader);
+                uint8_t d1 = dynamic_keymap_macro_reader_next(&reader);
                 if (d0 == 0 || d1 == 0)
                     break;
                 // we cannot use 0 for these, need to subtract 1 and use 255 instead of 256 for delay calculation
                 int ms = (d0 - 1) + (d1 - 1) * 255;
+#ifdef SENDSTRING_ASYNC
+                send_string_async_delay(ms);
+#else
                 while (ms--) wait_ms(1);
+#endif
             }
-        } else {
-            // If the char wasn't magic, just send it
-            send_string_with_delay(data, DYNAMIC_KEYMAP_MACRO_DELAY);
         }
     }
 }
@@ -113,6 +113,16 @@ void eeconfig_disable(void) {
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
 }
 
+/** \brief eeconfig flush
+ *
+ * Writes any data held back by the EEPROM driver, such as wear-leveling write-back, to persistent storage.
+ */
+void eeconfig_flush(void) {
+#if defined(EEPROM_DRIVER)
+    eeprom_driver_flush();
+#endif
+}
+
 /** \brief eeconfig is enabled
  *
  * FIXME: needs doc
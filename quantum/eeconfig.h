@@ -91,6 +91,7 @@ bool eeconfig_is_enabled(void);
 bool eeconfig_is_disabled(void);
 
 void eeconfig_init(void);
+void eeconfig_flush(void);
 void eeconfig_init_quantum(void);
 void eeconfig_init_kb(void);
 void eeconfig_init_user(void);
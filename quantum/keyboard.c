@@ -104,6 +104,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
+#if defined(SEND_STRING_ENABLE) && defined(SENDSTRING_ASYNC)
+#    include "send_string.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
@@ -200,6 +206,8 @@ void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timesta
 static uint32_t matrix_timer           = 0;
 static uint32_t matrix_scan_count      = 0;
 static uint32_t last_matrix_scan_count = 0;
+static uint32_t matrix_row_count       = 0;
+static uint32_t last_matrix_row_count  = 0;
 
 void matrix_scan_perf_task(void) {
     matrix_scan_count++;
@@ -207,21 +215,52 @@ void matrix_scan_perf_task(void) {
     uint32_t timer_now = timer_read32();
     if (TIMER_DIFF_32(timer_now, matrix_timer) >= 1000) {
 #    if defined(CONSOLE_ENABLE)
-        dprintf("matrix scan frequency: %lu\n", matrix_scan_count);
+        dprintf("matrix scan frequency: %lu (rows compared: %lu)\n", matrix_scan_count, matrix_row_count);
 #    endif
         last_matrix_scan_count = matrix_scan_count;
+        last_matrix_row_count  = matrix_row_count;
         matrix_timer           = timer_now;
         matrix_scan_count      = 0;
+        matrix_row_count       = 0;
     }
 }
 
+#    define matrix_scan_perf_row() matrix_row_count++
+
 uint32_t get_matrix_scan_rate(void) {
     return last_matrix_scan_count;
 }
+
+uint32_t get_matrix_scan_row_rate(void) {
+    return last_matrix_row_count;
+}
 #else
 #    define matrix_scan_perf_task()
+#    define matrix_scan_perf_row()
 #endif
 
+#if (MATRIX_ROWS <= 16)
+#    define matrix_row_mask_ctz(mask) __builtin_ctz(mask)
+#elif (MATRIX_ROWS <= 32)
+#    define matrix_row_mask_ctz(mask) __builtin_ctzl(mask)
+#else
+#    define matrix_row_mask_ctz(mask) __builtin_ctzll(mask)
+#endif
+
+#if (MATRIX_COLS <= 16)
+#    define matrix_row_ctz(row) __builtin_ctz(row)
+#else
+#    define matrix_row_ctz(row) __builtin_ctzl(row)
+#endif
+
+static matrix_row_mask_t matrix_dirty_rows           = 0;
+static bool              matrix_dirty_rows_published = false;
+
+void matrix_mark_dirty_rows(matrix_row_mask_t rows) {
+    matrix_dirty_rows |= rows;
+    matrix_dirty_rows_published = true;
+}
+
 #ifdef MATRIX_HAS_GHOST
 static matrix_row_t get_real_keys(uint8_t row, matrix_row_t rowdata) {
     matrix_row_t out = 0;
@@ -423,6 +462,9 @@ void keyboard_init(void) {
 #ifdef VIA_ENABLE
     via_init();
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_init();
+#endif
 #ifdef SPLIT_KEYBOARD
     split_pre_init();
 #endif
@@ -545,13 +587,27 @@ static bool matrix_task(void) {
         return false;
     }
 
-    static matrix_row_t matrix_previous[MATRIX_ROWS];
+    static matrix_row_t      matrix_previous[MATRIX_ROWS];
+    static matrix_row_mask_t matrix_ghosted_rows = 0;
 
+    matrix_dirty_rows_published = false;
     matrix_scan();
-    bool matrix_changed = false;
-    for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
-        matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
+
+    // Scanners that do not publish dirty rows get every row compared
+    matrix_row_mask_t dirty_rows = matrix_dirty_rows_published ? (matrix_dirty_rows | matrix_ghosted_rows) : matrix_row_mask_range(0, MATRIX_ROWS);
+    matrix_dirty_rows            = 0;
+
+    matrix_row_mask_t changed_rows = 0;
+    for (; dirty_rows; dirty_rows &= dirty_rows - 1) {
+        const uint8_t row = matrix_row_mask_ctz(dirty_rows);
+        if (matrix_previous[row] ^ matrix_get_row(row)) {
+            changed_rows |= (matrix_row_mask_t)1 << row;
+        } else {
+            matrix_ghosted_rows &= ~((matrix_row_mask_t)1 << row);
+        }
+        matrix_scan_perf_row();
     }
+    const bool matrix_changed = changed_rows;
 
     matrix_scan_perf_task();
 
@@ -567,25 +623,28 @@ static bool matrix_task(void) {
 
     const bool process_keypress = should_process_keypress();
 
-    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-        const matrix_row_t current_row = matrix_get_row(row);
-        const matrix_row_t row_changes = current_row ^ matrix_previous[row];
+    for (; changed_rows; changed_rows &= changed_rows - 1) {
+        const uint8_t           row         = matrix_row_mask_ctz(changed_rows);
+        const matrix_row_mask_t row_bit     = (matrix_row_mask_t)1 << row;
+        const matrix_row_t      current_row = matrix_get_row(row);
+        matrix_row_t            row_changes = current_row ^ matrix_previous[row];
 
-        if (!row_changes || has_ghost_in_row(row, current_row)) {
+        // Ghosted rows stay pending so they are revisited on the next scan
+        if (has_ghost_in_row(row, current_row)) {
+            matrix_ghosted_rows |= row_bit;
             continue;
         }
+        matrix_ghosted_rows &= ~row_bit;
 
-        matrix_row_t col_mask = 1;
-        for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
-            if (row_changes & col_mask) {
-                const bool key_pressed = current_row & col_mask;
+        for (; row_changes; row_changes &= row_changes - 1) {
+            const uint8_t col         = matrix_row_ctz(row_changes);
+            const bool    key_pressed = current_row & (MATRIX_ROW_SHIFTER << col);
 
-                if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
-                }
-
-                switch_events(row, col, key_pressed);
+            if (process_keypress) {
+                action_exec(MAKE_KEYEVENT(row, col, key_pressed));
             }
+
+            switch_events(row, col, key_pressed);
         }
 
         matrix_previous[row] = current_row;
@@ -636,10 +695,18 @@ void quantum_task(void) {
     sequencer_task();
 #endif
 
+#if defined(SEND_STRING_ENABLE) && defined(SENDSTRING_ASYNC)
+    send_string_task();
+#endif
+
 #ifdef TAP_DANCE_ENABLE
     tap_dance_task();
 #endif
 
+#ifdef VIAL_TAP_DANCE_ENABLE
+    vial_tap_dance_task();
+#endif
+
 #ifdef COMBO_ENABLE
     combo_task();
 #endif
@@ -757,6 +824,10 @@ void keyboard_task(void) {
 
     led_task();
 
+#ifdef EEPROM_DRIVER
+    eeprom_driver_task();
+#endif
+
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
@@ -340,9 +340,12 @@ uint8_t matrix_scan(void) {
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed);
+    matrix_mark_dirty_rows(changed ? matrix_row_mask_range(thisHand, ROWS_PER_HAND) : 0);
+    changed |= matrix_post_scan();
 #else
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+    matrix_mark_dirty_rows(changed ? matrix_row_mask_range(0, ROWS_PER_HAND) : 0);
     matrix_scan_kb();
 #endif
     return (uint8_t)changed;
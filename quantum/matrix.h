@@ -37,6 +37,20 @@ typedef uint32_t matrix_row_t;
 
 #define MATRIX_ROW_SHIFTER ((matrix_row_t)1)
 
+#if (MATRIX_ROWS <= 8)
+typedef uint8_t matrix_row_mask_t;
+#elif (MATRIX_ROWS <= 16)
+typedef uint16_t matrix_row_mask_t;
+#elif (MATRIX_ROWS <= 32)
+typedef uint32_t matrix_row_mask_t;
+#elif (MATRIX_ROWS <= 64)
+typedef uint64_t matrix_row_mask_t;
+#else
+#    error "MATRIX_ROWS: invalid value"
+#endif
+
+#define MATRIX_ROW_MASK_BITS (sizeof(matrix_row_mask_t) * 8)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -75,6 +89,20 @@ void matrix_scan_kb(void);
 void matrix_init_user(void);
 void matrix_scan_user(void);
 
+/* Mask with `count` consecutive row bits set, starting at `first` */
+static inline matrix_row_mask_t matrix_row_mask_range(uint8_t first, uint8_t count) {
+    matrix_row_mask_t mask = count >= MATRIX_ROW_MASK_BITS ? (matrix_row_mask_t)~(matrix_row_mask_t)0 : (((matrix_row_mask_t)1 << count) - 1);
+    return mask << first;
+}
+
+/* Mark rows whose state may have changed since the last matrix_task.
+ *
+ * Scanners that call this (even with 0) during matrix_scan() let matrix_task
+ * skip every row not marked. Scanners that never call it get all rows
+ * compared, as before. Code that modifies the matrix outside of the scanner
+ * must mark the rows it touched. */
+void matrix_mark_dirty_rows(matrix_row_mask_t rows);
+
 #ifdef SPLIT_KEYBOARD
 bool matrix_post_scan(void);
 void matrix_slave_scan_kb(void);
@@ -95,26 +95,48 @@ void matrix_print(void) {
 bool matrix_post_scan(void) {
     bool changed = false;
     if (is_keyboard_master()) {
-        static bool  last_connected              = false;
-        matrix_row_t slave_matrix[ROWS_PER_HAND] = {0};
+        static bool       last_connected              = false;
+        matrix_row_t      slave_matrix[ROWS_PER_HAND] = {0};
+        matrix_row_mask_t dirty_rows                  = 0;
         if (transport_master_if_connected(matrix + thisHand, slave_matrix)) {
-            changed = memcmp(matrix + thatHand, slave_matrix, sizeof(slave_matrix)) != 0;
+            for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+                if (matrix[thatHand + row] != slave_matrix[row]) {
+                    dirty_rows |= (matrix_row_mask_t)1 << (thatHand + row);
+                }
+            }
+            changed = dirty_rows;
 
             last_connected = true;
         } else if (last_connected) {
             // reset other half when disconnected
             memset(slave_matrix, 0, sizeof(slave_matrix));
-            changed = true;
+            dirty_rows = matrix_row_mask_range(thatHand, ROWS_PER_HAND);
+            changed    = true;
 
             last_connected = false;
         }
 
-        if (changed) memcpy(matrix + thatHand, slave_matrix, sizeof(slave_matrix));
+        if (changed) {
+            memcpy(matrix + thatHand, slave_matrix, sizeof(slave_matrix));
+            matrix_mark_dirty_rows(dirty_rows);
+        }
 
         matrix_scan_kb();
     } else {
+        matrix_row_t master_matrix[ROWS_PER_HAND];
+        memcpy(master_matrix, matrix + thatHand, sizeof(master_matrix));
+
         transport_slave(matrix + thatHand, matrix + thisHand);
 
+        // the master half may be mirrored to the slave for switch_events
+        matrix_row_mask_t dirty_rows = 0;
+        for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+            if (matrix[thatHand + row] != master_matrix[row]) {
+                dirty_rows |= (matrix_row_mask_t)1 << (thatHand + row);
+            }
+        }
+        matrix_mark_dirty_rows(dirty_rows);
+
         matrix_slave_scan_kb();
     }
 
@@ -169,9 +191,12 @@ __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed);
+    matrix_mark_dirty_rows(changed ? matrix_row_mask_range(thisHand, ROWS_PER_HAND) : 0);
+    changed |= matrix_post_scan();
 #else
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+    matrix_mark_dirty_rows(changed ? matrix_row_mask_range(0, ROWS_PER_HAND) : 0);
     matrix_scan_kb();
 #endif
 
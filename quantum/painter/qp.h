@@ -72,6 +72,39 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_INDEX_BUFFER_SIZE
+/**
+ * @def This controls the size of the buffer that palette indices are unpacked into when decoding images and fonts.
+ *      Larger buffers means pixels are handed to the display driver in fewer, larger blocks, at the cost of RAM.
+ */
+#    define QUANTUM_PAINTER_INDEX_BUFFER_SIZE 128
+#endif
+
+#ifndef QUANTUM_PAINTER_TEXT_RUN_MAX_GLYPHS
+/**
+ * @def This controls the maximum number of glyphs that can be laid out in a single text run, see \ref qp_layout_text.
+ *      Each glyph in a text run requires 12 bytes of RAM.
+ */
+#    define QUANTUM_PAINTER_TEXT_RUN_MAX_GLYPHS 16
+#endif
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls the number of glyphs which are kept in the display's native pixel format after being drawn, so
+ *      that text which is redrawn often doesn't need to be decoded again. Each entry requires
+ *      QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE bytes of RAM, plus some metadata. Set to 0 to disable the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 0
+#endif
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE
+/**
+ * @def This controls the maximum size of a glyph in the glyph cache, in bytes of native pixel data. Glyphs which are
+ *      larger are drawn without being cached. The default fits a 16x16 glyph on an RGB565 display.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE 512
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -129,6 +162,26 @@ typedef struct painter_font_desc_t {
  */
 typedef const painter_font_desc_t *painter_font_handle_t;
 
+/**
+ * @typedef A single glyph of a text run.
+ */
+typedef struct painter_text_run_glyph_t {
+    uint32_t code_point;  ///< The glyph's unicode code point
+    uint32_t data_offset; ///< The offset of the glyph's pixel data within the font
+    uint8_t  width;       ///< The glyph's width in pixels
+} painter_text_run_glyph_t;
+
+/**
+ * @typedef A string which has been laid out against a font by \ref qp_layout_text, so that it can be redrawn without
+ *          looking up each glyph again.
+ */
+typedef struct painter_text_run_t {
+    painter_font_handle_t    font;                                        ///< The font the text run was laid out with
+    int16_t                  width;                                       ///< The width of the text run in pixels
+    uint8_t                  glyph_count;                                 ///< The number of glyphs in the text run
+    painter_text_run_glyph_t glyphs[QUANTUM_PAINTER_TEXT_RUN_MAX_GLYPHS]; ///< The glyphs in the text run
+} painter_text_run_t;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API
 
@@ -488,6 +541,47 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
  */
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
 
+/**
+ * Lays out a string against the specified font, for repeated drawing with \ref qp_drawtext_run.
+ *
+ * The text run refers to the font's internal layout, and needs to be laid out again if the font is closed.
+ *
+ * @param run[out] the text run to fill in
+ * @param font[in] the handle of the font
+ * @param str[in] the string to lay out, of at most QUANTUM_PAINTER_TEXT_RUN_MAX_GLYPHS glyphs
+ * @return the width (in pixels) needed to draw the specified string
+ * @return 0 if the string could not be laid out
+ */
+int16_t qp_layout_text(painter_text_run_t *run, painter_font_handle_t font, const char *str);
+
+/**
+ * Draws a text run to the display.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x[in] the x-position where the text should be drawn onto the device
+ * @param y[in] the y-position where the text should be drawn onto the device
+ * @param run[in] the text run to draw, as laid out by \ref qp_layout_text
+ * @return the width (in pixels) used when drawing the text run
+ */
+int16_t qp_drawtext_run(painter_device_t device, uint16_t x, uint16_t y, const painter_text_run_t *run);
+
+/**
+ * Draws a text run to the display, recoloring monochrome fonts to the desired foreground/background.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x[in] the x-position where the text should be drawn onto the device
+ * @param y[in] the y-position where the text should be drawn onto the device
+ * @param run[in] the text run to draw, as laid out by \ref qp_layout_text
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ * @return the width (in pixels) used when drawing the text run
+ */
+int16_t qp_drawtext_run_recolor(painter_device_t device, uint16_t x, uint16_t y, const painter_text_run_t *run, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Drivers
 
@@ -12,6 +12,9 @@
 // Global variable used for native pixel data streaming.
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
 
+// Global variable used for unpacking palette indices.
+extern uint8_t qp_internal_global_index_buffer[QUANTUM_PAINTER_INDEX_BUFFER_SIZE];
+
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
 
@@ -27,9 +30,16 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 // qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
+// A run of input bytes -- either `length` bytes starting at `data`, or if `repeat` is set, `data[0]` repeated `length` times
+typedef struct qp_internal_byte_span_t {
+    const uint8_t* data;
+    uint32_t       length;
+    bool           repeat;
+} qp_internal_byte_span_t;
+
 // Convert from input pixel data + palette to equivalent pixels
-typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
-typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
+typedef bool (*qp_internal_byte_input_callback)(void* cb_arg, uint32_t max_bytes, qp_internal_byte_span_t* span);
+typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t* indices, uint32_t count, void* cb_arg);
 typedef bool (*qp_internal_byte_output_callback)(uint8_t byte, void* cb_arg);
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_pixel_output_callback output_callback, void* output_arg);
@@ -63,10 +73,13 @@ enum qp_internal_rle_mode_t {
     NON_REPEATING_RUN,
 };
 
+// Size of the buffer used to read from streams which can't be read in place
+#define QP_INTERNAL_INPUT_SCRATCH_SIZE 16
+
 typedef struct qp_internal_byte_input_state_t {
     painter_device_t device;
     qp_stream_t*     src_stream;
-    int16_t          curr;
+    uint8_t          scratch[QP_INTERNAL_INPUT_SCRATCH_SIZE];
     union {
         // RLE-specific
         struct {
@@ -82,7 +95,7 @@ typedef struct qp_internal_pixel_output_state_t {
     uint32_t         max_pixels;
 } qp_internal_pixel_output_state_t;
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg);
+bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t* indices, uint32_t count, void* cb_arg);
 
 typedef struct qp_internal_byte_output_state_t {
     painter_device_t device;
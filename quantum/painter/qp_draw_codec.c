@@ -29,23 +29,90 @@ bool qp_internal_bpp_capable(uint8_t bits_per_pixel) {
     return true;
 }
 
+// Unpacks a single input byte into `count` palette indices, least significant bits first
+static inline void qp_internal_unpack_byte(uint8_t* indices, uint8_t byteval, uint8_t bits_per_pixel, uint8_t count) {
+    const uint8_t pixel_bitmask = (1 << bits_per_pixel) - 1;
+    for (uint8_t q = 0; q < count; ++q) {
+        indices[q] = byteval & pixel_bitmask;
+        byteval >>= bits_per_pixel;
+    }
+}
+
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    const uint8_t pixel_bitmask    = (1 << bits_per_pixel) - 1;
     const uint8_t pixels_per_byte  = 8 / bits_per_pixel;
+    uint8_t*      indices          = qp_internal_global_index_buffer;
+    uint32_t      index_count      = 0;
     uint32_t      remaining_pixels = pixel_count; // don't try to derive from byte_count, we may not use an entire byte
+
+    // Each input byte fills the index buffer by pixels_per_byte, and the buffer size is a multiple of 8, so it always
+    // fills up exactly at a byte boundary -- only the final byte of the image may be partially used.
     while (remaining_pixels > 0) {
-        int16_t byteval = input_callback(input_arg);
-        if (byteval < 0) {
+        qp_internal_byte_span_t span;
+        if (!input_callback(input_arg, (remaining_pixels + pixels_per_byte - 1) / pixels_per_byte, &span)) {
             return false;
         }
-        uint8_t loop_pixels = remaining_pixels < pixels_per_byte ? remaining_pixels : pixels_per_byte;
-        for (uint8_t q = 0; q < loop_pixels; ++q) {
-            if (!output_callback(palette, byteval & pixel_bitmask, output_arg)) {
-                return false;
+
+        if (span.repeat) {
+            // Unpack the repeated byte once, then replicate its indices across the run
+            uint8_t  pattern[8];
+            bool     uniform    = true;
+            uint32_t run_pixels = QP_MIN(remaining_pixels, span.length * pixels_per_byte);
+            qp_internal_unpack_byte(pattern, span.data[0], bits_per_pixel, pixels_per_byte);
+            for (uint8_t q = 1; q < pixels_per_byte; ++q) {
+                uniform &= pattern[q] == pattern[0];
+            }
+
+            remaining_pixels -= run_pixels;
+            while (run_pixels > 0) {
+                uint32_t loop_pixels = QP_MIN(run_pixels, QUANTUM_PAINTER_INDEX_BUFFER_SIZE - index_count);
+                if (uniform) {
+                    memset(&indices[index_count], pattern[0], loop_pixels);
+                } else {
+                    for (uint32_t i = 0; i < loop_pixels; ++i) {
+                        indices[index_count + i] = pattern[i & (pixels_per_byte - 1)];
+                    }
+                }
+                index_count += loop_pixels;
+                run_pixels -= loop_pixels;
+
+                if (index_count == QUANTUM_PAINTER_INDEX_BUFFER_SIZE) {
+                    if (!output_callback(palette, indices, index_count, output_arg)) {
+                        return false;
+                    }
+                    index_count = 0;
+                }
+            }
+        } else {
+            const uint8_t* data = span.data;
+            for (uint32_t remaining_bytes = span.length; remaining_bytes > 0;) {
+                uint32_t loop_pixels;
+                if (pixels_per_byte == 1) {
+                    // Indices are the input bytes themselves
+                    loop_pixels = QP_MIN(remaining_bytes, QUANTUM_PAINTER_INDEX_BUFFER_SIZE - index_count);
+                    memcpy(&indices[index_count], data, loop_pixels);
+                    data += loop_pixels;
+                    remaining_bytes -= loop_pixels;
+                } else {
+                    loop_pixels = QP_MIN(remaining_pixels, pixels_per_byte);
+                    qp_internal_unpack_byte(&indices[index_count], *data++, bits_per_pixel, loop_pixels);
+                    remaining_bytes--;
+                }
+                index_count += loop_pixels;
+                remaining_pixels -= loop_pixels;
+
+                if (index_count == QUANTUM_PAINTER_INDEX_BUFFER_SIZE) {
+                    if (!output_callback(palette, indices, index_count, output_arg)) {
+                        return false;
+                    }
+                    index_count = 0;
+                }
             }
-            byteval >>= bits_per_pixel;
         }
-        remaining_pixels -= loop_pixels;
+    }
+
+    // Any leftovers need to be output as well
+    if (index_count > 0) {
+        return output_callback(palette, indices, index_count, output_arg);
     }
     return true;
 }
@@ -69,77 +136,108 @@ bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, u
 bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_output_callback output_callback, void* output_arg) {
     uint32_t remaining_bytes = byte_count;
     while (remaining_bytes > 0) {
-        int16_t byteval = input_callback(input_arg);
-        if (byteval < 0) {
+        qp_internal_byte_span_t span;
+        if (!input_callback(input_arg, remaining_bytes, &span)) {
             return false;
         }
-        if (!output_callback(byteval, output_arg)) {
-            return false;
+        for (uint32_t i = 0; i < span.length; ++i) {
+            if (!output_callback(span.repeat ? span.data[0] : span.data[i], output_arg)) {
+                return false;
+            }
         }
-        remaining_bytes -= 1;
+        remaining_bytes -= span.length;
     }
     return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Progressive pull of bytes, push of pixels
+// Progressive pull of byte runs, push of pixels
+
+// Reads up to max_bytes from the stream -- in place for memory streams, otherwise through the scratch buffer
+static inline bool qp_drawimage_read_span(qp_internal_byte_input_state_t* state, uint32_t max_bytes, qp_internal_byte_span_t* span) {
+    uint32_t       available;
+    const uint8_t* direct = qp_stream_direct(state->src_stream, &available);
+    span->repeat          = false;
+    if (direct) {
+        span->data   = direct;
+        span->length = QP_MIN(max_bytes, available);
+        qp_stream_seek(state->src_stream, span->length, SEEK_CUR);
+    } else {
+        span->data   = state->scratch;
+        span->length = qp_stream_read(state->scratch, 1, QP_MIN(max_bytes, sizeof(state->scratch)), state->src_stream);
+    }
+    return span->length > 0;
+}
 
-static inline int16_t qp_drawimage_byte_uncompressed_decoder(void* cb_arg) {
+static bool qp_drawimage_byte_uncompressed_decoder(void* cb_arg, uint32_t max_bytes, qp_internal_byte_span_t* span) {
     qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
-    state->curr                           = qp_stream_get(state->src_stream);
-    return state->curr;
+    return qp_drawimage_read_span(state, max_bytes, span);
 }
 
-static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
+static bool qp_drawimage_byte_rle_decoder(void* cb_arg, uint32_t max_bytes, qp_internal_byte_span_t* span) {
     qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
 
     // Work out if we're parsing the initial marker byte
     if (state->rle.mode == MARKER_BYTE) {
-        uint8_t c = qp_stream_get(state->src_stream);
+        int16_t c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return false;
+        }
         if (c >= 128) {
             state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
             state->rle.remain = c - 127;
         } else {
             state->rle.mode   = REPEATING_RUN; // repeated run
             state->rle.remain = c;
-        }
 
-        state->curr = qp_stream_get(state->src_stream);
+            // Keep hold of the repeated byte, it's handed out for the rest of the run
+            int16_t r = qp_stream_get(state->src_stream);
+            if (r < 0 || c == 0) {
+                return false;
+            }
+            state->scratch[0] = r;
+        }
     }
 
-    // Work out which byte we're returning
-    uint8_t c = state->curr;
-
-    // Decrement the counter of the bytes remaining
-    state->rle.remain--;
+    // Hand out as much of the current run as was asked for
+    if (state->rle.mode == REPEATING_RUN) {
+        span->data   = state->scratch;
+        span->length = QP_MIN(max_bytes, state->rle.remain);
+        span->repeat = true;
+    } else if (!qp_drawimage_read_span(state, QP_MIN(max_bytes, state->rle.remain), span)) {
+        return false;
+    }
 
-    if (state->rle.remain > 0) {
-        // If we're in a non-repeating run, queue up the next byte
-        if (state->rle.mode == NON_REPEATING_RUN) {
-            state->curr = qp_stream_get(state->src_stream);
-        }
-    } else {
-        // Swap back to querying the marker byte mode
+    // Swap back to querying the marker byte mode once the run is complete
+    state->rle.remain -= span->length;
+    if (state->rle.remain == 0) {
         state->rle.mode = MARKER_BYTE;
     }
 
-    return c;
+    return true;
 }
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
+bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t* indices, uint32_t count, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
 
-    if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos++, 1, &index)) {
-        return false;
-    }
-
-    // If we've hit the transmit limit, send out the entire buffer and reset the write position
-    if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+    while (count > 0) {
+        // Append as many pixels as will fit in the pixdata buffer in one go
+        uint32_t loop_pixels = QP_MIN(count, state->max_pixels - state->pixel_write_pos);
+        if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos, loop_pixels, indices)) {
             return false;
         }
-        state->pixel_write_pos = 0;
+        state->pixel_write_pos += loop_pixels;
+        indices += loop_pixels;
+        count -= loop_pixels;
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->pixel_write_pos == state->max_pixels) {
+            if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+                return false;
+            }
+            state->pixel_write_pos = 0;
+        }
     }
 
     return true;
@@ -8,6 +8,7 @@
 #include "qgf.h"
 
 _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE % 16) == 0, "QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE needs to be a non-zero multiple of 16");
+_Static_assert((QUANTUM_PAINTER_INDEX_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_INDEX_BUFFER_SIZE % 8) == 0, "QUANTUM_PAINTER_INDEX_BUFFER_SIZE needs to be a non-zero multiple of 8");
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Global variables
@@ -22,6 +23,9 @@ _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIX
 // Buffer used for transmitting native pixel data to the downstream device.
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
 
+// Buffer used for unpacking palette indices before they're converted to native pixel data.
+uint8_t qp_internal_global_index_buffer[QUANTUM_PAINTER_INDEX_BUFFER_SIZE];
+
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
 static int16_t                                    generated_steps   = -1;
@@ -21,6 +21,9 @@ typedef struct qff_font_handle_t {
     bool                  has_palette;
     bool                  is_panel_native;
     painter_compression_t compression_scheme;
+    uint32_t              unicode_table_offset; // stream position of the first unicode glyph entry
+    uint32_t              glyph_data_offset;    // stream position of the first byte of glyph data
+    bool                  unicode_table_sorted; // whether the unicode glyph table can be binary searched
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
@@ -36,6 +39,61 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+typedef struct qp_glyph_cache_entry_t {
+    painter_device_t                        device;
+    qff_font_handle_t *                     font; // NULL if the entry is unused
+    uint32_t                                code_point;
+    qp_pixel_t                              fg_hsv888;
+    qp_pixel_t                              bg_hsv888;
+    uint32_t                                last_used;
+    __attribute__((__aligned__(4))) uint8_t pixdata[QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE];
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES];
+static uint32_t               glyph_cache_clock = 0;
+
+static void qp_glyph_cache_invalidate_font(qff_font_handle_t *qff_font) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache[i].font == qff_font) {
+            glyph_cache[i].font      = NULL;
+            glyph_cache[i].last_used = 0;
+        }
+    }
+}
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper: glyph lookup index
+
+// Works out where the glyph tables and glyph data are located, and whether the unicode table can be binary searched
+static void qp_build_font_lookup_index(qff_font_handle_t *font) {
+    font->unicode_table_offset = sizeof(qff_font_descriptor_v1_t)                                   // Skip the font descriptor
+                                 + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
+                                 + sizeof(qgf_block_header_v1_t);                                   // Skip the unicode block header
+    font->glyph_data_offset = sizeof(qff_font_descriptor_v1_t)                                                                                                               // Skip the font descriptor
+                              + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                             // Skip the ascii table
+                              + (font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                              + (font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                   // Skip the palette
+                              + sizeof(qgf_block_header_v1_t);                                                                                                               // Skip the data block header
+
+    // The QMK CLI writes the unicode table in code point order, but check rather than assume
+    font->unicode_table_sorted = qp_stream_setpos(&font->stream, font->unicode_table_offset) >= 0;
+    uint32_t last_code_point   = 0;
+    for (uint16_t i = 0; i < font->num_unicode_glyphs && font->unicode_table_sorted; ++i) {
+        qff_unicode_glyph_v1_t glyph_info;
+        if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &font->stream) != 1 || (i > 0 && glyph_info.code_point <= last_code_point)) {
+            qp_dprintf("qp_load_font: unicode glyph table is not sorted, falling back to linear search\n");
+            font->unicode_table_sorted = false;
+            break;
+        }
+        last_code_point = glyph_info.code_point;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -106,6 +164,8 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+    qp_build_font_lookup_index(font);
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -151,6 +211,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Drop any cached glyphs, the slot may be reused for a different font
+    qp_glyph_cache_invalidate_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -161,7 +226,7 @@ bool qp_close_font(painter_font_handle_t font) {
 // Helpers
 
 // Callback to be invoked for each codepoint detected in the UTF8 input string
-typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
+typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint32_t data_offset, uint8_t height, void *cb_arg);
 
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
@@ -214,7 +279,64 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
-static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+// Reads the unicode glyph table entry at the specified index
+static inline bool qp_read_unicode_glyph_info(qff_font_handle_t *qff_font, uint16_t index, qff_unicode_glyph_v1_t *glyph_info) {
+    if (qp_stream_setpos(&qff_font->stream, qff_font->unicode_table_offset + index * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+        qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+        return false;
+    }
+
+    if (qp_stream_read(glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+        qp_dprintf("Failed to read unicode glyph info\n");
+        return false;
+    }
+
+    return true;
+}
+
+// Finds the unicode glyph table entry for the specified code point, returning its packed width/offset value
+static inline bool qp_find_unicode_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t *glyph_value) {
+    qff_unicode_glyph_v1_t glyph_info;
+
+    if (qff_font->unicode_table_sorted) {
+        // Binary search the table in place
+        uint16_t lower = 0;
+        uint16_t upper = qff_font->num_unicode_glyphs;
+        while (lower < upper) {
+            uint16_t middle = lower + (upper - lower) / 2;
+            if (!qp_read_unicode_glyph_info(qff_font, middle, &glyph_info)) {
+                return false;
+            }
+
+            if (glyph_info.code_point == code_point) {
+                *glyph_value = glyph_info.value;
+                return true;
+            } else if (glyph_info.code_point < code_point) {
+                lower = middle + 1;
+            } else {
+                upper = middle;
+            }
+        }
+        return false;
+    }
+
+    // Unsorted table, check every entry
+    for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+        if (!qp_read_unicode_glyph_info(qff_font, i, &glyph_info)) {
+            return false;
+        }
+
+        if (glyph_info.code_point == code_point) {
+            *glyph_value = glyph_info.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Looks up the width of the glyph for the specified code point, and the stream position of its pixel data
+static inline bool qp_lookup_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width, uint32_t *data_offset) {
+    uint32_t glyph_value;
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
@@ -231,65 +353,16 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
-        return true;
-    } else {
+        glyph_value = glyph_info.value;
+    } else if (!qp_find_unicode_glyph(qff_font, code_point, &glyph_value)) {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
-
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
-
-        qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
-            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
-                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
-                return false;
-            }
-
-            if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
-                return true;
-            }
-        }
-
-        // Not found
         qp_dprintf("Failed to find unicode glyph info\n");
         return false;
     }
-    return false;
+
+    *width       = (uint8_t)(glyph_value & QFF_GLYPH_WIDTH_MASK);
+    *data_offset = qff_font->glyph_data_offset + ((glyph_value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+    return true;
 }
 
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
@@ -302,13 +375,26 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
             return false;
         }
 
-        uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        uint8_t  width;
+        uint32_t data_offset;
+        if (!qp_lookup_glyph(qff_font, code_point, &width, &data_offset)) {
             qp_dprintf("Failed to prepare glyph for rendering.\n");
             return false;
         }
 
-        if (!handler(qff_font, code_point, width, qff_font->base.line_height, cb_arg)) {
+        if (!handler(qff_font, code_point, width, data_offset, qff_font->base.line_height, cb_arg)) {
+            qp_dprintf("Failed to execute glyph handler.\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+// Function to iterate over each glyph of a text run, invoking the callback for each
+static inline bool qp_iterate_text_run(qff_font_handle_t *qff_font, const painter_text_run_t *run, code_point_handler handler, void *cb_arg) {
+    for (uint8_t i = 0; i < run->glyph_count; ++i) {
+        const painter_text_run_glyph_t *glyph = &run->glyphs[i];
+        if (!handler(qff_font, glyph->code_point, glyph->width, glyph->data_offset, qff_font->base.line_height, cb_arg)) {
             qp_dprintf("Failed to execute glyph handler.\n");
             return false;
         }
@@ -325,7 +411,7 @@ typedef struct code_point_iter_calcwidth_state_t {
 } code_point_iter_calcwidth_state_t;
 
 // Codepoint handler callback: width calc
-static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint32_t data_offset, uint8_t height, void *cb_arg) {
     code_point_iter_calcwidth_state_t *state = (code_point_iter_calcwidth_state_t *)cb_arg;
 
     // Increment the overall width by this glyph's width
@@ -334,6 +420,27 @@ static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_f
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Text run layout
+
+// Codepoint handler callback: layout
+static inline bool qp_font_code_point_handler_layout(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint32_t data_offset, uint8_t height, void *cb_arg) {
+    painter_text_run_t *run = (painter_text_run_t *)cb_arg;
+    if (run->glyph_count >= QUANTUM_PAINTER_TEXT_RUN_MAX_GLYPHS) {
+        qp_dprintf("qp_layout_text: fail (more than %d glyphs)\n", (int)QUANTUM_PAINTER_TEXT_RUN_MAX_GLYPHS);
+        return false;
+    }
+
+    // Record the glyph, and increment the overall width by its width
+    painter_text_run_glyph_t *glyph = &run->glyphs[run->glyph_count++];
+    glyph->code_point               = code_point;
+    glyph->data_offset              = data_offset;
+    glyph->width                    = width;
+    run->width += width;
+
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // String drawing implementation
 
@@ -342,62 +449,110 @@ typedef struct code_point_iter_drawglyph_state_t {
     painter_device_t                  device;
     int16_t                           xpos;
     int16_t                           ypos;
+    qp_pixel_t                        fg_hsv888;
+    qp_pixel_t                        bg_hsv888;
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
 } code_point_iter_drawglyph_state_t;
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+typedef struct qp_glyph_cache_output_state_t {
+    painter_device_t device;
+    uint8_t *        pixdata;
+    uint32_t         pixel_write_pos;
+} qp_glyph_cache_output_state_t;
+
+// Pixel output callback which decodes into a glyph cache entry rather than the global pixdata buffer
+static bool qp_glyph_cache_appender(qp_pixel_t *palette, uint8_t *indices, uint32_t count, void *cb_arg) {
+    qp_glyph_cache_output_state_t *state  = (qp_glyph_cache_output_state_t *)cb_arg;
+    painter_driver_t *             driver = (painter_driver_t *)state->device;
+    if (!driver->driver_vtable->append_pixels(state->device, state->pixdata, palette, state->pixel_write_pos, count, indices)) {
+        return false;
+    }
+    state->pixel_write_pos += count;
+    return true;
+}
+
+// Returns the glyph cache entry for the glyph, decoding it into the least recently used entry if it isn't already cached.
+// Returns NULL if the glyph can't be cached.
+static qp_glyph_cache_entry_t *qp_glyph_cache_get(code_point_iter_drawglyph_state_t *state, qff_font_handle_t *qff_font, uint32_t code_point, uint32_t data_offset, uint32_t pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)state->device;
+    if (qff_font->bpp > 8 || (pixel_count * driver->native_bits_per_pixel + 7) / 8 > QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE) {
+        return NULL;
+    }
+
+    qp_glyph_cache_entry_t *victim = &glyph_cache[0];
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->font == qff_font && entry->code_point == code_point && entry->device == state->device && memcmp(&entry->fg_hsv888.hsv888, &state->fg_hsv888.hsv888, sizeof(entry->fg_hsv888.hsv888)) == 0 && memcmp(&entry->bg_hsv888.hsv888, &state->bg_hsv888.hsv888, sizeof(entry->bg_hsv888.hsv888)) == 0) {
+            entry->last_used = ++glyph_cache_clock;
+            return entry;
+        }
+        if (entry->last_used < victim->last_used) {
+            victim = entry;
+        }
+    }
+
+    // Not cached, decode the glyph into the least recently used entry -- the palette has already been set up for this draw
+    victim->font      = NULL;
+    victim->last_used = 0;
+    if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+        return NULL;
+    }
+    state->input_state->rle.mode               = MARKER_BYTE; // ignored if not using RLE
+    qp_glyph_cache_output_state_t output_state = {.device = state->device, .pixdata = victim->pixdata, .pixel_write_pos = 0};
+    if (!qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_glyph_cache_appender, &output_state)) {
+        return NULL;
+    }
+
+    victim->device     = state->device;
+    victim->font       = qff_font;
+    victim->code_point = code_point;
+    victim->fg_hsv888  = state->fg_hsv888;
+    victim->bg_hsv888  = state->bg_hsv888;
+    victim->last_used  = ++glyph_cache_clock;
+    return victim;
+}
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
 // Codepoint handler callback: drawing
-static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint32_t data_offset, uint8_t height, void *cb_arg) {
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
     painter_driver_t *                 driver = (painter_driver_t *)state->device;
 
-    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
-    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
-
-    // Reset the output state
-    state->output_state->pixel_write_pos = 0;
-
     // Configure where we're going to be rendering to
     driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
 
     // Move the x-position for the next glyph
     state->xpos += width;
 
-    // Decode the pixel data for the glyph, and stream it
     uint32_t pixel_count = ((uint32_t)width) * height;
-    return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
-}
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Quantum Painter External API: qp_textwidth
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Send the native pixel data straight from the glyph cache, if possible
+    qp_glyph_cache_entry_t *entry = qp_glyph_cache_get(state, qff_font, code_point, data_offset, pixel_count);
+    if (entry) {
+        return driver->driver_vtable->pixdata(state->device, entry->pixdata, pixel_count);
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
 
-int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
-    qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
-    if (!qff_font || !qff_font->validate_ok) {
-        qp_dprintf("qp_textwidth: fail (invalid font)\n");
+    // Position the stream at the glyph's data, and reset the input state's RLE mode
+    if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
         return false;
     }
+    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
 
-    // Create the codepoint iterator state
-    code_point_iter_calcwidth_state_t state = {.width = 0};
-    // Iterate each codepoint, return the calculated width if successful.
-    return qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
-}
-
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Quantum Painter External API: qp_drawtext
+    // Reset the output state
+    state->output_state->pixel_write_pos = 0;
 
-int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str) {
-    // Offload to the recolor variant, substituting fg=white bg=black.
-    // Traditional LCDs with those colors will need to manually invoke qp_drawtext_recolor with the colors reversed.
-    return qp_drawtext_recolor(device, x, y, font, str, 0, 0, 255, 0, 0, 0);
+    // Decode the pixel data for the glyph, and stream it
+    return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Quantum Painter External API: qp_drawtext_recolor
-
-int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+// Draws either a string or a text run, whichever is supplied
+static int16_t qp_drawtext_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, qff_font_handle_t *qff_font, const char *str, const painter_text_run_t *run, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
     qp_dprintf("qp_drawtext_recolor: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
@@ -405,7 +560,6 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
         return 0;
     }
 
-    qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
     if (!qff_font || !qff_font->validate_ok) {
         qp_dprintf("qp_drawtext_recolor: fail (invalid font)\n");
         return false;
@@ -430,28 +584,100 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 
     // Set up the codepoint iteration state
     code_point_iter_drawglyph_state_t state = {// Common
-                                               .device = device,
-                                               .xpos   = x,
-                                               .ypos   = y,
+                                               .device    = device,
+                                               .xpos      = x,
+                                               .ypos      = y,
+                                               .fg_hsv888 = fg_hsv888,
+                                               .bg_hsv888 = bg_hsv888,
                                                // Input
                                                .input_callback = input_callback,
                                                .input_state    = &input_state,
                                                // Output
                                                .output_state = &output_state};
 
-    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
+    uint32_t data_offset;
     if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
         qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
         qp_comms_stop(device);
         return false;
     }
 
-    // Iterate the codepoints with the drawglyph callback
-    bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
+    // Iterate the codepoints or text run glyphs with the drawglyph callback
+    bool ret = run ? qp_iterate_text_run(qff_font, run, qp_font_code_point_handler_drawglyph, &state) : qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
 
     qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret ? (state.xpos - x) : 0;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_textwidth
+
+int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
+    qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
+    if (!qff_font || !qff_font->validate_ok) {
+        qp_dprintf("qp_textwidth: fail (invalid font)\n");
+        return false;
+    }
+
+    // Create the codepoint iterator state
+    code_point_iter_calcwidth_state_t state = {.width = 0};
+    // Iterate each codepoint, return the calculated width if successful.
+    return qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext
+
+int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str) {
+    // Offload to the recolor variant, substituting fg=white bg=black.
+    // Traditional LCDs with those colors will need to manually invoke qp_drawtext_recolor with the colors reversed.
+    return qp_drawtext_recolor(device, x, y, font, str, 0, 0, 255, 0, 0, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext_recolor
+
+int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    return qp_drawtext_recolor_impl(device, x, y, (qff_font_handle_t *)font, str, NULL, fg_hsv888, bg_hsv888);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_layout_text
+
+int16_t qp_layout_text(painter_text_run_t *run, painter_font_handle_t font, const char *str) {
+    qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
+    if (!qff_font || !qff_font->validate_ok) {
+        qp_dprintf("qp_layout_text: fail (invalid font)\n");
+        return 0;
+    }
+
+    run->font        = font;
+    run->width       = 0;
+    run->glyph_count = 0;
+    if (!qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_layout, run)) {
+        run->width       = 0;
+        run->glyph_count = 0;
+        return 0;
+    }
+    return run->width;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext_run
+
+int16_t qp_drawtext_run(painter_device_t device, uint16_t x, uint16_t y, const painter_text_run_t *run) {
+    // Offload to the recolor variant, substituting fg=white bg=black.
+    return qp_drawtext_run_recolor(device, x, y, run, 0, 0, 255, 0, 0, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext_run_recolor
+
+int16_t qp_drawtext_run_recolor(painter_device_t device, uint16_t x, uint16_t y, const painter_text_run_t *run, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    return qp_drawtext_recolor_impl(device, x, y, (qff_font_handle_t *)run->font, NULL, run, fg_hsv888, bg_hsv888);
+}
@@ -109,6 +109,15 @@ static inline void mem_close(qp_stream_t *stream) {
     // No-op.
 }
 
+const uint8_t *qp_stream_direct(qp_stream_t *stream, uint32_t *available) {
+    if (stream->get != mem_get) {
+        return NULL;
+    }
+    qp_memory_stream_t *s = (qp_memory_stream_t *)stream;
+    *available            = s->position < s->length ? s->length - s->position : 0;
+    return &s->buffer[s->position];
+}
+
 qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length) {
     qp_memory_stream_t stream = {
         .base     = {.get = mem_get, .put = mem_put, .seek = mem_seek, .tell = mem_tell, .is_eof = mem_is_eof, .close = mem_close},
@@ -41,6 +41,10 @@ typedef struct qp_stream_t qp_stream_t;
 uint32_t qp_stream_read_impl(void *output_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream);
 uint32_t qp_stream_write_impl(const void *input_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream);
 
+// Returns a pointer to the data at the current position for streams which can be read in place, such as memory streams,
+// with `available` set to the number of bytes that can be read from it. Returns NULL for all other streams.
+const uint8_t *qp_stream_direct(qp_stream_t *stream, uint32_t *available);
+
 #define qp_stream_close(stream_ptr) (((qp_stream_t *)(stream_ptr))->close((qp_stream_t *)(stream_ptr)))
 
 #define STREAM_EOF ((int16_t)(-1))
@@ -117,6 +117,97 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_KEYCODE_INDEX
+#    ifndef COMBO_KEYCODE_INDEX_SIZE
+#        ifdef VIAL_COMBO_ENABLE
+#            define COMBO_KEYCODE_INDEX_SIZE (VIAL_COMBO_ENTRIES * 4)
+#        else
+#            define COMBO_KEYCODE_INDEX_SIZE 256
+#        endif
+#    endif
+
+/* keycode -> combo lookup table, sorted by keycode then combo index */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_index_entry_t;
+static combo_index_entry_t combo_index[COMBO_KEYCODE_INDEX_SIZE];
+static uint16_t            combo_index_size = 0;
+
+enum { COMBO_INDEX_STALE, COMBO_INDEX_READY, COMBO_INDEX_OVERFLOW };
+static uint8_t combo_index_state = COMBO_INDEX_STALE;
+
+#    ifndef COMBO_TOUCHED_LENGTH
+#        define COMBO_TOUCHED_LENGTH 16
+#    endif
+
+/* combos that may hold state, so clear_combos() doesn't have to visit every combo */
+static uint16_t combo_touched[COMBO_TOUCHED_LENGTH];
+static uint8_t  combo_touched_count    = 0;
+static bool     combo_touched_overflow = false;
+
+static inline void combo_touch(uint16_t combo_index) {
+    for (uint8_t i = 0; i < combo_touched_count; ++i) {
+        if (combo_touched[i] == combo_index) return;
+    }
+    if (combo_touched_count < COMBO_TOUCHED_LENGTH) {
+        combo_touched[combo_touched_count++] = combo_index;
+    } else {
+        combo_touched_overflow = true;
+    }
+}
+
+void combo_index_build(void) {
+    combo_index_size       = 0;
+    combo_index_state      = COMBO_INDEX_READY;
+    combo_touched_count    = 0;
+    combo_touched_overflow = true;
+
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+        for (uint8_t i = 0; (key = pgm_read_word(&keys[i])) != COMBO_END; ++i) {
+            /* skip keys listed twice in the same combo */
+            uint8_t j = 0;
+            while (j < i && pgm_read_word(&keys[j]) != key) ++j;
+            if (j < i) continue;
+
+            if (combo_index_size == COMBO_KEYCODE_INDEX_SIZE) {
+                /* too many combo keys, fall back to scanning every combo */
+                combo_index_state = COMBO_INDEX_OVERFLOW;
+                return;
+            }
+
+            /* insertion sort, combos are visited in order so equal keycodes stay sorted by index */
+            uint16_t pos = combo_index_size++;
+            while (pos > 0 && combo_index[pos - 1].keycode > key) {
+                combo_index[pos] = combo_index[pos - 1];
+                --pos;
+            }
+            combo_index[pos] = (combo_index_entry_t){.keycode = key, .combo_index = idx};
+        }
+    }
+}
+
+void combo_index_invalidate(void) {
+    combo_index_state = COMBO_INDEX_STALE;
+}
+
+/* returns the position of the first entry for keycode, or combo_index_size */
+static uint16_t combo_index_find(uint16_t keycode) {
+    uint16_t lo = 0, hi = combo_index_size;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (combo_index[mid].keycode < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+#endif
+
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
 #    define COMBO_ACTIVE(combo) (combo->active)
@@ -217,11 +308,34 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_KEYCODE_INDEX
+    if (combo_index_state == COMBO_INDEX_READY && !combo_touched_overflow) {
+        uint8_t kept = 0;
+        for (uint8_t i = 0; i < combo_touched_count; ++i) {
+            combo_t *combo = combo_get(combo_touched[i]);
+            if (!COMBO_ACTIVE(combo)) {
+                RESET_COMBO_STATE(combo);
+            } else {
+                /* still held, has to be reset once released */
+                combo_touched[kept++] = combo_touched[i];
+            }
+        }
+        combo_touched_count = kept;
+        return;
+    }
+    combo_touched_count    = 0;
+    combo_touched_overflow = false;
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
             RESET_COMBO_STATE(combo);
         }
+#ifdef COMBO_KEYCODE_INDEX
+        else {
+            combo_touch(index);
+        }
+#endif
     }
 }
 
@@ -279,7 +393,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -408,9 +521,12 @@ combo_t *overlaps(combo_t *combo1, combo_t *combo2) {
             idx2 += 1;
         }
         idx1 += 1;
+        if (overlaps) break;
     }
 
     if (!overlaps) return NULL;
+    /* only the key counts are needed from here on */
+    while (pgm_read_word(&combo1->keys[idx1]) != COMBO_END) idx1 += 1;
     if (idx2 < idx1) return combo2;
     return combo1;
 }
@@ -558,8 +674,7 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
 }
 
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    bool is_combo_key          = false;
-    bool no_combo_keys_pressed = true;
+    bool is_combo_key = false;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -587,10 +702,24 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEYCODE_INDEX
+    if (combo_index_state == COMBO_INDEX_STALE) {
+        combo_index_build();
+    }
+    if (combo_index_state == COMBO_INDEX_READY) {
+        /* combos that don't contain keycode are left untouched by process_single_combo, skip them */
+        for (uint16_t pos = combo_index_find(keycode); pos < combo_index_size && combo_index[pos].keycode == keycode; ++pos) {
+            uint16_t idx = combo_index[pos].combo_index;
+            combo_touch(idx);
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -74,6 +74,12 @@ typedef struct combo_t {
 #define KEYCODE_IS_MOD(code) (IS_MODIFIER_KEYCODE(code) || (IS_QK_MODS(code) && !QK_MODS_GET_BASIC_KEYCODE(code)))
 
 bool process_combo(uint16_t keycode, keyrecord_t *record);
+#ifdef COMBO_KEYCODE_INDEX
+/* rebuild the keycode -> combo lookup table, call after changing the keys of any combo */
+void combo_index_build(void);
+/* mark the lookup table out of date, it is rebuilt when next needed */
+void combo_index_invalidate(void);
+#endif
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
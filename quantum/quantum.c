@@ -199,6 +199,7 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+    eeconfig_flush();
 }
 
 void reset_keyboard(void) {
@@ -265,6 +266,14 @@ bool process_record_quantum(keyrecord_t *record) {
     uint16_t keycode = get_record_keycode(record, true);
     return process_record_quantum_helper(keycode, record);
 }
+/* Handlers in the process_record chain either observe every record, or
+ * only act on their own keycode range and return true for anything else.
+ * The latter are skipped without being called when the keycode is outside
+ * their range. The ranges are constants, so the whole dispatch is resolved
+ * per enabled feature at compile time and the chain order is unchanged. */
+#define PROCESS_ANY_KEY(handler) handler(keycode, record)
+#define PROCESS_KEYCODE_RANGE(handler, first, last) ((uint16_t)(keycode - (first)) > (uint16_t)((last) - (first)) || handler(keycode, record))
+
 /* Core keycode function, hands off handling to other functions,
     then processes internal quantum keycodes, and then processes
     ACTIONs.                                                      */
@@ -283,6 +292,13 @@ bool process_record_quantum_helper(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
+#ifdef VIAL_TAP_DANCE_ENABLE
+    // Keep the queued tap dance releases ahead of the keys that follow them
+    if (!IS_QK_TAP_DANCE(keycode) && record->event.key.row != VIAL_MATRIX_MAGIC) {
+        vial_tap_dance_flush();
+    }
+#endif
+
 #ifdef TAP_DANCE_ENABLE
     if (preprocess_tap_dance(keycode, record)) {
         // The tap dance might have updated the layer state, therefore the
@@ -310,92 +326,96 @@ bool process_record_quantum_helper(uint16_t keycode, keyrecord_t *record) {
 #endif
 #if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
             // Must run asap to ensure all keypresses are recorded.
-            process_dynamic_macro(keycode, record) &&
+            PROCESS_ANY_KEY(process_dynamic_macro) &&
 #endif
 #ifdef REPEAT_KEY_ENABLE
-            process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
+            PROCESS_ANY_KEY(process_last_key) && PROCESS_ANY_KEY(process_repeat_key) &&
 #endif
 #if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
+            PROCESS_ANY_KEY(process_clicky) &&
 #endif
 #ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
+            PROCESS_ANY_KEY(process_haptic) &&
 #endif
 #if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_record_via, QK_MACRO, QK_MACRO_MAX) &&
 #endif
 #if defined(VIAL_ENABLE)
-            process_record_vial(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_record_vial, QK_TAP_DANCE, QK_TAP_DANCE_MAX) &&
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
+            PROCESS_ANY_KEY(process_auto_mouse) &&
 #endif
-            process_record_kb(keycode, record) &&
+            PROCESS_ANY_KEY(process_record_kb) &&
 #if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_secure, QK_SECURE_LOCK, QK_SECURE_REQUEST) &&
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_sequencer, QK_SEQUENCER, QK_SEQUENCER_MAX) &&
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_midi, QK_MIDI, QK_MIDI_MAX) &&
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_audio, QK_AUDIO, QK_AUDIO_MAX) &&
 #endif
 #if defined(BACKLIGHT_ENABLE) || defined(LED_MATRIX_ENABLE)
-            process_backlight(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_backlight, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_steno, QK_STENO, QK_STENO_MAX) &&
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
+            PROCESS_ANY_KEY(process_music) &&
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+            PROCESS_ANY_KEY(process_caps_word) &&
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+            PROCESS_ANY_KEY(process_key_override) &&
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+            PROCESS_ANY_KEY(process_tap_dance) &&
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
+#    if defined(UCIS_ENABLE)
+            PROCESS_ANY_KEY(process_unicode_common) &&
+#    else
+            PROCESS_KEYCODE_RANGE(process_unicode_common, QK_UNICODE_MODE_NEXT, QK_UNICODE_MAX) &&
+#    endif
 #endif
 #ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
+            PROCESS_ANY_KEY(process_leader) &&
 #endif
 #ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
+            PROCESS_ANY_KEY(process_auto_shift) &&
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_dynamic_tapping_term, QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN) &&
 #endif
 #ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
+            PROCESS_ANY_KEY(process_space_cadet) &&
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_magic, QK_MAGIC, QK_MAGIC_MAX) &&
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_grave_esc, QK_GRAVE_ESCAPE, QK_GRAVE_ESCAPE) &&
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_rgb(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_rgb, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_joystick, QK_JOYSTICK, QK_JOYSTICK_MAX) &&
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_programmable_button, QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX) &&
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+            PROCESS_ANY_KEY(process_autocorrect) &&
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+            PROCESS_KEYCODE_RANGE(process_tri_layer, QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER) &&
 #endif
             true)) {
         return false;
@@ -514,6 +534,7 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 
 void suspend_power_down_quantum(void) {
     suspend_power_down_kb();
+    eeconfig_flush();
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
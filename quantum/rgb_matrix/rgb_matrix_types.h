@@ -16,6 +16,10 @@
 
 #pragma once
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
 #include "color.h"
@@ -73,6 +77,16 @@ typedef struct PACKED {
     uint8_t     flags[RGB_MATRIX_LED_COUNT];
 } led_config_t;
 
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+// Position of each LED relative to k_rgb_matrix_center, derived once from g_led_config.
+typedef struct {
+    int16_t dx[RGB_MATRIX_LED_COUNT];
+    int16_t dy[RGB_MATRIX_LED_COUNT];
+    uint8_t dist[RGB_MATRIX_LED_COUNT];  // sqrt16(dx * dx + dy * dy)
+    uint8_t angle[RGB_MATRIX_LED_COUNT]; // atan2_8(dy, dx)
+} led_geometry_t;
+#endif
+
 typedef union {
     uint64_t raw;
     struct PACKED {
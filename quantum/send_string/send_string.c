@@ -24,6 +24,15 @@
 #include "action.h"
 #include "wait.h"
 
+#ifdef SENDSTRING_ASYNC
+#    include "action_util.h"
+#    include "host.h"
+#    include "timer.h"
+#    ifdef UNICODE_COMMON_ENABLE
+#        include "unicode.h"
+#    endif
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -146,11 +155,296 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
+#ifdef SENDSTRING_ASYNC
+#    ifndef SENDSTRING_ASYNC_BUFFER_SIZE
+#        define SENDSTRING_ASYNC_BUFFER_SIZE 128
+#    endif
+_Static_assert(SENDSTRING_ASYNC_BUFFER_SIZE >= 8 && SENDSTRING_ASYNC_BUFFER_SIZE <= 32767, "SENDSTRING_ASYNC_BUFFER_SIZE must be between 8 and 32767");
+
+/* Without a delay, key changes go out once per USB frame, or as fast as the
+ * endpoint takes them. */
+#    ifdef SENDSTRING_ASYNC_MAX_SPEED
+#        define SS_ASYNC_FRAME_MS 0
+#    else
+#        define SS_ASYNC_FRAME_MS 1
+#    endif
+
+/* The queue holds the same codes as a string, except that delays are stored
+ * as a little endian 16-bit duration instead of digits, and two more codes
+ * are only ever added internally. */
+#    define SS_ASYNC_INTERVAL_CODE 0x10 // followed by the interval of the strings after it
+#    define SS_ASYNC_UNICODE_CODE 0x11  // followed by a little endian 32-bit code point
+
+static struct {
+    uint8_t  buffer[SENDSTRING_ASYNC_BUFFER_SIZE];
+    uint16_t head;
+    uint16_t count;
+    uint8_t  interval;
+    uint8_t  mods;        // weak modifiers held across consecutive characters
+    uint8_t  release_key; // key to release on the next step
+    bool     tap_space;   // the last character was a dead key
+    bool     in_step;
+    uint16_t last_step;
+    uint16_t wait;
+} ss_async;
+
+static uint8_t ss_async_peek(uint16_t offset) {
+    return ss_async.buffer[(ss_async.head + offset) % SENDSTRING_ASYNC_BUFFER_SIZE];
+}
+
+static void ss_async_pop(uint16_t length) {
+    ss_async.head = (ss_async.head + length) % SENDSTRING_ASYNC_BUFFER_SIZE;
+    ss_async.count -= length;
+}
+
+static void ss_async_release_mods(uint8_t mods) {
+    del_weak_mods(mods);
+    ss_async.mods &= ~mods;
+    send_keyboard_report();
+}
+
+/* Makes the next change to the keyboard report, returning false if there was nothing left to do. */
+static bool ss_async_run_step(void) {
+    // A key pressed by the user clears the weak modifiers, so they apply to the typed characters alone
+    ss_async.mods &= get_weak_mods();
+
+    if (ss_async.release_key) {
+        unregister_code(ss_async.release_key);
+        ss_async.release_key = 0;
+        return true;
+    }
+
+    if (ss_async.tap_space) {
+        if (ss_async.mods) {
+            ss_async_release_mods(ss_async.mods);
+            return true;
+        }
+        register_code(KC_SPACE);
+        ss_async.release_key = KC_SPACE;
+        ss_async.tap_space   = false;
+        return true;
+    }
+
+    while (ss_async.count) {
+        uint8_t ascii_code = ss_async_peek(0);
+        if (ascii_code != SS_QMK_PREFIX) {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+            if (ascii_code == '\a') { // BEL
+                ss_async_pop(1);
+                PLAY_SONG(bell_song);
+                continue;
+            }
+#    endif
+            uint8_t keycode = ascii_code < 128 ? pgm_read_byte(&ascii_to_keycode_lut[ascii_code]) : KC_NO;
+            uint8_t mods    = 0;
+            if (keycode != KC_NO) {
+                mods = (PGM_LOADBIT(ascii_to_shift_lut, ascii_code) ? MOD_BIT(KC_LEFT_SHIFT) : 0) | (PGM_LOADBIT(ascii_to_altgr_lut, ascii_code) ? MOD_BIT(KC_RIGHT_ALT) : 0);
+            }
+
+            // Modifiers the character does not want are released in a report of their own
+            if (ss_async.mods & ~mods) {
+                ss_async_release_mods(ss_async.mods & ~mods);
+                return true;
+            }
+            ss_async_pop(1);
+            if (keycode == KC_NO) {
+                continue;
+            }
+
+            // While new modifiers go out in the same report as the key, and stay held for the next character
+            add_weak_mods(mods & ~ss_async.mods);
+            ss_async.mods = mods;
+            register_code(keycode);
+            ss_async.release_key = keycode;
+            ss_async.tap_space   = PGM_LOADBIT(ascii_to_dead_lut, ascii_code);
+            return true;
+        }
+
+        uint8_t code = ss_async_peek(1);
+        if (code == SS_ASYNC_INTERVAL_CODE) {
+            ss_async.interval = ss_async_peek(2);
+            ss_async_pop(3);
+            continue;
+        }
+
+        if (ss_async.mods) {
+            ss_async_release_mods(ss_async.mods);
+            return true;
+        }
+
+        switch (code) {
+            case SS_TAP_CODE:
+                register_code(ss_async_peek(2));
+                ss_async.release_key = ss_async_peek(2);
+                ss_async_pop(3);
+                break;
+            case SS_DOWN_CODE:
+                register_code(ss_async_peek(2));
+                ss_async_pop(3);
+                break;
+            case SS_UP_CODE:
+                unregister_code(ss_async_peek(2));
+                ss_async_pop(3);
+                break;
+            case SS_DELAY_CODE:
+                ss_async.wait = ss_async_peek(2) | (ss_async_peek(3) << 8);
+                ss_async_pop(4);
+                break;
+            case SS_ASYNC_UNICODE_CODE: {
+                uint32_t code_point = ss_async_peek(2) | ((uint32_t)ss_async_peek(3) << 8) | ((uint32_t)ss_async_peek(4) << 16) | ((uint32_t)ss_async_peek(5) << 24);
+                ss_async_pop(6);
+#    ifdef UNICODE_COMMON_ENABLE
+                register_unicode(code_point);
+#    else
+                (void)code_point;
+#    endif
+                break;
+            }
+        }
+        return true;
+    }
+
+    if (ss_async.mods) {
+        ss_async_release_mods(ss_async.mods);
+        return true;
+    }
+    return false;
+}
+
+static bool ss_async_step(void) {
+    ss_async.in_step = true;
+    ss_async.wait    = 0;
+    bool stepped     = ss_async_run_step();
+    ss_async.in_step = false;
+
+    ss_async.wait += ss_async.interval ? ss_async.interval : SS_ASYNC_FRAME_MS;
+    ss_async.last_step = timer_read();
+    return stepped;
+}
+
+/* Blocks until the next step is due, then runs it. */
+static bool ss_async_wait_step(void) {
+    uint16_t elapsed = timer_elapsed(ss_async.last_step);
+    if (elapsed < ss_async.wait) {
+        wait_ms(ss_async.wait - elapsed);
+    }
+    return ss_async_step();
+}
+
+static void ss_async_push(const uint8_t *entry, uint8_t length) {
+    // Type out the front of the queue until the entry fits
+    while (SENDSTRING_ASYNC_BUFFER_SIZE - ss_async.count < length) {
+        ss_async_wait_step();
+    }
+    for (uint8_t i = 0; i < length; i++) {
+        ss_async.buffer[(ss_async.head + ss_async.count++) % SENDSTRING_ASYNC_BUFFER_SIZE] = entry[i];
+    }
+}
+
+static char ss_async_read(const char *string, bool progmem) {
+    return progmem ? pgm_read_byte(string) : *string;
+}
+
+static void ss_async_enqueue(const char *string, uint8_t interval, bool progmem) {
+    uint8_t entry[4] = {SS_QMK_PREFIX, SS_ASYNC_INTERVAL_CODE, interval};
+    ss_async_push(entry, 3);
+
+    while (1) {
+        char ascii_code = ss_async_read(string, progmem);
+        if (!ascii_code) break;
+        if (ascii_code == SS_QMK_PREFIX) {
+            uint8_t code = ss_async_read(++string, progmem);
+            if (code == SS_TAP_CODE || code == SS_DOWN_CODE || code == SS_UP_CODE) {
+                entry[1] = code;
+                entry[2] = ss_async_read(++string, progmem);
+                if (!entry[2]) break;
+                ss_async_push(entry, 3);
+            } else if (code == SS_DELAY_CODE) {
+                uint16_t ms    = 0;
+                char     digit = ss_async_read(++string, progmem);
+                while (isdigit(digit)) {
+                    ms *= 10;
+                    ms += digit - '0';
+                    digit = ss_async_read(++string, progmem);
+                }
+                entry[1] = SS_DELAY_CODE;
+                entry[2] = ms & 0xFF;
+                entry[3] = ms >> 8;
+                ss_async_push(entry, 4);
+                if (!digit) break;
+            } else if (!code) {
+                break;
+            }
+        } else {
+            ss_async_push((const uint8_t *)&ascii_code, 1);
+        }
+        ++string;
+    }
+}
+
+void send_string_async(const char *string) {
+    send_string_async_with_delay(string, TAP_CODE_DELAY);
+}
+
+void send_string_async_with_delay(const char *string, uint8_t interval) {
+    ss_async_enqueue(string, interval, false);
+}
+
+#    if defined(__AVR__)
+void send_string_async_with_delay_P(const char *string, uint8_t interval) {
+    ss_async_enqueue(string, interval, true);
+}
+#    endif
+
+void send_unicode_async(uint32_t code_point) {
+    uint8_t entry[6] = {SS_QMK_PREFIX, SS_ASYNC_UNICODE_CODE, code_point & 0xFF, (code_point >> 8) & 0xFF, (code_point >> 16) & 0xFF, code_point >> 24};
+    ss_async_push(entry, sizeof(entry));
+}
+
+void send_string_async_delay(uint16_t ms) {
+    uint8_t entry[4] = {SS_QMK_PREFIX, SS_DELAY_CODE, ms & 0xFF, ms >> 8};
+    ss_async_push(entry, sizeof(entry));
+}
+
+bool send_string_async_busy(void) {
+    return ss_async.count || ss_async.release_key || ss_async.tap_space || ss_async.mods;
+}
+
+void send_string_async_flush(void) {
+    while (send_string_async_busy()) {
+        ss_async_wait_step();
+    }
+}
+
+void send_string_task(void) {
+    if (!send_string_async_busy() || timer_elapsed(ss_async.last_step) < ss_async.wait) {
+        return;
+    }
+#    ifdef SENDSTRING_ASYNC_MAX_SPEED
+    if (!host_keyboard_ready()) {
+        return;
+    }
+#    endif
+    ss_async_step();
+}
+
+/* Anything typed synchronously has to come after what is already queued, except
+ * for what the queue itself types, such as the digits of a Unicode code point. */
+static void ss_async_finish(void) {
+    if (!ss_async.in_step) {
+        send_string_async_flush();
+    }
+}
+#endif
+
 void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
 
 void send_string_with_delay(const char *string, uint8_t interval) {
+#ifdef SENDSTRING_ASYNC
+    ss_async_finish();
+#endif
     while (1) {
         char ascii_code = *string;
         if (!ascii_code) break;
@@ -197,6 +491,9 @@ void send_char(char ascii_code) {
 }
 
 void send_char_with_delay(char ascii_code, uint8_t interval) {
+#ifdef SENDSTRING_ASYNC
+    ss_async_finish();
+#endif
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
     if (ascii_code == '\a') { // BEL
         PLAY_SONG(bell_song);
@@ -298,6 +595,9 @@ void send_string_P(const char *string) {
 }
 
 void send_string_with_delay_P(const char *string, uint8_t interval) {
+#    ifdef SENDSTRING_ASYNC
+    ss_async_finish();
+#    endif
     while (1) {
         char ascii_code = pgm_read_byte(string);
         if (!ascii_code) break;
@@ -23,6 +23,7 @@
  * \{
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "progmem.h"
@@ -161,4 +162,74 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 #define SEND_STRING_DELAY(string, interval) send_string_with_delay_P(PSTR(string), interval)
 
+#if defined(SENDSTRING_ASYNC) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a string of ASCII characters to be typed out by send_string_task(), without blocking.
+ *
+ * This function simply calls `send_string_async_with_delay(string, TAP_CODE_DELAY)`.
+ *
+ * \param string The string to type out. It is copied, so it does not need to outlive the call.
+ */
+void send_string_async(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out by send_string_task(), with a delay between each key change.
+ *
+ * Only one change to the keyboard report is made per millisecond, or per `interval` if it is longer. If the queue is
+ * full, this function types out as much of the queue as needed to make room for the string.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait in between key changes.
+ */
+void send_string_async_with_delay(const char *string, uint8_t interval);
+
+/**
+ * \brief Queue a Unicode code point to be typed out by send_string_task() with register_unicode().
+ *
+ * \param code_point The code point to type.
+ */
+void send_unicode_async(uint32_t code_point);
+
+/**
+ * \brief Queue a pause in typing, as SS_DELAY() does within a string.
+ *
+ * \param ms The amount of time, in milliseconds, to pause for.
+ */
+void send_string_async_delay(uint16_t ms);
+
+/**
+ * \brief Type out everything still queued, blocking until done.
+ */
+void send_string_async_flush(void);
+
+/**
+ * \brief Whether anything queued has not been typed out yet.
+ */
+bool send_string_async_busy(void);
+
+/**
+ * \brief Type out the next key change of the queued strings, if it is due. Called from the main loop.
+ */
+void send_string_task(void);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out by send_string_task(), with a delay between each key change.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async_with_delay(string, interval).
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait in between key changes.
+ */
+void send_string_async_with_delay_P(const char *string, uint8_t interval);
+#    else
+#        define send_string_async_with_delay_P(string, interval) send_string_async_with_delay(string, interval)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), 0).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_async_with_delay_P(PSTR(string), 0)
+#endif
+
 /** \} */
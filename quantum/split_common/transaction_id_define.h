@@ -118,6 +118,11 @@ enum serial_transaction_id {
     PUT_DETECTED_OS,
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    EXCHANGE_BATCH,
+    POLL_BATCH,
+#endif // SPLIT_TRANSPORT_BATCH
+
     NUM_TOTAL_TRANSACTIONS
 };
 
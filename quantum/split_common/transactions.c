@@ -88,6 +88,14 @@
 #define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
 #define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+// Shared state is staged and goes out with the next batched exchange
+static bool batch_put(int8_t trans_id, const void *source, size_t length);
+#    define transport_put(id, data, length) batch_put(id, data, length)
+#else
+#    define transport_put(id, data, length) transport_write(id, data, length)
+#endif // SPLIT_TRANSPORT_BATCH
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
 void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
@@ -162,7 +170,7 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
     if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
+        okay &= transport_put(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
         }
@@ -178,6 +186,7 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifndef SPLIT_TRANSPORT_BATCH
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -192,6 +201,7 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
     memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
     return okay;
 }
+#endif // SPLIT_TRANSPORT_BATCH
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
@@ -199,7 +209,12 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#ifdef SPLIT_TRANSPORT_BATCH
+// The slave matrix rides along with the batched exchange
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER()
+#else
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#endif // SPLIT_TRANSPORT_BATCH
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
@@ -302,7 +317,7 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
     bool okay = true;
     if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
+        okay &= transport_put(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
         if (okay) {
             last_update = timer_read32();
         }
@@ -423,7 +438,7 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
 
     bool okay = true;
     if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
+        okay &= transport_put(PUT_MODS, &new_mods, sizeof(new_mods));
         if (okay) {
             last_update = timer_read32();
         }
@@ -719,7 +734,7 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi && last_cpi != temp_cpi) {
         split_shmem->pointing.cpi = temp_cpi;
-        okay                      = transport_write(PUT_POINTING_CPI, &split_shmem->pointing.cpi, sizeof(split_shmem->pointing.cpi));
+        okay                      = transport_put(PUT_POINTING_CPI, &split_shmem->pointing.cpi, sizeof(split_shmem->pointing.cpi));
         if (okay) {
             last_cpi = temp_cpi;
         }
@@ -908,6 +923,198 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Batched exchange
+
+#ifdef SPLIT_TRANSPORT_BATCH
+
+#    if defined(__AVR__) && !defined(USE_I2C)
+#        error "SPLIT_TRANSPORT_BATCH requires the slave to receive the master's buffer before responding, which the AVR bitbang serial driver does not do"
+#    endif
+
+_Static_assert(SPLIT_TRANSPORT_BATCH_SIZE > SPLIT_BATCH_M2S_HEADER_SIZE && SPLIT_TRANSPORT_BATCH_SIZE <= UINT8_MAX, "SPLIT_TRANSPORT_BATCH_SIZE must fit the frame header and a one byte length");
+_Static_assert(SPLIT_BATCH_S2M_SIZE <= UINT8_MAX, "Slave matrix too large for a batched frame");
+
+#    define BATCH_FLAG_RESYNC 0x01
+
+static uint32_t batch_pending = 0;
+
+static bool batch_put(int8_t trans_id, const void *source, size_t length) {
+    split_transaction_desc_t *trans = &split_transaction_table[trans_id];
+    // State which could never fit in a frame goes out in its own transaction instead
+    if (trans->initiator2target_buffer_size > SPLIT_TRANSPORT_BATCH_SIZE - SPLIT_BATCH_M2S_HEADER_SIZE) {
+        return transport_write(trans_id, source, length);
+    }
+
+    void *slot = split_trans_initiator2target_buffer(trans);
+    if (source != slot) {
+        memcpy(slot, source, length < trans->initiator2target_buffer_size ? length : trans->initiator2target_buffer_size);
+    }
+    batch_pending |= (uint32_t)1 << trans_id;
+    return true;
+}
+
+/**
+ * @brief Packs every pending transaction into a master to slave frame, using
+ * the transaction table for the size and shared memory location of each one.
+ * Transactions which don't fit stay pending for the next frame.
+ *
+ * @return The length of the frame, or 0 if there is nothing to send.
+ */
+static uint8_t batch_pack(uint8_t *frame, uint32_t *sent, bool resync) {
+    uint8_t *data = frame + SPLIT_BATCH_M2S_HEADER_SIZE;
+    uint8_t *end  = frame + SPLIT_TRANSPORT_BATCH_SIZE;
+
+    *sent = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (!(batch_pending & ((uint32_t)1 << id)) || data + trans->initiator2target_buffer_size > end) {
+            continue;
+        }
+        memcpy(data, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        data += trans->initiator2target_buffer_size;
+        *sent |= (uint32_t)1 << id;
+    }
+
+    if (!*sent && !resync) {
+        return 0;
+    }
+    frame[0] = *sent ? data - frame : 2;
+    frame[1] = resync ? BATCH_FLAG_RESYNC : 0;
+    memcpy(&frame[2], sent, sizeof(*sent));
+    return frame[0];
+}
+
+/**
+ * @brief Applies the row deltas in a slave to master frame, and checks that
+ * the result matches the slave's matrix.
+ */
+static bool batch_unpack_matrix(const uint8_t *response, matrix_row_t matrix[]) {
+    if (response[0] == 1) {
+        return true;
+    }
+
+    const uint8_t *mask = &response[2];
+    const uint8_t *data = &response[SPLIT_BATCH_S2M_HEADER_SIZE];
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; ++row) {
+        if (mask[row / 8] & (1 << (row % 8))) {
+            memcpy(&matrix[row], data, sizeof(matrix_row_t));
+            data += sizeof(matrix_row_t);
+        }
+    }
+    return response[0] == data - response && response[1] == crc8(matrix, sizeof(matrix_row_t) * ((MATRIX_ROWS) / 2));
+}
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t     last_update                    = 0;
+    static bool         resync                         = true;
+    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, which the row deltas apply to
+    matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
+    uint8_t             frame[SPLIT_TRANSPORT_BATCH_SIZE];
+    uint8_t             response[SPLIT_BATCH_S2M_SIZE];
+    uint32_t            sent;
+
+    bool    full   = resync || timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
+    uint8_t length = batch_pack(frame, &sent, full);
+    bool    okay;
+    if (length) {
+        okay = transport_execute_transaction(EXCHANGE_BATCH, frame, length, response, sizeof(response));
+    } else {
+        // Nothing for the slave, the transaction ID alone is enough to ask for its changes
+        okay = transport_read(POLL_BATCH, response, sizeof(response));
+    }
+    if (okay) {
+        batch_pending &= ~sent;
+        memcpy(temp_matrix, last_matrix, sizeof(temp_matrix));
+        okay = batch_unpack_matrix(response, temp_matrix);
+    }
+    if (okay) {
+        memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+        if (full) {
+            last_update = timer_read32();
+        }
+    }
+    // A lost or corrupt frame leaves us out of step with the slave's deltas, so ask for the full matrix next time
+    resync = !okay;
+
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return okay;
+}
+
+/**
+ * @brief Fills in a slave to master frame with the rows which changed since
+ * the last one, or all of them if the master lost track.
+ */
+static void batch_pack_matrix(uint8_t *response, bool resync) {
+    static matrix_row_t last_sent[(MATRIX_ROWS) / 2] = {0};
+    uint8_t            *mask                         = &response[2];
+    uint8_t            *data                         = &response[SPLIT_BATCH_S2M_HEADER_SIZE];
+
+    memset(mask, 0, SPLIT_BATCH_ROW_MASK_SIZE);
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; ++row) {
+        if (resync || split_shmem->smatrix.matrix[row] != last_sent[row]) {
+            mask[row / 8] |= 1 << (row % 8);
+            memcpy(data, &split_shmem->smatrix.matrix[row], sizeof(matrix_row_t));
+            data += sizeof(matrix_row_t);
+            last_sent[row] = split_shmem->smatrix.matrix[row];
+        }
+    }
+    response[0] = data == &response[SPLIT_BATCH_S2M_HEADER_SIZE] ? 1 : data - response;
+    response[1] = split_shmem->smatrix.checksum;
+}
+
+static void batch_handlers_slave_exchange(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const uint8_t *frame  = initiator2target_buffer;
+    bool           resync = true;
+
+    if (frame[0] >= 2 && frame[0] <= initiator2target_buffer_size) {
+        resync = frame[1] & BATCH_FLAG_RESYNC;
+    }
+    if (frame[0] >= SPLIT_BATCH_M2S_HEADER_SIZE && frame[0] <= initiator2target_buffer_size) {
+        uint32_t changed;
+        memcpy(&changed, &frame[2], sizeof(changed));
+
+        // Unpack each flagged transaction into its usual shared memory location, as if it had been sent on its own
+        const uint8_t *data = frame + SPLIT_BATCH_M2S_HEADER_SIZE;
+        const uint8_t *end  = frame + frame[0];
+        for (int8_t id = 0; changed && id < NUM_TOTAL_TRANSACTIONS; ++id, changed >>= 1) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            if (!(changed & 1)) {
+                continue;
+            }
+            if (data + trans->initiator2target_buffer_size > end) {
+                break;
+            }
+            memcpy(split_trans_initiator2target_buffer(trans), data, trans->initiator2target_buffer_size);
+            data += trans->initiator2target_buffer_size;
+            if (trans->slave_callback) {
+                trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+            }
+        }
+    }
+
+    batch_pack_matrix(target2initiator_buffer, resync);
+}
+
+static void batch_handlers_slave_poll(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    batch_pack_matrix(target2initiator_buffer, false);
+}
+
+// clang-format off
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS \
+    [EXCHANGE_BATCH] = { sizeof_member(split_shared_memory_t, batch.m2s), offsetof(split_shared_memory_t, batch.m2s), sizeof_member(split_shared_memory_t, batch.s2m), offsetof(split_shared_memory_t, batch.s2m), batch_handlers_slave_exchange }, \
+    [POLL_BATCH]     = trans_target2initiator_initializer_cb(batch.s2m, batch_handlers_slave_poll),
+// clang-format on
+
+#else // SPLIT_TRANSPORT_BATCH
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_BATCH
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -938,6 +1145,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -968,6 +1176,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BATCH_MASTER();
     return true;
 }
 
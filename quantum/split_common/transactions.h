@@ -41,6 +41,13 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 #define split_trans_initiator2target_buffer(trans) (split_shmem_offset_ptr((trans)->initiator2target_offset))
 #define split_trans_target2initiator_buffer(trans) (split_shmem_offset_ptr((trans)->target2initiator_offset))
 
+#ifdef SPLIT_TRANSPORT_BATCH
+// Batched frames carry their used length in the first byte, transports only need to put that many bytes on the wire
+#    define split_trans_is_framed(id) ((id) == EXCHANGE_BATCH || (id) == POLL_BATCH)
+#else
+#    define split_trans_is_framed(id) false
+#endif // SPLIT_TRANSPORT_BATCH
+
 // returns false if valid data not received from slave
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
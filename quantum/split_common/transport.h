@@ -146,6 +146,26 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+#    ifndef SPLIT_TRANSPORT_BATCH_SIZE
+#        define SPLIT_TRANSPORT_BATCH_SIZE 64
+#    endif // SPLIT_TRANSPORT_BATCH_SIZE
+
+// Master to slave: length, flags, change bits, then the payload of each flagged transaction in ID order.
+// Frames with only flags to send stop after them, with nothing at all to send the master polls instead.
+#    define SPLIT_BATCH_M2S_HEADER_SIZE (2 + sizeof(uint32_t))
+// Slave to master: length, matrix checksum, row change bits, then each flagged row.
+// Frames with no changed rows stop after the length.
+#    define SPLIT_BATCH_ROW_MASK_SIZE ((((MATRIX_ROWS) / 2) + 7) / 8)
+#    define SPLIT_BATCH_S2M_HEADER_SIZE (2 + SPLIT_BATCH_ROW_MASK_SIZE)
+#    define SPLIT_BATCH_S2M_SIZE (SPLIT_BATCH_S2M_HEADER_SIZE + sizeof(matrix_row_t) * ((MATRIX_ROWS) / 2))
+
+typedef struct _split_batch_sync_t {
+    uint8_t m2s[SPLIT_TRANSPORT_BATCH_SIZE];
+    uint8_t s2m[SPLIT_BATCH_S2M_SIZE];
+} split_batch_sync_t;
+#endif // SPLIT_TRANSPORT_BATCH
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
@@ -230,6 +250,10 @@ typedef struct _split_shared_memory_t {
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
     os_variant_t detected_os;
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
+
+#ifdef SPLIT_TRANSPORT_BATCH
+    split_batch_sync_t batch;
+#endif // SPLIT_TRANSPORT_BATCH
 } split_shared_memory_t;
 
 extern split_shared_memory_t *const split_shmem;
@@ -380,6 +380,10 @@ void send_unicode_string(const char *str) {
     if (!str) {
         return;
     }
+#ifdef SENDSTRING_ASYNC
+    // Typed after anything already queued, as send_string() is
+    send_string_async_flush();
+#endif
 
     while (*str) {
         int32_t code_point = 0;
@@ -390,3 +394,20 @@ void send_unicode_string(const char *str) {
         }
     }
 }
+
+#ifdef SENDSTRING_ASYNC
+void send_unicode_string_async(const char *str) {
+    if (!str) {
+        return;
+    }
+
+    while (*str) {
+        int32_t code_point = 0;
+        str                = decode_utf8(str, &code_point);
+
+        if (code_point >= 0) {
+            send_unicode_async(code_point);
+        }
+    }
+}
+#endif
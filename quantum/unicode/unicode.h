@@ -131,4 +131,11 @@ void register_unicode(uint32_t code_point);
  */
 void send_unicode_string(const char *str);
 
+/**
+ * \brief Queue a string containing Unicode characters to be typed out from the main loop. Requires SENDSTRING_ASYNC.
+ *
+ * \param str The string to send. It is decoded when queued, so it does not need to outlive the call.
+ */
+void send_unicode_string_async(const char *str);
+
 /** \} */
@@ -48,17 +48,27 @@ _Static_assert(sizeof(vial_unlock_combo_rows) == sizeof(vial_unlock_combo_cols),
 
 #ifdef VIAL_TAP_DANCE_ENABLE
 static void reload_tap_dance(void);
+static void reload_tap_dance_entry(uint8_t index);
 #endif
 
 #ifdef VIAL_COMBO_ENABLE
 static void reload_combo(void);
+static void reload_combo_entry(uint8_t index);
 #endif
 
 #ifdef VIAL_KEY_OVERRIDE_ENABLE
 static void reload_key_override(void);
+static void reload_key_override_entry(uint8_t index);
 #endif
 
+/* set while the host uploads a batch of entries, so work over all entries is done once on commit */
+static bool vial_batch_in_progress = false;
+
 void vial_init(void) {
+    vial_reload();
+}
+
+void vial_reload(void) {
 #ifdef VIAL_TAP_DANCE_ENABLE
     reload_tap_dance();
 #endif
@@ -243,7 +253,7 @@ void vial_handle_cmd(uint8_t *msg, uint8_t length) {
                 td.on_double_tap = vial_keycode_firewall(td.on_double_tap);
                 td.on_tap_hold = vial_keycode_firewall(td.on_tap_hold);
                 msg[0] = dynamic_keymap_set_tap_dance(idx, &td);
-                reload_tap_dance();
+                reload_tap_dance_entry(idx);
                 break;
             }
 #endif
@@ -261,7 +271,14 @@ void vial_handle_cmd(uint8_t *msg, uint8_t length) {
                 memcpy(&entry, &msg[4], sizeof(entry));
                 entry.output = vial_keycode_firewall(entry.output);
                 msg[0] = dynamic_keymap_set_combo(idx, &entry);
-                reload_combo();
+                reload_combo_entry(idx);
+#ifdef COMBO_KEYCODE_INDEX
+                /* within a batch, only rebuild if a key is pressed before the commit */
+                if (vial_batch_in_progress)
+                    combo_index_invalidate();
+                else
+                    combo_index_build();
+#endif
                 break;
             }
 #endif
@@ -279,10 +296,23 @@ void vial_handle_cmd(uint8_t *msg, uint8_t length) {
                 memcpy(&entry, &msg[4], sizeof(entry));
                 entry.replacement = vial_keycode_firewall(entry.replacement);
                 msg[0] = dynamic_keymap_set_key_override(idx, &entry);
-                reload_key_override();
+                reload_key_override_entry(idx);
+                break;
+            }
+#endif
+            case dynamic_vial_batch_begin: {
+                vial_batch_in_progress = true;
+                msg[0] = 0;
                 break;
             }
+            case dynamic_vial_batch_commit: {
+                vial_batch_in_progress = false;
+#if defined(VIAL_COMBO_ENABLE) && defined(COMBO_KEYCODE_INDEX)
+                combo_index_build();
 #endif
+                msg[0] = 0;
+                break;
+            }
             }
 
             break;
@@ -339,7 +369,90 @@ enum {
 };
 
 static uint8_t dance_state[VIAL_TAP_DANCE_ENTRIES];
-static vial_tap_dance_entry_t td_entry;
+/* RAM copy of the tap dance entries, only refreshed by reload_tap_dance() and vial_reload() */
+static vial_tap_dance_entry_t td_entries[VIAL_TAP_DANCE_ENTRIES];
+
+/* Key events sent by the tap dances are queued, so that the tap code delay before a release is waited out by
+   vial_tap_dance_task() on the following scans rather than by stalling the scan loop. Anything that needs the events
+   sent in order with other keys drains the queue first, waiting out what remains of the delay. */
+#ifndef VIAL_TAP_DANCE_QUEUE_SIZE
+#    define VIAL_TAP_DANCE_QUEUE_SIZE 8
+#endif
+
+typedef struct {
+    uint16_t keycode;
+    bool     pressed;
+    bool     delayed;
+} td_key_event_t;
+
+static td_key_event_t td_queue[VIAL_TAP_DANCE_QUEUE_SIZE];
+static uint8_t        td_queue_head;
+static uint8_t        td_queue_count;
+static uint16_t       td_queue_timer;
+
+/* Sends the queued events; with defer set, stops at the first release whose delay has not elapsed yet */
+static void td_queue_run(bool defer) {
+    while (td_queue_count > 0) {
+        td_key_event_t ev = td_queue[td_queue_head];
+        if (ev.delayed) {
+            uint16_t elapsed = timer_elapsed(td_queue_timer);
+            if (elapsed < QS_tap_code_delay) {
+                if (defer)
+                    return;
+                qs_wait_ms(QS_tap_code_delay - elapsed);
+            }
+        }
+        td_queue_head = (td_queue_head + 1) % VIAL_TAP_DANCE_QUEUE_SIZE;
+        --td_queue_count;
+        if (ev.pressed)
+            vial_keycode_down(ev.keycode);
+        else
+            vial_keycode_up(ev.keycode);
+        td_queue_timer = timer_read();
+    }
+}
+
+static void td_queue_push(uint16_t keycode, bool pressed, bool delayed) {
+    if (td_queue_count == VIAL_TAP_DANCE_QUEUE_SIZE)
+        td_queue_run(false);
+    td_queue[(td_queue_head + td_queue_count) % VIAL_TAP_DANCE_QUEUE_SIZE] = (td_key_event_t){
+        .keycode = keycode, .pressed = pressed, .delayed = delayed
+    };
+    ++td_queue_count;
+}
+
+static void td_keycode_down(uint16_t keycode) {
+    td_queue_push(keycode, true, false);
+}
+
+static void td_keycode_up(uint16_t keycode) {
+    td_queue_push(keycode, false, true);
+}
+
+static void td_keycode_tap(uint16_t keycode) {
+    td_keycode_down(keycode);
+    td_keycode_up(keycode);
+}
+
+/* Sends the queued events, leaving a pending delay to vial_tap_dance_task() only when nothing else has to follow
+   them: an interrupted dance is followed straight away by the interrupting key, and the mods added for the dance
+   are removed as soon as it is reset, which changes the report unless they are still held. */
+static void td_queue_commit(tap_dance_state_t *state) {
+    bool defer = !state->interrupted && !(state->weak_mods & ~get_mods());
+#ifndef NO_ACTION_ONESHOT
+    defer = defer && !state->oneshot_mods;
+#endif
+    td_queue_run(defer);
+}
+
+void vial_tap_dance_flush(void) {
+    td_queue_run(false);
+}
+
+void vial_tap_dance_task(void) {
+    if (td_queue_count > 0)
+        td_queue_run(true);
+}
 
 static uint8_t dance_step(tap_dance_state_t *state) {
     if (state->count == 1) {
@@ -355,136 +468,143 @@ static uint8_t dance_step(tap_dance_state_t *state) {
 
 static void on_dance(tap_dance_state_t *state, void *user_data) {
     uint8_t index = (uintptr_t)user_data;
-    if (dynamic_keymap_get_tap_dance(index, &td_entry) != 0)
-        return;
-    uint16_t kc = td_entry.on_tap;
+    const vial_tap_dance_entry_t *td_entry = &td_entries[index];
+    uint16_t kc = td_entry->on_tap;
     if (kc) {
         if (state->count == 3) {
-            vial_keycode_tap(kc);
-            vial_keycode_tap(kc);
-            vial_keycode_tap(kc);
+            td_keycode_tap(kc);
+            td_keycode_tap(kc);
+            td_keycode_tap(kc);
         } else if (state->count > 3) {
-            vial_keycode_tap(kc);
+            td_keycode_tap(kc);
         }
     }
+    td_queue_commit(state);
 }
 
 static void on_dance_finished(tap_dance_state_t *state, void *user_data) {
     uint8_t index = (uintptr_t)user_data;
-    if (dynamic_keymap_get_tap_dance(index, &td_entry) != 0)
-        return;
+    const vial_tap_dance_entry_t *td_entry = &td_entries[index];
     dance_state[index] = dance_step(state);
     switch (dance_state[index]) {
         case SINGLE_TAP: {
-            if (td_entry.on_tap)
-                vial_keycode_down(td_entry.on_tap);
+            if (td_entry->on_tap)
+                td_keycode_down(td_entry->on_tap);
             break;
         }
         case SINGLE_HOLD: {
-            if (td_entry.on_hold)
-                vial_keycode_down(td_entry.on_hold);
-            else if (td_entry.on_tap)
-                vial_keycode_down(td_entry.on_tap);
+            if (td_entry->on_hold)
+                td_keycode_down(td_entry->on_hold);
+            else if (td_entry->on_tap)
+                td_keycode_down(td_entry->on_tap);
             break;
         }
         case DOUBLE_TAP: {
-            if (td_entry.on_double_tap) {
-                vial_keycode_down(td_entry.on_double_tap);
-            } else if (td_entry.on_tap) {
-                vial_keycode_tap(td_entry.on_tap);
-                vial_keycode_down(td_entry.on_tap);
+            if (td_entry->on_double_tap) {
+                td_keycode_down(td_entry->on_double_tap);
+            } else if (td_entry->on_tap) {
+                td_keycode_tap(td_entry->on_tap);
+                td_keycode_down(td_entry->on_tap);
             }
             break;
         }
         case DOUBLE_HOLD: {
-            if (td_entry.on_tap_hold) {
-                vial_keycode_down(td_entry.on_tap_hold);
+            if (td_entry->on_tap_hold) {
+                td_keycode_down(td_entry->on_tap_hold);
             } else {
-                if (td_entry.on_tap) {
-                    vial_keycode_tap(td_entry.on_tap);
-                    if (td_entry.on_hold)
-                        vial_keycode_down(td_entry.on_hold);
+                if (td_entry->on_tap) {
+                    td_keycode_tap(td_entry->on_tap);
+                    if (td_entry->on_hold)
+                        td_keycode_down(td_entry->on_hold);
                     else
-                        vial_keycode_down(td_entry.on_tap);
-                } else if (td_entry.on_hold) {
-                    vial_keycode_down(td_entry.on_hold);
+                        td_keycode_down(td_entry->on_tap);
+                } else if (td_entry->on_hold) {
+                    td_keycode_down(td_entry->on_hold);
                 }
             }
             break;
         }
         case DOUBLE_SINGLE_TAP: {
-            if (td_entry.on_tap) {
-                vial_keycode_tap(td_entry.on_tap);
-                vial_keycode_down(td_entry.on_tap);
+            if (td_entry->on_tap) {
+                td_keycode_tap(td_entry->on_tap);
+                td_keycode_down(td_entry->on_tap);
             }
             break;
         }
     }
+    td_queue_commit(state);
 }
 
 static void on_dance_reset(tap_dance_state_t *state, void *user_data) {
     uint8_t index = (uintptr_t)user_data;
-    if (dynamic_keymap_get_tap_dance(index, &td_entry) != 0)
-        return;
-    qs_wait_ms(QS_tap_code_delay);
+    const vial_tap_dance_entry_t *td_entry = &td_entries[index];
     uint8_t st = dance_state[index];
     state->count = 0;
     dance_state[index] = 0;
     switch (st) {
         case SINGLE_TAP: {
-            if (td_entry.on_tap)
-                vial_keycode_up(td_entry.on_tap);
+            if (td_entry->on_tap)
+                td_keycode_up(td_entry->on_tap);
             break;
         }
         case SINGLE_HOLD: {
-            if (td_entry.on_hold)
-                vial_keycode_up(td_entry.on_hold);
-            else if (td_entry.on_tap)
-                vial_keycode_up(td_entry.on_tap);
+            if (td_entry->on_hold)
+                td_keycode_up(td_entry->on_hold);
+            else if (td_entry->on_tap)
+                td_keycode_up(td_entry->on_tap);
             break;
         }
         case DOUBLE_TAP: {
-            if (td_entry.on_double_tap) {
-                vial_keycode_up(td_entry.on_double_tap);
-            } else if (td_entry.on_tap) {
-                vial_keycode_up(td_entry.on_tap);
+            if (td_entry->on_double_tap) {
+                td_keycode_up(td_entry->on_double_tap);
+            } else if (td_entry->on_tap) {
+                td_keycode_up(td_entry->on_tap);
             }
             break;
         }
         case DOUBLE_HOLD: {
-            if (td_entry.on_tap_hold) {
-                vial_keycode_up(td_entry.on_tap_hold);
+            if (td_entry->on_tap_hold) {
+                td_keycode_up(td_entry->on_tap_hold);
             } else {
-                if (td_entry.on_tap) {
-                    if (td_entry.on_hold)
-                        vial_keycode_up(td_entry.on_hold);
+                if (td_entry->on_tap) {
+                    if (td_entry->on_hold)
+                        td_keycode_up(td_entry->on_hold);
                     else
-                        vial_keycode_up(td_entry.on_tap);
-                } else if (td_entry.on_hold) {
-                    vial_keycode_up(td_entry.on_hold);
+                        td_keycode_up(td_entry->on_tap);
+                } else if (td_entry->on_hold) {
+                    td_keycode_up(td_entry->on_hold);
                 }
             }
             break;
         }
         case DOUBLE_SINGLE_TAP: {
-            if (td_entry.on_tap) {
-                vial_keycode_up(td_entry.on_tap);
+            if (td_entry->on_tap) {
+                td_keycode_up(td_entry->on_tap);
             }
             break;
         }
     }
+    td_queue_commit(state);
 }
 
 tap_dance_action_t tap_dance_actions[VIAL_TAP_DANCE_ENTRIES] = { };
 
-/* Load timings from eeprom into custom_tapping_term */
+/* Load an entry, including the timing for custom_tapping_term, from eeprom */
+static void reload_tap_dance_entry(uint8_t index) {
+    if (index >= VIAL_TAP_DANCE_ENTRIES)
+        return;
+
+    tap_dance_actions[index].fn.on_each_tap = on_dance;
+    tap_dance_actions[index].fn.on_dance_finished = on_dance_finished;
+    tap_dance_actions[index].fn.on_reset = on_dance_reset;
+    tap_dance_actions[index].user_data = (void*)(uintptr_t)index;
+    if (dynamic_keymap_get_tap_dance(index, &td_entries[index]) != 0)
+        memset(&td_entries[index], 0, sizeof(td_entries[index]));
+}
+
 static void reload_tap_dance(void) {
-    for (size_t i = 0; i < VIAL_TAP_DANCE_ENTRIES; ++i) {
-        tap_dance_actions[i].fn.on_each_tap = on_dance;
-        tap_dance_actions[i].fn.on_dance_finished = on_dance_finished;
-        tap_dance_actions[i].fn.on_reset = on_dance_reset;
-        tap_dance_actions[i].user_data = (void*)i;
-    }
+    for (size_t i = 0; i < VIAL_TAP_DANCE_ENTRIES; ++i)
+        reload_tap_dance_entry(i);
 }
 #endif
 
@@ -492,9 +612,9 @@ static void reload_tap_dance(void) {
 uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
 #ifdef VIAL_TAP_DANCE_ENABLE
     if (keycode >= QK_TAP_DANCE && keycode <= QK_TAP_DANCE_MAX) {
-        vial_tap_dance_entry_t td;
-        if (dynamic_keymap_get_tap_dance(keycode & 0xFF, &td) == 0)
-            return td.custom_tapping_term;
+        uint8_t idx = keycode & 0xFF;
+        if (idx < VIAL_TAP_DANCE_ENTRIES)
+            return td_entries[idx].custom_tapping_term;
     }
 #endif
 #ifdef QMK_SETTINGS
@@ -509,23 +629,32 @@ uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
 combo_t key_combos[VIAL_COMBO_ENTRIES] = { };
 uint16_t key_combos_keys[VIAL_COMBO_ENTRIES][5];
 
-static void reload_combo(void) {
+/* Load a single combo from eeprom, the keycode index has to be rebuilt afterwards */
+static void reload_combo_entry(uint8_t index) {
+    if (index >= VIAL_COMBO_ENTRIES)
+        return;
+
     /* initialize with all keys = COMBO_END */
-    memset(key_combos_keys, 0, sizeof(key_combos_keys));
-    memset(key_combos, 0, sizeof(key_combos));
-
-    /* reload from eeprom */
-    for (size_t i = 0; i < VIAL_COMBO_ENTRIES; ++i) {
-        uint16_t *seq = key_combos_keys[i];
-        key_combos[i].keys = seq;
-
-        vial_combo_entry_t entry;
-        if (dynamic_keymap_get_combo(i, &entry) == 0) {
-            memcpy(seq, entry.input, sizeof(entry.input));
-            key_combos[i].keycode = entry.output;
-        }
+    uint16_t *seq = key_combos_keys[index];
+    memset(seq, 0, sizeof(key_combos_keys[index]));
+    memset(&key_combos[index], 0, sizeof(key_combos[index]));
+    key_combos[index].keys = seq;
+
+    vial_combo_entry_t entry;
+    if (dynamic_keymap_get_combo(index, &entry) == 0) {
+        memcpy(seq, entry.input, sizeof(entry.input));
+        key_combos[index].keycode = entry.output;
     }
 }
+
+static void reload_combo(void) {
+    for (size_t i = 0; i < VIAL_COMBO_ENTRIES; ++i)
+        reload_combo_entry(i);
+
+#ifdef COMBO_KEYCODE_INDEX
+    combo_index_build();
+#endif
+}
 #endif
 
 #ifdef VIAL_TAP_DANCE_ENABLE
@@ -537,17 +666,18 @@ bool process_record_vial(uint16_t keycode, keyrecord_t *record) {
     /* process releases before tap-dance timeout arrives */
     if (!record->event.pressed && keycode >= QK_TAP_DANCE && keycode <= QK_TAP_DANCE_MAX) {
         uint16_t idx = keycode - QK_TAP_DANCE;
-        if (dynamic_keymap_get_tap_dance(idx, &td_entry) != 0)
+        if (idx >= VIAL_TAP_DANCE_ENTRIES)
             return true;
 
+        const vial_tap_dance_entry_t *td_entry = &td_entries[idx];
         tap_dance_action_t *action = &tap_dance_actions[idx];
 
         /* only care about 2 possibilities here
            - tap and hold set, everything else unset: process first release early (count == 1)
            - double tap set: process second release early (count == 2)
          */
-        if ((action->state.count == 1 && td_entry.on_tap && td_entry.on_hold && !td_entry.on_double_tap && !td_entry.on_tap_hold)
-            || (action->state.count == 2 && td_entry.on_double_tap)) {
+        if ((action->state.count == 1 && td_entry->on_tap && td_entry->on_hold && !td_entry->on_double_tap && !td_entry->on_tap_hold)
+            || (action->state.count == 2 && td_entry->on_double_tap)) {
                 action->state.pressed = false;
                 process_tap_dance_action_on_dance_finished(action);
                 /* reset_tap_dance() will get called in process_tap_dance() */
@@ -595,10 +725,16 @@ static int vial_get_key_override(uint8_t index, key_override_t *out) {
     return 0;
 }
 
+static void reload_key_override_entry(uint8_t index) {
+    if (index >= VIAL_KEY_OVERRIDE_ENTRIES)
+        return;
+
+    override_ptrs[index] = &overrides[index];
+    vial_get_key_override(index, &overrides[index]);
+}
+
 static void reload_key_override(void) {
-    for (size_t i = 0; i < VIAL_KEY_OVERRIDE_ENTRIES; ++i) {
-        override_ptrs[i] = &overrides[i];
-        vial_get_key_override(i, &overrides[i]);
-    }
+    for (size_t i = 0; i < VIAL_KEY_OVERRIDE_ENTRIES; ++i)
+        reload_key_override_entry(i);
 }
 #endif
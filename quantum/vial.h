@@ -26,6 +26,8 @@
 #define VIAL_RAW_EPSIZE 32
 
 void vial_init(void);
+/* Reloads the RAM copies of the dynamic entries, after they have been rewritten in EEPROM */
+void vial_reload(void);
 void vial_handle_cmd(uint8_t *data, uint8_t length);
 bool process_record_vial(uint16_t keycode, keyrecord_t *record);
 
@@ -58,6 +60,8 @@ enum {
     dynamic_vial_combo_set = 0x04,
     dynamic_vial_key_override_get = 0x05,
     dynamic_vial_key_override_set = 0x06,
+    dynamic_vial_batch_begin = 0x07,  /* the sets that follow are part of one upload */
+    dynamic_vial_batch_commit = 0x08, /* the upload is done */
 };
 
 #define VIAL_MACRO_EXT_TAP 5
@@ -97,6 +101,11 @@ typedef struct {
 } vial_tap_dance_entry_t;
 _Static_assert(sizeof(vial_tap_dance_entry_t) == 10, "Unexpected size of the vial_tap_dance_entry_t structure");
 
+/* Sends any key events still queued by the tap dances, waiting out the remaining tap code delay */
+void vial_tap_dance_flush(void);
+/* Sends the queued key events whose tap code delay has elapsed, called from the scan loop */
+void vial_tap_dance_task(void);
+
 #else
 #undef VIAL_TAP_DANCE_ENTRIES
 #define VIAL_TAP_DANCE_ENTRIES 0
@@ -32,6 +32,17 @@ wear_leveling_2byte_optimized_writes_SRC := \
 wear_leveling_2byte_optimized_writes_INC := \
 	$(wear_leveling_common_INC)
 
+wear_leveling_2byte_bulk_writes_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=8192 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=4096
+wear_leveling_2byte_bulk_writes_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_2byte_bulk_writes.cpp
+wear_leveling_2byte_bulk_writes_INC := \
+	$(wear_leveling_common_INC)
+
 wear_leveling_2byte_DEFS := \
 	$(wear_leveling_common_DEFS) \
 	-DBACKING_STORE_WRITE_SIZE=2 \
@@ -63,4 +74,29 @@ wear_leveling_8byte_SRC := \
 	$(wear_leveling_common_SRC) \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
-	$(wear_leveling_common_INC)
\ No newline at end of file
+	$(wear_leveling_common_INC)
+
+wear_leveling_write_back_common_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=2048 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024
+wear_leveling_write_back_common_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_write_back.cpp
+
+wear_leveling_write_through_DEFS := \
+	$(wear_leveling_write_back_common_DEFS)
+wear_leveling_write_through_SRC := \
+	$(wear_leveling_write_back_common_SRC)
+wear_leveling_write_through_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_write_back_DEFS := \
+	$(wear_leveling_write_back_common_DEFS) \
+	-DWEAR_LEVELING_WRITE_BACK
+wear_leveling_write_back_SRC := \
+	$(wear_leveling_write_back_common_SRC)
+wear_leveling_write_back_INC := \
+	$(wear_leveling_common_INC)
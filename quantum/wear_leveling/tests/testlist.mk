@@ -1,6 +1,9 @@
 TEST_LIST += \
 	wear_leveling_general \
 	wear_leveling_2byte_optimized_writes \
+	wear_leveling_2byte_bulk_writes \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
-	wear_leveling_8byte
+	wear_leveling_8byte \
+	wear_leveling_write_through \
+	wear_leveling_write_back
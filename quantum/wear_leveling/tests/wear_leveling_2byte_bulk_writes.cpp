@@ -0,0 +1,192 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLeveling2ByteBulkWrites : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+};
+
+// Mirrors a VIA/Vial keymap upload: 4 layers of a 6x20 matrix, two bytes per keycode, sent in 28-byte chunks
+static constexpr uint32_t    keymap_address = 256;
+static constexpr std::size_t keymap_size    = 4 * 6 * 20 * 2;
+static constexpr std::size_t chunk_size     = 28;
+
+static std::vector<std::uint8_t> make_keymap(std::uint8_t seed) {
+    std::vector<std::uint8_t> keymap(keymap_size);
+    for (std::size_t i = 0; i < keymap_size; ++i) {
+        // Avoid 0x0000/0x0001 keycodes, those take the optimised single-word log entries
+        keymap[i] = (std::uint8_t)(0x40 + ((i * 7 + seed) % 0x80));
+    }
+    return keymap;
+}
+
+static std::uint64_t upload_blocks(const std::vector<std::uint8_t>& keymap) {
+    auto&         inst   = MockBackingStore::Instance();
+    std::uint64_t before = inst.write_invoke_count();
+    for (std::size_t offset = 0; offset < keymap.size(); offset += chunk_size) {
+        std::size_t length = std::min(chunk_size, keymap.size() - offset);
+        EXPECT_NE(wear_leveling_write(keymap_address + offset, &keymap[offset], length), WEAR_LEVELING_FAILED) << "Block write failed";
+    }
+    return inst.write_invoke_count() - before;
+}
+
+static std::uint64_t upload_bytes(const std::vector<std::uint8_t>& keymap) {
+    auto&         inst   = MockBackingStore::Instance();
+    std::uint64_t before = inst.write_invoke_count();
+    for (std::size_t offset = 0; offset < keymap.size(); ++offset) {
+        EXPECT_NE(wear_leveling_write(keymap_address + offset, &keymap[offset], 1), WEAR_LEVELING_FAILED) << "Byte write failed";
+    }
+    return inst.write_invoke_count() - before;
+}
+
+static void verify_readback(const std::vector<std::uint8_t>& keymap) {
+    std::vector<std::uint8_t> readback(keymap.size());
+    EXPECT_EQ(wear_leveling_read(keymap_address, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(readback, keymap) << "Invalid readback";
+}
+
+/**
+ * This test verifies that rewriting an identical block does not touch the backing store.
+ */
+TEST_F(WearLeveling2ByteBulkWrites, UnchangedBlockWritesNothing) {
+    auto keymap = make_keymap(0);
+    upload_blocks(keymap);
+
+    EXPECT_EQ(upload_blocks(keymap), 0) << "Unchanged upload should not write to the backing store";
+}
+
+/**
+ * This test verifies that changing a single keycode inside a block only logs that keycode.
+ */
+TEST_F(WearLeveling2ByteBulkWrites, SingleKeycodeChangeLogsOnlyThatKeycode) {
+    auto& inst   = MockBackingStore::Instance();
+    auto  keymap = make_keymap(0);
+    upload_blocks(keymap);
+
+    std::size_t log_size = std::distance(inst.log_begin(), inst.log_end());
+    keymap[10] ^= 0x11;
+    keymap[11] ^= 0x22;
+
+    // One 2-byte multibyte entry: header plus data, 3 backing writes
+    EXPECT_EQ(upload_blocks(keymap), 3);
+
+    write_log_entry_t e;
+    e.raw16[0] = (inst.log_begin() + log_size)->value;
+    EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_MULTIBYTE) << "Invalid write log entry type";
+    EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_LENGTH(e), 2) << "Invalid write log entry length";
+
+    verify_readback(keymap);
+}
+
+/**
+ * This test verifies that nearby changes within one log entry's reach are merged into a single entry.
+ */
+TEST_F(WearLeveling2ByteBulkWrites, NearbyChangesShareAnEntry) {
+    auto keymap = make_keymap(0);
+    upload_blocks(keymap);
+
+    keymap[20] ^= 0x11;
+    keymap[24] ^= 0x22;
+
+    // One 5-byte multibyte entry: header plus data, 4 backing writes
+    EXPECT_EQ(upload_blocks(keymap), 4);
+    verify_readback(keymap);
+}
+
+/**
+ * This test compares backing store writes for full and partial keymap uploads, block versus byte-at-a-time.
+ */
+TEST_F(WearLeveling2ByteBulkWrites, KeymapUploadWriteCounts) {
+    auto& inst     = MockBackingStore::Instance();
+    auto  defaults = make_keymap(0);
+    auto  updated  = defaults;
+    // Change 12 keycodes spread over the keymap
+    for (std::size_t i = 0; i < 12; ++i) {
+        std::size_t offset = (i * 76) & ~(std::size_t)1;
+        updated[offset] ^= 0x15;
+        updated[offset + 1] ^= 0x2A;
+    }
+
+    // Full upload onto an erased store
+    std::uint64_t full_blocks = upload_blocks(defaults);
+    verify_readback(defaults);
+    inst.reset_instance();
+    wear_leveling_init();
+    std::uint64_t full_bytes = upload_bytes(defaults);
+    verify_readback(defaults);
+
+    // Each 28-byte chunk is 5+5+5+5+5+3 bytes: 5 entries of 4 writes plus one of 3, the trailing 8 bytes are 5+3
+    EXPECT_EQ(full_blocks, (keymap_size / chunk_size) * 23 + 4 + 3);
+    // Each byte is its own 1-byte multibyte entry of 2 writes
+    EXPECT_EQ(full_bytes, keymap_size * 2);
+
+    // Partial upload on top of the defaults
+    inst.reset_instance();
+    wear_leveling_init();
+    upload_blocks(defaults);
+    std::uint64_t partial_blocks = upload_blocks(updated);
+    verify_readback(updated);
+    inst.reset_instance();
+    wear_leveling_init();
+    upload_blocks(defaults);
+    std::uint64_t partial_bytes = upload_bytes(updated);
+    verify_readback(updated);
+
+    EXPECT_EQ(partial_blocks, 12 * 3);
+    EXPECT_EQ(partial_bytes, 12 * 4);
+
+    std::cout << "full upload: " << full_blocks << " block vs " << full_bytes << " byte writes, 12 keycodes changed: " << partial_blocks << " block vs " << partial_bytes << " byte writes" << std::endl;
+}
+
+/**
+ * This test verifies that block writes spanning a consolidation persist every changed byte.
+ */
+TEST_F(WearLeveling2ByteBulkWrites, ConsolidationDuringBlockWritesKeepsData) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::vector<std::uint8_t> keymap;
+    for (std::uint8_t seed = 1; inst.erasure_count() < 3; ++seed) {
+        keymap = make_keymap(seed);
+        upload_blocks(keymap);
+        verify_readback(keymap);
+    }
+
+    // Play back the backing store from scratch
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback(keymap);
+}
+
+/**
+ * This test verifies that a block write which fails part way leaves no unwritten data in the cache.
+ */
+TEST_F(WearLeveling2ByteBulkWrites, FailedBlockWriteKeepsCache) {
+    auto& inst   = MockBackingStore::Instance();
+    auto  keymap = make_keymap(0);
+    upload_blocks(keymap);
+
+    // Two separate changed spans within one chunk, the second of which fails to reach the backing store
+    auto changed = keymap;
+    changed[0] ^= 0x01;
+    changed[20] ^= 0x01;
+    std::uint64_t first_span_writes = 0;
+    inst.set_write_callback([&](std::uint64_t, std::uint32_t) { return ++first_span_writes <= 2; });
+    EXPECT_EQ(wear_leveling_write(keymap_address, changed.data(), chunk_size), WEAR_LEVELING_FAILED) << "Write should have failed";
+    inst.set_write_callback(nullptr);
+
+    // The first span was logged, the second was not
+    auto expected = keymap;
+    expected[0]   = changed[0];
+    verify_readback(expected);
+
+    // Play back the backing store from scratch
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback(expected);
+}
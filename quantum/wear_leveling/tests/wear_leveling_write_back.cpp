@@ -0,0 +1,307 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <iostream>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#ifndef WEAR_LEVELING_WRITE_BACK_TIMEOUT
+#    define WEAR_LEVELING_WRITE_BACK_TIMEOUT 1000
+#endif
+
+class WearLevelingWriteBack : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    // Lets writes go idle so that any pending data is flushed
+    void idle(void) {
+        advance_time(WEAR_LEVELING_WRITE_BACK_TIMEOUT);
+        wear_leveling_task();
+    }
+
+    // Simulates a power cycle, rebuilding the cache from the backing store only
+    void reboot(void) {
+        wear_leveling_init();
+    }
+
+    void expect_cache_matches(void) {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> actual;
+        wear_leveling_read(0, actual.data(), actual.size());
+        EXPECT_THAT(actual, testing::ElementsAreArray(verify_data));
+    }
+
+    /**
+     * Stepping RGB hue 32 times, where each step updates the 4-byte rgblight config at address 8 and is followed by a
+     * pause long enough for a flush.
+     */
+    void rgb_hue_burst(void) {
+        for (int step = 0; step < 32; ++step) {
+            uint8_t config[4] = {0x01, (uint8_t)(step * 8), 0xFF, 0x80};
+            test_write(8, config, sizeof(config));
+        }
+        idle();
+    }
+
+    /**
+     * QMK Settings saving a 40-byte block one byte at a time, with a tapping term and a few flags changed.
+     */
+    void qmk_settings_burst(uint8_t tapping_term) {
+        uint8_t settings[40] = {0};
+        settings[0]          = tapping_term;
+        settings[1]          = 0x01;
+        settings[4]          = 0x10;
+        settings[5]          = tapping_term ^ 0x5A;
+        settings[20]         = 0x03;
+        for (uint32_t i = 0; i < sizeof(settings); ++i) {
+            uint8_t current;
+            wear_leveling_read(0x200 + i, &current, 1);
+            if (current != settings[i]) {
+                test_write(0x200 + i, &settings[i], 1);
+            }
+        }
+        idle();
+    }
+
+    /**
+     * eeconfig_init_quantum() writing each of the core eeconfig fields individually.
+     */
+    void eeconfig_init_burst(uint8_t seed) {
+        const uint16_t magic   = 0xFEE6;
+        const uint8_t  debug   = seed & 1;
+        const uint8_t  layer   = 0;
+        const uint16_t keymap  = 0x1400 | seed;
+        const uint8_t  backlit = seed;
+        const uint8_t  audio   = 0x01;
+        const uint32_t rgb     = 0x80FF0001u ^ seed;
+        test_write(0, &magic, sizeof(magic));
+        test_write(2, &debug, sizeof(debug));
+        test_write(3, &layer, sizeof(layer));
+        test_write(4, &keymap, sizeof(keymap));
+        test_write(6, &backlit, sizeof(backlit));
+        test_write(7, &audio, sizeof(audio));
+        test_write(8, &rgb, sizeof(rgb));
+        idle();
+    }
+};
+
+/**
+ * Replays a typical day of settings changes, and reports the resulting backing store appends and erases.
+ */
+TEST_F(WearLevelingWriteBack, SettingsBursts) {
+    auto& inst = MockBackingStore::Instance();
+    for (int session = 0; session < 20; ++session) {
+        eeconfig_init_burst(session);
+        rgb_hue_burst();
+        qmk_settings_burst(200 + session);
+    }
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS);
+
+    std::cout << "settings bursts: " << inst.total_write_count() << " appends, " << inst.erasure_count() << " erases" << std::endl;
+#ifdef WEAR_LEVELING_WRITE_BACK
+    // Each burst is written as a handful of merged entries rather than one entry per write
+    EXPECT_LE(inst.total_write_count(), 400u);
+    EXPECT_LE(inst.erasure_count(), 1u);
+#else
+    EXPECT_GT(inst.total_write_count(), 1000u);
+    EXPECT_GE(inst.erasure_count(), 2u);
+#endif
+
+    reboot();
+    expect_cache_matches();
+}
+
+#ifdef WEAR_LEVELING_WRITE_BACK
+/**
+ * This test verifies that writes are held in the cache until writes have been idle for the timeout.
+ */
+TEST_F(WearLevelingWriteBack, WritesDeferredUntilIdle) {
+    auto&   inst  = MockBackingStore::Instance();
+    uint8_t value = 0x42;
+    EXPECT_EQ(test_write(0x100, &value, sizeof(value)), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(inst.total_write_count(), 0u);
+    expect_cache_matches();
+
+    advance_time(WEAR_LEVELING_WRITE_BACK_TIMEOUT - 1);
+    wear_leveling_task();
+    EXPECT_EQ(inst.total_write_count(), 0u);
+
+    // Another write restarts the timeout
+    value = 0x43;
+    test_write(0x100, &value, sizeof(value));
+    advance_time(WEAR_LEVELING_WRITE_BACK_TIMEOUT - 1);
+    wear_leveling_task();
+    EXPECT_EQ(inst.total_write_count(), 0u);
+
+    advance_time(1);
+    wear_leveling_task();
+    EXPECT_EQ(inst.total_write_count(), 1u);
+
+    reboot();
+    expect_cache_matches();
+}
+
+/**
+ * This test verifies that adjacent single byte writes are appended as one multi-byte entry.
+ */
+TEST_F(WearLevelingWriteBack, AdjacentWritesMerged) {
+    auto& inst = MockBackingStore::Instance();
+    for (uint8_t i = 0; i < 5; ++i) {
+        uint8_t value = 0x10 + i;
+        test_write(0x100 + i, &value, sizeof(value));
+    }
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS);
+
+    // A 5-byte multi-byte entry is two 4-byte backing store writes
+    EXPECT_EQ(inst.total_write_count(), 2u);
+    reboot();
+    expect_cache_matches();
+}
+
+/**
+ * This test verifies that nearby writes are merged when the combined span needs no more log entries.
+ */
+TEST_F(WearLevelingWriteBack, NearbyWritesMerged) {
+    auto&   inst  = MockBackingStore::Instance();
+    uint8_t value = 0x01;
+    test_write(0x100, &value, sizeof(value));
+    test_write(0x103, &value, sizeof(value));
+    test_write(0x110, &value, sizeof(value));
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS);
+
+    // 0x100..0x103 fit into one entry, 0x110 is too far away and gets its own
+    EXPECT_EQ(inst.total_write_count(), 3u);
+    reboot();
+    expect_cache_matches();
+}
+
+/**
+ * This test verifies that only the bytes which differ from the cache are marked dirty for larger writes.
+ */
+TEST_F(WearLevelingWriteBack, LargeWriteOnlyChangedBytes) {
+    auto&                     inst = MockBackingStore::Instance();
+    std::vector<std::uint8_t> block(64, 0);
+    block[3]  = 0xAA;
+    block[60] = 0xBB;
+    test_write(0x180, block.data(), block.size());
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS);
+
+    EXPECT_EQ(inst.total_write_count(), 2u);
+    reboot();
+    expect_cache_matches();
+}
+
+/**
+ * This test verifies that a power loss only loses data which has not yet been flushed.
+ */
+TEST_F(WearLevelingWriteBack, PowerLossBeforeFlush) {
+    uint8_t value = 0x11;
+    test_write(0x20, &value, sizeof(value));
+    idle();
+    auto flushed = verify_data;
+
+    value = 0x22;
+    test_write(0x20, &value, sizeof(value));
+    test_write(0x30, &value, sizeof(value));
+    reboot();
+
+    verify_data = flushed;
+    expect_cache_matches();
+}
+
+/**
+ * This test verifies that running out of dirty ranges flushes the pending ranges, oldest first.
+ */
+TEST_F(WearLevelingWriteBack, DirtySetOverflowFlushes) {
+    auto& inst = MockBackingStore::Instance();
+    for (uint32_t i = 0; i < WEAR_LEVELING_WRITE_BACK_RANGES; ++i) {
+        uint8_t value = 0x30 + i;
+        test_write(i * 0x20, &value, sizeof(value));
+    }
+    EXPECT_EQ(inst.total_write_count(), 0u);
+
+    uint8_t value = 0xEE;
+    test_write(0x3F0, &value, sizeof(value));
+    EXPECT_EQ(inst.total_write_count(), (std::size_t)WEAR_LEVELING_WRITE_BACK_RANGES);
+
+    // Ranges were appended in the order they were first written
+    auto entry = inst.log_begin();
+    for (uint32_t i = 0; i < WEAR_LEVELING_WRITE_BACK_RANGES; ++i, ++entry) {
+        write_log_entry_t log;
+        log.raw32[0] = entry->value;
+        EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_ADDRESS(log), i * 0x20);
+    }
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS);
+    reboot();
+    expect_cache_matches();
+}
+
+/**
+ * This test verifies that ranges which failed to flush are kept and written on a later flush.
+ */
+TEST_F(WearLevelingWriteBack, FailedFlushRetained) {
+    auto&   inst  = MockBackingStore::Instance();
+    uint8_t value = 0x5A;
+    test_write(0x40, &value, sizeof(value));
+    test_write(0x80, &value, sizeof(value));
+
+    // Allow the first range through, fail the second
+    inst.set_write_callback([](std::uint64_t count, std::uint32_t) { return count < 2; });
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_FAILED);
+    EXPECT_EQ(inst.total_write_count(), 1u);
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(inst.total_write_count(), 2u);
+
+    reboot();
+    expect_cache_matches();
+}
+
+/**
+ * This test verifies that a flush which fills the log consolidates the whole cache, including pending ranges.
+ */
+TEST_F(WearLevelingWriteBack, FlushConsolidates) {
+    auto& inst = MockBackingStore::Instance();
+    int   i    = 0;
+    while (inst.erasure_count() == 0) {
+        uint8_t value[2] = {(uint8_t)i, (uint8_t)(i >> 8)};
+        test_write((i * 0x10) % (WEAR_LEVELING_LOGICAL_SIZE - 2), value, sizeof(value));
+        idle();
+        ++i;
+    }
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS);
+
+    reboot();
+    expect_cache_matches();
+}
+
+/**
+ * This test verifies that erasing discards pending ranges.
+ */
+TEST_F(WearLevelingWriteBack, EraseDiscardsPending) {
+    auto&   inst  = MockBackingStore::Instance();
+    uint8_t value = 0x77;
+    test_write(0x40, &value, sizeof(value));
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(inst.total_write_count(), 0u);
+}
+#endif // WEAR_LEVELING_WRITE_BACK
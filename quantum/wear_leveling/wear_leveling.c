@@ -4,6 +4,9 @@
 #include "fnv.h"
 #include "wear_leveling.h"
 #include "wear_leveling_internal.h"
+#ifdef WEAR_LEVELING_WRITE_BACK
+#    include "timer.h"
+#endif // WEAR_LEVELING_WRITE_BACK
 
 /*
     This wear leveling algorithm is adapted from algorithms from previous
@@ -153,7 +156,22 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Write-back mode (WEAR_LEVELING_WRITE_BACK):
+
+        Writes only update the cache and record the changed span in a small
+        set of dirty ranges, merging spans that overlap or that fit into fewer
+        log entries when combined. The dirty ranges are appended to the write
+        log once no writes have occurred for WEAR_LEVELING_WRITE_BACK_TIMEOUT
+        milliseconds, when wear_leveling_flush() is invoked, or when a new span
+        does not fit into the set of WEAR_LEVELING_WRITE_BACK_RANGES entries.
+
+        Ranges are flushed oldest first, and each is only dropped from the set
+        once all of its log entries have been written. A power loss mid-flush
+        therefore leaves the log with the older ranges complete and the rest
+        holding their previous values; a power loss before a flush loses only
+        the pending ranges. */
 
 /**
  * Storage area for the wear-leveling cache.
@@ -162,6 +180,11 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_WRITE_BACK
+    wear_leveling_dirty_range_t dirty[(WEAR_LEVELING_WRITE_BACK_RANGES)];
+    uint8_t                     dirty_count;
+    uint32_t                    last_write;
+#endif // WEAR_LEVELING_WRITE_BACK
 } wear_leveling;
 
 /**
@@ -203,6 +226,9 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+#ifdef WEAR_LEVELING_WRITE_BACK
+    wear_leveling.dirty_count = 0;
+#endif // WEAR_LEVELING_WRITE_BACK
 }
 
 /**
@@ -318,6 +344,13 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     // Next write of the log occurs after the consolidated values at the start of the backing store.
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
 
+#ifdef WEAR_LEVELING_WRITE_BACK
+    // The consolidated data includes every pending range
+    if (status != WEAR_LEVELING_FAILED) {
+        wear_leveling.dirty_count = 0;
+    }
+#endif // WEAR_LEVELING_WRITE_BACK
+
     return status;
 }
 
@@ -469,6 +502,218 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+#ifndef WEAR_LEVELING_WRITE_BACK
+/**
+ * Handles writing a larger block into the write log, skipping bytes that match the current cache.
+ * Each changed byte starts a new log entry covering up to LOG_ENTRY_MULTIBYTE_MAX_BYTES, trimmed
+ * to the last changed byte within that window, so only the changed spans reach the backing store.
+ * Never needs more log space than writing the whole block; callers ensure that space is available.
+ */
+static wear_leveling_status_t wear_leveling_write_raw_changed(uint32_t address, const void *value, size_t length) {
+    const uint8_t *        p      = value;
+    uint8_t *              cache  = &wear_leveling.cache[address];
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    size_t                 i      = 0;
+    while (i < length) {
+        if (p[i] == cache[i]) {
+            ++i;
+            continue;
+        }
+
+        size_t end = (length - i) > LOG_ENTRY_MULTIBYTE_MAX_BYTES ? i + LOG_ENTRY_MULTIBYTE_MAX_BYTES : length;
+        while (end > i + 1 && p[end - 1] == cache[end - 1]) {
+            --end;
+        }
+
+        // The span goes into the cache before it is logged, as filling the log consolidates the cache in-line. It is
+        // put back if the write fails, so the cache never holds data which did not reach the backing store.
+        uint8_t previous[LOG_ENTRY_MULTIBYTE_MAX_BYTES];
+        memcpy(previous, &cache[i], end - i);
+        memcpy(&cache[i], &p[i], end - i);
+        status = wear_leveling_write_raw(address + (uint32_t)i, &p[i], end - i);
+        if (status == WEAR_LEVELING_FAILED) {
+            memcpy(&cache[i], previous, end - i);
+        }
+        if (status != WEAR_LEVELING_SUCCESS) {
+            return status;
+        }
+        i = end;
+    }
+
+    return status;
+}
+#endif // WEAR_LEVELING_WRITE_BACK
+
+#ifdef WEAR_LEVELING_WRITE_BACK
+/**
+ * Number of multi-byte log entries needed to write a span of the given length.
+ */
+static inline uint32_t wear_leveling_entry_count(uint32_t length) {
+    return (length + LOG_ENTRY_MULTIBYTE_MAX_BYTES - 1) / LOG_ENTRY_MULTIBYTE_MAX_BYTES;
+}
+
+/**
+ * Determines whether two dirty ranges should be written as one. Overlapping or adjacent ranges are always merged.
+ * Ranges with a gap between them are merged if the combined span needs no more log entries than the two separately,
+ * with the gap written from the cache. 2-byte backing stores encode small writes individually, so gaps are never
+ * merged there.
+ */
+static bool wear_leveling_dirty_mergeable(const wear_leveling_dirty_range_t *a, const wear_leveling_dirty_range_t *b) {
+    if (a->start <= b->end && b->start <= a->end) {
+        return true;
+    }
+#if BACKING_STORE_WRITE_SIZE == 2
+    return false;
+#else
+    const uint32_t start = a->start < b->start ? a->start : b->start;
+    const uint32_t end   = a->end > b->end ? a->end : b->end;
+    return wear_leveling_entry_count(end - start) <= wear_leveling_entry_count(a->end - a->start) + wear_leveling_entry_count(b->end - b->start);
+#endif
+}
+
+/**
+ * Removes the dirty range at the given index, keeping the remaining ranges in order of age.
+ */
+static void wear_leveling_dirty_remove(uint8_t index) {
+    memmove(&wear_leveling.dirty[index], &wear_leveling.dirty[index + 1], (wear_leveling.dirty_count - index - 1) * sizeof(wear_leveling_dirty_range_t));
+    --wear_leveling.dirty_count;
+}
+
+/**
+ * Writes the dirty ranges to the write log, oldest first. Each range is only dropped once all of its log entries have
+ * been written, so a failure leaves it and any newer ranges pending. If the log fills up, consolidation writes the
+ * entire cache and clears the set.
+ * Pre-condition: the backing store is unlocked.
+ */
+static wear_leveling_status_t wear_leveling_flush_dirty(void) {
+    wear_leveling_status_t status  = WEAR_LEVELING_SUCCESS;
+    uint8_t                flushed = 0;
+    while (flushed < wear_leveling.dirty_count) {
+        const wear_leveling_dirty_range_t *range = &wear_leveling.dirty[flushed];
+        wl_dprintf("Flush [0x%04X..0x%04X)\n", (int)range->start, (int)range->end);
+        status = wear_leveling_write_raw(range->start, &wear_leveling.cache[range->start], range->end - range->start);
+        if (status != WEAR_LEVELING_SUCCESS) {
+            break;
+        }
+        ++flushed;
+    }
+
+    switch (status) {
+        case WEAR_LEVELING_SUCCESS:
+            wear_leveling.dirty_count = 0;
+            break;
+
+        case WEAR_LEVELING_FAILED:
+            // Keep the range which failed along with everything newer
+            memmove(&wear_leveling.dirty[0], &wear_leveling.dirty[flushed], (wear_leveling.dirty_count - flushed) * sizeof(wear_leveling_dirty_range_t));
+            wear_leveling.dirty_count -= flushed;
+            break;
+
+        default:
+            // Consolidation has already cleared the set
+            break;
+    }
+
+    return status;
+}
+
+/**
+ * Adds a span to the set of dirty ranges, merging it with any ranges it reaches. A merged range keeps the position
+ * of the oldest range it absorbed. If the set is full, the pending ranges are flushed first.
+ */
+static wear_leveling_status_t wear_leveling_mark_dirty(uint32_t start, uint32_t end) {
+    wear_leveling_dirty_range_t span   = {.start = start, .end = end};
+    wear_leveling_status_t      status = WEAR_LEVELING_SUCCESS;
+
+    for (uint8_t i = 0; i < wear_leveling.dirty_count; ++i) {
+        if (wear_leveling_dirty_mergeable(&wear_leveling.dirty[i], &span)) {
+            wear_leveling_dirty_range_t *range = &wear_leveling.dirty[i];
+            range->start                       = range->start < start ? range->start : start;
+            range->end                         = range->end > end ? range->end : end;
+
+            // The grown range may now reach others, fold them in as well
+            bool merged;
+            do {
+                merged = false;
+                for (uint8_t j = 0; j < wear_leveling.dirty_count; ++j) {
+                    if (j == i || !wear_leveling_dirty_mergeable(&wear_leveling.dirty[i], &wear_leveling.dirty[j])) {
+                        continue;
+                    }
+                    const uint8_t keep = i < j ? i : j;
+                    const uint8_t drop = i < j ? j : i;
+                    if (wear_leveling.dirty[drop].start < wear_leveling.dirty[keep].start) {
+                        wear_leveling.dirty[keep].start = wear_leveling.dirty[drop].start;
+                    }
+                    if (wear_leveling.dirty[drop].end > wear_leveling.dirty[keep].end) {
+                        wear_leveling.dirty[keep].end = wear_leveling.dirty[drop].end;
+                    }
+                    wear_leveling_dirty_remove(drop);
+                    i      = keep;
+                    merged = true;
+                    break;
+                }
+            } while (merged);
+            return status;
+        }
+    }
+
+    if (wear_leveling.dirty_count == (WEAR_LEVELING_WRITE_BACK_RANGES)) {
+        backing_store_lock_status_t lock_status = wear_leveling_unlock();
+        if (lock_status == STATUS_FAILURE) {
+            wear_leveling_lock();
+            status = WEAR_LEVELING_FAILED;
+        } else {
+            status = wear_leveling_flush_dirty();
+            if (lock_status == STATUS_SUCCESS && wear_leveling_lock() == STATUS_FAILURE) {
+                status = WEAR_LEVELING_FAILED;
+            }
+        }
+
+        if (wear_leveling.dirty_count == (WEAR_LEVELING_WRITE_BACK_RANGES)) {
+            // Nothing could be flushed, widen the newest range over the span so that it isn't lost
+            wear_leveling_dirty_range_t *range = &wear_leveling.dirty[wear_leveling.dirty_count - 1];
+            range->start                       = range->start < start ? range->start : start;
+            range->end                         = range->end > end ? range->end : end;
+            return status;
+        }
+    }
+
+    wear_leveling.dirty[wear_leveling.dirty_count++] = span;
+    return status;
+}
+
+/**
+ * Updates the cache with the supplied data, marking only the bytes which changed as dirty.
+ */
+static wear_leveling_status_t wear_leveling_write_back(uint32_t address, const void *value, size_t length) {
+    const uint8_t *        p      = value;
+    uint8_t *              cache  = &wear_leveling.cache[address];
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    size_t                 i      = 0;
+    while (i < length) {
+        if (p[i] == cache[i]) {
+            ++i;
+            continue;
+        }
+
+        size_t end = i + 1;
+        while (end < length && p[end] != cache[end]) {
+            ++end;
+        }
+
+        memcpy(&cache[i], &p[i], end - i);
+        wear_leveling_status_t span_status = wear_leveling_mark_dirty(address + (uint32_t)i, address + (uint32_t)end);
+        if (status != WEAR_LEVELING_FAILED && span_status != WEAR_LEVELING_SUCCESS) {
+            status = span_status;
+        }
+        i = end;
+    }
+
+    wear_leveling.last_write = timer_read32();
+    return status;
+}
+#endif // WEAR_LEVELING_WRITE_BACK
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
@@ -688,18 +933,34 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         return true;
     }
 
-    // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
-    memcpy(&wear_leveling.cache[address], value, length);
+#ifdef WEAR_LEVELING_WRITE_BACK
+    // Defer the write, the changed bytes are appended to the write log later as merged entries
+    return wear_leveling_write_back(address, value, length);
+#else // WEAR_LEVELING_WRITE_BACK
+
+    // Larger blocks (such as keymap uploads) only log the spans that differ from the cache, provided the whole block
+    // is guaranteed to fit in the remaining write log (each log entry covers up to LOG_ENTRY_MULTIBYTE_MAX_BYTES and
+    // takes at most 8 bytes of backing store). Otherwise the full block goes through the regular path below.
+    const size_t max_log_bytes = ((length + LOG_ENTRY_MULTIBYTE_MAX_BYTES - 1) / LOG_ENTRY_MULTIBYTE_MAX_BYTES) * 8;
+    const bool   log_changed   = length > LOG_ENTRY_MULTIBYTE_MAX_BYTES && wear_leveling.write_address + max_log_bytes <= (WEAR_LEVELING_BACKING_SIZE);
+
+    if (!log_changed) {
+        // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
+        memcpy(&wear_leveling.cache[address], value, length);
+    }
 
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
+        if (log_changed) {
+            memcpy(&wear_leveling.cache[address], value, length);
+        }
         wear_leveling_lock();
         return WEAR_LEVELING_FAILED;
     }
 
     // Perform the actual write
-    wear_leveling_status_t status = wear_leveling_write_raw(address, value, length);
+    wear_leveling_status_t status = log_changed ? wear_leveling_write_raw_changed(address, value, length) : wear_leveling_write_raw(address, value, length);
     switch (status) {
         case WEAR_LEVELING_CONSOLIDATED:
         case WEAR_LEVELING_FAILED:
@@ -724,6 +985,53 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     }
 
     return status;
+#endif // WEAR_LEVELING_WRITE_BACK
+}
+
+/**
+ * Writes any pending data to the backing store.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+#ifdef WEAR_LEVELING_WRITE_BACK
+    if (wear_leveling.dirty_count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Flush\n");
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = wear_leveling_flush_dirty();
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+#else
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_WRITE_BACK
+}
+
+/**
+ * Flushes pending data once writes have been idle for the write-back timeout.
+ */
+void wear_leveling_task(void) {
+#ifdef WEAR_LEVELING_WRITE_BACK
+    if (wear_leveling.dirty_count > 0 && timer_elapsed32(wear_leveling.last_write) >= (WEAR_LEVELING_WRITE_BACK_TIMEOUT)) {
+        if (wear_leveling_flush() == WEAR_LEVELING_FAILED) {
+            // Back off for another timeout period before retrying
+            wear_leveling.last_write = timer_read32();
+        }
+    }
+#endif // WEAR_LEVELING_WRITE_BACK
 }
 
 /**
@@ -36,6 +36,9 @@ wear_leveling_status_t wear_leveling_erase(void);
  * determine if an overwrite should occur -- if there is any data mismatch the entire block will be written to the log,
  * not just the changed bytes.
  *
+ * With WEAR_LEVELING_WRITE_BACK, only the cache is updated and the changed bytes are written to the log later, see
+ * wear_leveling_flush() and wear_leveling_task().
+ *
  * @param address[in] the logical address to write data
  * @param value[in] pointer to the source buffer
  * @param length[in] length of the data
@@ -52,3 +55,17 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Writes any data held back by WEAR_LEVELING_WRITE_BACK to the backing store.
+ *
+ * No-op if write-back is disabled or there is no pending data.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
+/**
+ * Periodic task, flushing pending data once no writes have occurred for WEAR_LEVELING_WRITE_BACK_TIMEOUT milliseconds.
+ */
+void wear_leveling_task(void);
@@ -27,6 +27,15 @@ typedef uint64_t backing_store_int_t;
 #    error WEAR_LEVELING_LOGICAL_SIZE was not set.
 #endif
 
+#ifdef WEAR_LEVELING_WRITE_BACK
+#    ifndef WEAR_LEVELING_WRITE_BACK_TIMEOUT
+#        define WEAR_LEVELING_WRITE_BACK_TIMEOUT 1000
+#    endif
+#    ifndef WEAR_LEVELING_WRITE_BACK_RANGES
+#        define WEAR_LEVELING_WRITE_BACK_RANGES 8
+#    endif
+#endif // WEAR_LEVELING_WRITE_BACK
+
 #ifdef WEAR_LEVELING_DEBUG_OUTPUT
 #    include <debug.h>
 #    define bs_dprintf(...) dprintf("Backing store: " __VA_ARGS__)
@@ -65,6 +74,9 @@ typedef uint64_t backing_store_int_t;
 _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+#ifdef WEAR_LEVELING_WRITE_BACK
+_Static_assert(WEAR_LEVELING_WRITE_BACK_RANGES > 0 && WEAR_LEVELING_WRITE_BACK_RANGES <= UINT8_MAX, "Write-back range count must be between 1 and 255");
+#endif // WEAR_LEVELING_WRITE_BACK
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
@@ -88,6 +100,16 @@ typedef union write_log_entry_t {
 
 _Static_assert(sizeof(write_log_entry_t) == 8, "Wear leveling write log entry size was not 8");
 
+#ifdef WEAR_LEVELING_WRITE_BACK
+/**
+ * Helper type used to track a range of logical data which has not yet been written to the write log.
+ */
+typedef struct wear_leveling_dirty_range_t {
+    uint32_t start; // First dirty address
+    uint32_t end;   // One past the last dirty address
+} wear_leveling_dirty_range_t;
+#endif // WEAR_LEVELING_WRITE_BACK
+
 /**
  * Log entry type discriminator.
  */
@@ -0,0 +1,8 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "color.h"
+
+RGB reference_hsv_to_rgb_impl(HSV hsv, bool use_cie);
@@ -0,0 +1,48 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "reference_color.h"
+RGB hsv_to_rgb_impl(HSV hsv, bool use_cie);
+}
+
+static uint32_t pack(RGB rgb) {
+    return (rgb.r << 16) | (rgb.g << 8) | rgb.b;
+}
+
+static HSV unpack(uint32_t i) {
+    return (HSV){.h = (uint8_t)(i >> 16), .s = (uint8_t)(i >> 8), .v = (uint8_t)i};
+}
+
+TEST(Color, MatchesReferenceForEveryInput) {
+    for (bool use_cie : {false, true}) {
+        uint32_t mismatches = 0;
+        for (uint32_t i = 0; i < (1UL << 24); i++) {
+            HSV hsv = unpack(i);
+            if (pack(hsv_to_rgb_impl(hsv, use_cie)) != pack(reference_hsv_to_rgb_impl(hsv, use_cie))) {
+                if (mismatches++ < 10) {
+                    ADD_FAILURE() << "h=" << +hsv.h << " s=" << +hsv.s << " v=" << +hsv.v << " cie=" << use_cie;
+                }
+            }
+        }
+        EXPECT_EQ(mismatches, 0u);
+    }
+}
+
+TEST(Color, Benchmark) {
+    using clock = std::chrono::steady_clock;
+    for (auto convert : {&reference_hsv_to_rgb_impl, &hsv_to_rgb_impl}) {
+        uint32_t checksum = 0;
+        auto     begin    = clock::now();
+        for (uint32_t i = 0; i < (1UL << 24); i++) {
+            checksum += pack(convert(unpack(i), true));
+        }
+        std::chrono::duration<double, std::nano> elapsed = clock::now() - begin;
+        std::cout << (convert == &hsv_to_rgb_impl ? "hsv_to_rgb_impl: " : "reference: ") << elapsed.count() / (1UL << 24) << " ns/pixel (checksum " << checksum << ")" << std::endl;
+    }
+}
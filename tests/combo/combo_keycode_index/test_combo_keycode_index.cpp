@@ -0,0 +1,119 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include "keyboard_report_util.hpp"
+extern "C" {
+#include "quantum.h"
+}
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+#include "test_combos.h"
+
+static uint16_t test_combo_count = TEST_COMBO_COUNT;
+
+/* Overrides the introspection default so that only the first N combos are in use. */
+extern "C" uint16_t combo_count(void) {
+    return test_combo_count;
+}
+
+class ComboKeycodeIndex : public TestFixture {};
+
+TEST_F(ComboKeycodeIndex, combo_modtest_tapped) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_u(0, 0, 2, KC_U);
+    set_keymap({key_y, key_u});
+
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, combo_modtest_held_longer_than_tapping_term) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_u(0, 0, 2, KC_U);
+    set_keymap({key_y, key_u});
+
+    EXPECT_REPORT(driver, (KC_RIGHT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u}, TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, combo_osmshift_tapped) {
+    TestDriver driver;
+    KeymapKey  key_z(0, 0, 1, KC_Z);
+    KeymapKey  key_x(0, 0, 2, KC_X);
+    KeymapKey  key_i(0, 0, 3, KC_I);
+    set_keymap({key_z, key_x, key_i});
+
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key_z, key_x});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_I, KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_i);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeycodeIndex, partial_combo_is_released) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_u(0, 0, 2, KC_U);
+    KeymapKey  key_i(0, 0, 3, KC_I);
+    set_keymap({key_y, key_u, key_i});
+
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_REPORT(driver, (KC_Y, KC_I));
+    EXPECT_REPORT(driver, (KC_I));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_i});
+    VERIFY_AND_CLEAR(driver);
+
+    /* The half pressed combo must have been reset */
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u});
+    VERIFY_AND_CLEAR(driver);
+}
+
+class ComboKeycodeIndexBenchmark : public TestFixture, public testing::WithParamInterface<uint16_t> {};
+
+TEST_P(ComboKeycodeIndexBenchmark, taps) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_u(0, 0, 2, KC_U);
+    set_keymap({key_y, key_u});
+    const int iterations = 1000;
+
+    test_combo_count = GetParam();
+    combo_index_build();
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        /* combo key that doesn't complete a combo */
+        tap_key(key_y);
+    }
+    auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    std::cout << test_combo_count << " combos: " << elapsed / iterations << " us per tap" << std::endl;
+
+    test_combo_count = TEST_COMBO_COUNT;
+    combo_index_build();
+    VERIFY_AND_CLEAR(driver);
+}
+
+INSTANTIATE_TEST_CASE_P(ComboCount, ComboKeycodeIndexBenchmark, testing::Values(16, 128, 512));
@@ -0,0 +1,19 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+#include "test_combos.h"
+
+enum combos { modtest, osmshift };
+
+uint16_t const modtest_combo[]  = {KC_Y, KC_U, COMBO_END};
+uint16_t const osmshift_combo[] = {KC_Z, KC_X, COMBO_END};
+uint16_t const filler_combo[]   = {QK_USER_0, QK_USER_1, COMBO_END};
+
+// clang-format off
+combo_t key_combos[TEST_COMBO_COUNT] = {
+    [modtest]                      = COMBO(modtest_combo, RSFT_T(KC_SPACE)),
+    [osmshift]                     = COMBO(osmshift_combo, OSM(MOD_LSFT)),
+    [2 ... TEST_COMBO_COUNT - 1]   = COMBO(filler_combo, KC_NO)
+};
+// clang-format on
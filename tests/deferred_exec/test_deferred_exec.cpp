@@ -0,0 +1,250 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define TABLE_SIZE DEFERRED_EXEC_MAX_TABLE_COUNT
+
+static deferred_executor_t table[TABLE_SIZE];
+static uint32_t            last_execution_time;
+
+/* Records each invocation, and returns the repeat delay stored in the callback argument. */
+struct invocation {
+    int      id;
+    uint32_t trigger_time;
+    uint32_t now;
+};
+
+static std::vector<invocation> invocations;
+
+struct timer_arg {
+    int      id;
+    uint32_t repeat_ms;
+};
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    timer_arg *arg = (timer_arg *)cb_arg;
+    invocations.push_back({arg->id, trigger_time, timer_read32()});
+    return arg->repeat_ms;
+}
+
+class DeferredExec : public testing::Test {
+   protected:
+    void SetUp() override {
+        memset(table, 0, sizeof(table));
+        last_execution_time = 0;
+        invocations.clear();
+        set_time(1000);
+    }
+
+    deferred_token defer(size_t count, uint32_t delay_ms, timer_arg *arg) {
+        return defer_exec_advanced(table, count, delay_ms, record_callback, arg);
+    }
+
+    void run_for(size_t count, uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, count, &last_execution_time);
+        }
+    }
+};
+
+TEST_F(DeferredExec, RunsInTriggerOrder) {
+    timer_arg args[] = {{0, 0}, {1, 0}, {2, 0}, {3, 0}};
+    EXPECT_NE(defer(8, 30, &args[0]), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer(8, 10, &args[1]), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer(8, 20, &args[2]), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer(8, 10, &args[3]), INVALID_DEFERRED_TOKEN);
+    run_for(8, 50);
+
+    ASSERT_EQ(invocations.size(), 4u);
+    EXPECT_EQ(invocations[0].now, 1010u);
+    EXPECT_EQ(invocations[1].now, 1010u);
+    EXPECT_EQ(invocations[2].id, 2);
+    EXPECT_EQ(invocations[2].now, 1020u);
+    EXPECT_EQ(invocations[3].id, 0);
+    EXPECT_EQ(invocations[3].now, 1030u);
+}
+
+TEST_F(DeferredExec, RepeatsFromPreviousTrigger) {
+    timer_arg arg = {0, 25};
+    defer(8, 10, &arg);
+    run_for(8, 100);
+
+    ASSERT_EQ(invocations.size(), 4u);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(invocations[i].trigger_time, 1010u + i * 25);
+    }
+}
+
+TEST_F(DeferredExec, FallingBehindRunsOncePerPass) {
+    timer_arg arg = {0, 5};
+    defer(8, 5, &arg);
+    advance_time(100);
+    deferred_exec_advanced_task(table, 8, &last_execution_time);
+    EXPECT_EQ(invocations.size(), 1u);
+    run_for(8, 1);
+    EXPECT_EQ(invocations.size(), 2u);
+}
+
+TEST_F(DeferredExec, ExtendAndCancel) {
+    timer_arg      args[] = {{0, 0}, {1, 0}, {2, 0}};
+    deferred_token a      = defer(8, 10, &args[0]);
+    deferred_token b      = defer(8, 20, &args[1]);
+    deferred_token c      = defer(8, 30, &args[2]);
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, 8, a, 40));
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 8, b));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 8, b));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, 8, b, 10));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 8, INVALID_DEFERRED_TOKEN));
+    run_for(8, 50);
+
+    ASSERT_EQ(invocations.size(), 2u);
+    EXPECT_EQ(invocations[0].id, 2);
+    EXPECT_EQ(invocations[1].id, 0);
+    EXPECT_EQ(invocations[1].now, 1040u);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 8, c));
+}
+
+TEST_F(DeferredExec, StaleTokenRejectedAfterReuse) {
+    timer_arg      arg   = {0, 0};
+    deferred_token first = defer(1, 10, &arg);
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 1, first));
+    deferred_token second = defer(1, 10, &arg);
+    EXPECT_NE(second, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(second, first);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 1, first));
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 1, second));
+}
+
+TEST_F(DeferredExec, TableFull) {
+    timer_arg arg = {0, 0};
+    for (int i = 0; i < 8; i++) {
+        EXPECT_NE(defer(8, 10 + i, &arg), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer(8, 10, &arg), INVALID_DEFERRED_TOKEN);
+    run_for(8, 10);
+    EXPECT_NE(defer(8, 10, &arg), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer(8, 10, &arg), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, InvalidArguments) {
+    timer_arg arg = {0, 0};
+    EXPECT_EQ(defer_exec_advanced(NULL, 8, 10, record_callback, &arg), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(table, 0, 10, record_callback, &arg), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(table, TABLE_SIZE + 1, 10, record_callback, &arg), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(table, 8, 0, record_callback, &arg), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(table, 8, 10, NULL, &arg), INVALID_DEFERRED_TOKEN);
+}
+
+static deferred_token requeue_token;
+
+static uint32_t requeue_callback(uint32_t trigger_time, void *cb_arg) {
+    timer_arg *arg = (timer_arg *)cb_arg;
+    invocations.push_back({arg->id, trigger_time, timer_read32()});
+    cancel_deferred_exec_advanced(table, 8, requeue_token);
+    requeue_token = defer_exec_advanced(table, 8, 7, record_callback, cb_arg);
+    return 100;
+}
+
+TEST_F(DeferredExec, CallbackRequeuesItself) {
+    timer_arg arg = {0, 0};
+    requeue_token = defer_exec_advanced(table, 8, 5, requeue_callback, &arg);
+    run_for(8, 20);
+
+    ASSERT_EQ(invocations.size(), 2u);
+    EXPECT_EQ(invocations[0].now, 1005u);
+    EXPECT_EQ(invocations[1].now, 1012u);
+}
+
+/* Compares a random mix of operations on a full size table against a simple model. */
+TEST_F(DeferredExec, MatchesModel) {
+    std::mt19937                         rng(42);
+    std::vector<timer_arg>               args(TABLE_SIZE * 4);
+    std::map<deferred_token, timer_arg*> pending;
+    std::multimap<uint32_t, int>         expected;
+
+    for (int round = 0; round < 2000; round++) {
+        int op = rng() % 4;
+        if (op < 2) {
+            timer_arg *    arg   = &args[rng() % args.size()];
+            deferred_token token = defer(TABLE_SIZE, 1 + rng() % 50, arg);
+            if (pending.size() < TABLE_SIZE) {
+                ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+                ASSERT_EQ(pending.count(token), 0u);
+                pending[token] = arg;
+            } else {
+                ASSERT_EQ(token, INVALID_DEFERRED_TOKEN);
+            }
+        } else if (op == 2 && !pending.empty()) {
+            auto it = pending.begin();
+            std::advance(it, rng() % pending.size());
+            ASSERT_TRUE(cancel_deferred_exec_advanced(table, TABLE_SIZE, it->first));
+            pending.erase(it);
+        } else {
+            size_t before = invocations.size();
+            run_for(TABLE_SIZE, 1 + rng() % 5);
+            for (size_t i = before; i < invocations.size(); i++) {
+                ASSERT_LE(invocations[i].trigger_time, invocations[i].now);
+                if (i > before && invocations[i].now == invocations[i - 1].now) {
+                    ASSERT_GE(invocations[i].trigger_time, invocations[i - 1].trigger_time);
+                }
+            }
+            // Everything due has run, so the tokens are no longer valid
+            for (auto it = pending.begin(); it != pending.end();) {
+                if (!extend_deferred_exec_advanced(table, TABLE_SIZE, it->first, 1 + rng() % 50)) {
+                    it = pending.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+    }
+}
+
+/* Reports the cost of the task when nothing is due, and of scheduling and cancelling, for a number of pending timers. */
+TEST_F(DeferredExec, Throughput) {
+    const int iterations = 20000;
+    timer_arg arg        = {0, 0};
+
+    for (size_t pending : {8, 64, 256}) {
+        memset(table, 0, sizeof(table));
+        last_execution_time = 0;
+        std::vector<deferred_token> tokens;
+        for (size_t i = 0; i < pending; i++) {
+            tokens.push_back(defer(pending, 1000000 + i * 37 % 101, &arg));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, pending, &last_execution_time);
+        }
+        double idle_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+        // Cancel and re-add one timer at a time, as tap-dance and animations do when a key is pressed
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            size_t index = i % pending;
+            cancel_deferred_exec_advanced(table, pending, tokens[index]);
+            tokens[index] = defer(pending, 1000000 + i % 101, &arg);
+        }
+        double churn_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+        EXPECT_TRUE(invocations.empty());
+        std::cout << pending << " pending: " << idle_ns << "ns per idle task, " << churn_ns << "ns per cancel and defer" << std::endl;
+    }
+}
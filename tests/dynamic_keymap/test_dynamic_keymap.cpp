@@ -0,0 +1,147 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "keymap_introspection.h"
+#include "eeprom.h"
+}
+
+class DynamicKeymap : public TestFixture {
+   public:
+    void SetUp() override {
+        dynamic_keymap_reset();
+        dynamic_keymap_init();
+    }
+
+    /* Reads a keycode straight from EEPROM, the way uncached lookups do. */
+    static uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t col) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, col);
+        return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+    }
+};
+
+TEST_F(DynamicKeymap, SetKeycodeWritesThrough) {
+    dynamic_keymap_set_keycode(1, 2, 3, KC_B);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), KC_B);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_B);
+}
+
+TEST_F(DynamicKeymap, LookupsAreServedFromRam) {
+    dynamic_keymap_set_keycode(0, 0, 0, KC_A);
+
+    /* Change EEPROM behind the cache's back, lookups must not see it until reloaded. */
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(0, 0, 0);
+    eeprom_update_byte(address + 1, KC_Z);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_A);
+
+    dynamic_keymap_init();
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_Z);
+}
+
+TEST_F(DynamicKeymap, SetBufferRefreshesCache) {
+    /* Big endian keycodes for (0,1,0) and (0,1,1) */
+    uint8_t data[] = {0x00, KC_C, 0x00, KC_D};
+    dynamic_keymap_set_buffer(MATRIX_COLS * 2, sizeof(data), data);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 0), KC_C);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 1), KC_D);
+}
+
+TEST_F(DynamicKeymap, MisalignedSetBufferRefreshesCache) {
+    dynamic_keymap_set_keycode(0, 1, 0, 0x1234);
+    dynamic_keymap_set_keycode(0, 1, 1, 0x5678);
+
+    /* Low byte of (0,1,0) and high byte of (0,1,1) */
+    uint8_t data[] = {0xAB, 0xCD};
+    dynamic_keymap_set_buffer(MATRIX_COLS * 2 + 1, sizeof(data), data);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 0), 0x12AB);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 1), 0xCD78);
+}
+
+TEST_F(DynamicKeymap, ResetRestoresCache) {
+    dynamic_keymap_set_keycode(0, 3, 9, KC_E);
+    dynamic_keymap_reset();
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 3, 9), keycode_at_keymap_location_raw(0, 3, 9));
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 3, 9), eeprom_keycode(0, 3, 9));
+}
+
+TEST_F(DynamicKeymap, BufferTransfersAreClampedToTheKeymap) {
+    const uint16_t keymap_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    dynamic_keymap_set_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1, 0x1234);
+
+    /* Reads past the end come back as zero */
+    uint8_t data[6];
+    memset(data, 0xAA, sizeof(data));
+    dynamic_keymap_get_buffer(keymap_size - 2, sizeof(data), data);
+    const uint8_t expected[] = {0x12, 0x34, 0x00, 0x00, 0x00, 0x00};
+    EXPECT_EQ(memcmp(data, expected, sizeof(expected)), 0);
+
+    /* Writes past the end leave whatever follows the keymap alone */
+    uint8_t macro_before[4];
+    dynamic_keymap_macro_get_buffer(0, sizeof(macro_before), macro_before);
+    const uint8_t update[] = {0x56, 0x78, 0xDE, 0xAD, 0xBE, 0xEF};
+    dynamic_keymap_set_buffer(keymap_size - 2, sizeof(update), (uint8_t *)update);
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1), 0x5678);
+
+    uint8_t macro_after[4];
+    dynamic_keymap_macro_get_buffer(0, sizeof(macro_after), macro_after);
+    EXPECT_EQ(memcmp(macro_before, macro_after, sizeof(macro_after)), 0);
+}
+
+TEST_F(DynamicKeymap, MacroBufferRoundTrip) {
+    const uint8_t macros[] = {'a', 0, 'b', 'c', 0};
+    dynamic_keymap_macro_set_buffer(0, sizeof(macros), (uint8_t *)macros);
+
+    uint8_t readback[sizeof(macros)];
+    dynamic_keymap_macro_get_buffer(0, sizeof(readback), readback);
+    EXPECT_EQ(memcmp(readback, macros, sizeof(macros)), 0);
+
+    dynamic_keymap_macro_reset();
+    dynamic_keymap_macro_get_buffer(0, sizeof(readback), readback);
+    for (uint8_t byte : readback) {
+        EXPECT_EQ(byte, 0);
+    }
+}
+
+TEST_F(DynamicKeymap, LookupBenchmark) {
+    const int iterations = 1000;
+    uint32_t  checksum   = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (uint8_t layer = DYNAMIC_KEYMAP_LAYER_COUNT; layer-- > 0;) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    checksum += eeprom_keycode(layer, row, col);
+                }
+            }
+        }
+    }
+    auto eeprom_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (uint8_t layer = DYNAMIC_KEYMAP_LAYER_COUNT; layer-- > 0;) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    checksum -= dynamic_keymap_get_keycode(layer, row, col);
+                }
+            }
+        }
+    }
+    auto cache_time = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(checksum, 0);
+
+    const int lookups = iterations * DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS;
+    std::cout << "eeprom lookup: " << std::chrono::duration<double, std::nano>(eeprom_time).count() / lookups << " ns" << std::endl;
+    std::cout << "cached lookup: " << std::chrono::duration<double, std::nano>(cache_time).count() / lookups << " ns" << std::endl;
+}
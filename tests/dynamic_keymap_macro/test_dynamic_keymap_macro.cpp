@@ -0,0 +1,173 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "send_string.h"
+}
+
+using testing::_;
+using testing::InSequence;
+using testing::Invoke;
+
+class DynamicKeymapMacro : public TestFixture {
+   public:
+    void SetUp() override {
+        dynamic_keymap_macro_reset();
+    }
+
+    /* Lays out the given macros back to back, NUL terminated, as a host would upload them. */
+    static void upload(const std::vector<std::string> &macros) {
+        std::vector<uint8_t> buffer;
+        for (const auto &macro : macros) {
+            buffer.insert(buffer.end(), macro.begin(), macro.end());
+            buffer.push_back(0);
+        }
+        buffer.resize(dynamic_keymap_macro_get_buffer_size(), 0);
+        /* Same 28 byte transfers as the VIA protocol */
+        for (uint16_t offset = 0; offset < buffer.size(); offset += 28) {
+            dynamic_keymap_macro_set_buffer(offset, 28, &buffer[offset]);
+        }
+    }
+
+    /* Records every keyboard report sent while running `send`. */
+    std::vector<std::vector<uint8_t>> record(TestDriver &driver, void (*send)(const void *), const void *arg) {
+        std::vector<std::vector<uint8_t>> reports;
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&reports](report_keyboard_t &report) {
+            const uint8_t *bytes = (const uint8_t *)&report;
+            reports.emplace_back(bytes, bytes + sizeof(report));
+        }));
+        send(arg);
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        return reports;
+    }
+
+    std::vector<std::vector<uint8_t>> record_macro(TestDriver &driver, uint8_t id) {
+        return record(
+            driver, [](const void *arg) { dynamic_keymap_macro_send(*(const uint8_t *)arg); }, &id);
+    }
+
+    std::vector<std::vector<uint8_t>> record_string(TestDriver &driver, const std::string &string) {
+        return record(
+            driver, [](const void *arg) { send_string(((const std::string *)arg)->c_str()); }, &string);
+    }
+};
+
+TEST_F(DynamicKeymapMacro, PlainTextMacro) {
+    TestDriver driver;
+    InSequence s;
+    upload({"", "ab"});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    dynamic_keymap_macro_send(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, MixedMacroMatchesSendString) {
+    TestDriver driver;
+    const std::string macro = "Hello" SS_TAP(X_ENTER) SS_DOWN(X_LSFT) "abc" SS_UP(X_LSFT) "World!";
+    upload({"x", macro, "y"});
+
+    EXPECT_EQ(record_macro(driver, 1), record_string(driver, macro));
+}
+
+TEST_F(DynamicKeymapMacro, MacroSpanningChunksMatchesSendString) {
+    TestDriver driver;
+    std::string macro;
+    for (int i = 0; i < 10; i++) {
+        macro += "the quick brown fox " SS_TAP(X_TAB);
+    }
+    upload({"", "", macro});
+
+    EXPECT_EQ(record_macro(driver, 2), record_string(driver, macro));
+}
+
+TEST_F(DynamicKeymapMacro, LastMacroInFullBuffer) {
+    TestDriver driver;
+    std::vector<std::string> macros;
+    const uint16_t           filler = (dynamic_keymap_macro_get_buffer_size() - 64) / (DYNAMIC_KEYMAP_MACRO_COUNT - 1) - 1;
+    for (int i = 0; i < DYNAMIC_KEYMAP_MACRO_COUNT - 1; i++) {
+        macros.push_back(std::string(filler, 'z'));
+    }
+    macros.push_back("qmk");
+    upload(macros);
+
+    EXPECT_EQ(record_macro(driver, DYNAMIC_KEYMAP_MACRO_COUNT - 1), record_string(driver, "qmk"));
+}
+
+TEST_F(DynamicKeymapMacro, RewritingBufferRebuildsIndex) {
+    TestDriver driver;
+    upload({"a", "b"});
+    EXPECT_EQ(record_macro(driver, 1), record_string(driver, "b"));
+
+    upload({"aaaa", "c"});
+    EXPECT_EQ(record_macro(driver, 1), record_string(driver, "c"));
+
+    dynamic_keymap_macro_reset();
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, IncompleteBufferSendsNothing) {
+    TestDriver driver;
+    upload({"a", "b"});
+
+    /* A transfer in progress leaves the last byte set */
+    uint8_t busy = 1;
+    dynamic_keymap_macro_set_buffer(dynamic_keymap_macro_get_buffer_size() - 1, 1, &busy);
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, MissingMacroSendsNothing) {
+    TestDriver driver;
+    upload({std::string(dynamic_keymap_macro_get_buffer_size() - 1, 'a')});
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(1);
+    dynamic_keymap_macro_send(DYNAMIC_KEYMAP_MACRO_COUNT - 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, TimeToFirstReport) {
+    TestDriver driver;
+    std::vector<std::string> macros;
+    const uint16_t           filler = (dynamic_keymap_macro_get_buffer_size() - 64) / (DYNAMIC_KEYMAP_MACRO_COUNT - 1) - 1;
+    for (int i = 0; i < DYNAMIC_KEYMAP_MACRO_COUNT - 1; i++) {
+        macros.push_back(std::string(filler, 'z'));
+    }
+    macros.push_back("a");
+    upload(macros);
+
+    using clock = std::chrono::steady_clock;
+    const int          iterations = 1000;
+    clock::time_point  start;
+    clock::duration    first_report{0};
+    bool               seen = false;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&](report_keyboard_t &) {
+        if (!seen) {
+            first_report += clock::now() - start;
+            seen = true;
+        }
+    }));
+    for (int i = 0; i < iterations; i++) {
+        seen  = false;
+        start = clock::now();
+        dynamic_keymap_macro_send(DYNAMIC_KEYMAP_MACRO_COUNT - 1);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    std::cout << "last macro of " << dynamic_keymap_macro_get_buffer_size() << " byte buffer: " << std::chrono::duration_cast<std::chrono::nanoseconds>(first_report).count() / iterations << " ns to first report" << std::endl;
+}
@@ -0,0 +1,115 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerResolutionCache : public TestFixture {};
+
+TEST_F(LayerResolutionCache, FollowsLayerState) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(2, 0, 0, KC_B)});
+
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 2);
+    layer_off(2);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    /* Direct assignment bypasses layer_state_set() */
+    layer_state = (layer_state_t)1 << 2;
+    EXPECT_EQ(layer_switch_get_layer(key.position), 2);
+    layer_clear();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, InvalidatedOnKeymapChange) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key, KeymapKey(1, 0, 0, KC_TRNS)});
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    set_keymap({key, KeymapKey(1, 0, 0, KC_B)});
+    EXPECT_EQ(layer_switch_get_layer(key.position), 1);
+    layer_clear();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, ReportsResolvedKeycode) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(3, 0, 0, KC_B);
+
+    set_keymap({key_a, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(2, 0, 0, KC_TRNS), key_b});
+
+    layer_on(1);
+    layer_on(2);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+
+    layer_on(3);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    layer_clear();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+class LayerResolutionCacheBenchmark : public TestFixture, public testing::WithParamInterface<uint8_t> {};
+
+TEST_P(LayerResolutionCacheBenchmark, Events) {
+    TestDriver    driver;
+    const uint8_t active_layers = GetParam();
+    const int     taps          = 2000;
+
+    /* Only layer 0 is opaque, every key has to fall through all active layers */
+    keymap.clear();
+    for (uint8_t layer = 0; layer < active_layers; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                add_key(KeymapKey(layer, col, row, layer == 0 ? KC_A : KC_TRNS));
+            }
+        }
+    }
+    layer_state_set((layer_state_t)(((uint64_t)1 << active_layers) - 1));
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AnyNumber());
+
+    /* Press and release every key in turn through the scan loop */
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < taps; i++) {
+        auto key = KeymapKey(0, i % MATRIX_COLS, (i / MATRIX_COLS) % MATRIX_ROWS, KC_A);
+        key.press();
+        run_one_scan_loop();
+        key.release();
+        run_one_scan_loop();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+#ifdef LAYER_RESOLUTION_CACHE
+    const char *build = "cached";
+#else
+    const char *build = "uncached";
+#endif
+    std::cout << +active_layers << " active layers: " << taps * 2 / elapsed << " events/s " << build << std::endl;
+    layer_clear();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+INSTANTIATE_TEST_CASE_P(ActiveLayers, LayerResolutionCacheBenchmark, testing::Values(1, 8, 32));
@@ -0,0 +1,5 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Same tests and benchmark without the cache, as a baseline
+SRC += tests/layer_resolution_cache/test_layer_resolution_cache.cpp
@@ -0,0 +1,137 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdlib>
+#include <iostream>
+
+#include "gtest/gtest.h"
+#include "../led_driver_test_device.hpp"
+
+extern "C" {
+#include "is31fl3733.h"
+}
+
+// Each group of 16 LEDs spans three SW rows, so one LED touches three
+// 16 byte PWM chunks, the same as a typical keyboard layout.
+#define TEST_LED(group, cs) \
+    { 0, (uint8_t)(((group)*3 + 0) * 16 + (cs)), (uint8_t)(((group)*3 + 1) * 16 + (cs)), (uint8_t)(((group)*3 + 2) * 16 + (cs)) }
+#define TEST_LED_GROUP(group) \
+    TEST_LED(group, 0), TEST_LED(group, 1), TEST_LED(group, 2), TEST_LED(group, 3), TEST_LED(group, 4), TEST_LED(group, 5), TEST_LED(group, 6), TEST_LED(group, 7), TEST_LED(group, 8), TEST_LED(group, 9), TEST_LED(group, 10), TEST_LED(group, 11), TEST_LED(group, 12), TEST_LED(group, 13), TEST_LED(group, 14), TEST_LED(group, 15)
+
+const is31fl3733_led_t PROGMEM g_is31fl3733_leds[IS31FL3733_LED_COUNT] = {
+    TEST_LED_GROUP(0),
+    TEST_LED_GROUP(1),
+    TEST_LED_GROUP(2),
+    TEST_LED_GROUP(3),
+};
+
+namespace {
+
+// Command register writes for a page select: unlock + page, 2 bytes each.
+constexpr uint32_t page_select_bytes = 2 * 2;
+// Register address + 16 PWM values.
+constexpr uint32_t chunk_bytes = 1 + 16;
+constexpr uint32_t full_flush_bytes = page_select_bytes + 12 * chunk_bytes;
+
+class IS31FL3733 : public ::testing::Test {
+   protected:
+    LedDriverTestDevice device{IS31FL3733_I2C_ADDRESS_1};
+    uint8_t             expected[IS31FL3733_LED_COUNT][3] = {};
+
+    void SetUp() override {
+        is31fl3733_init_drivers();
+        // Start every test from a black frame the driver has already flushed.
+        is31fl3733_set_color_all(1, 1, 1);
+        is31fl3733_flush();
+        is31fl3733_set_color_all(0, 0, 0);
+        is31fl3733_flush();
+        device.take_bytes();
+    }
+
+    void set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+        is31fl3733_set_color(index, red, green, blue);
+        expected[index][0] = red;
+        expected[index][1] = green;
+        expected[index][2] = blue;
+    }
+
+    void expect_device_matches() {
+        const uint8_t *pwm = device.page(IS31FL3733_COMMAND_PWM);
+        for (int i = 0; i < IS31FL3733_LED_COUNT; i++) {
+            is31fl3733_led_t led = g_is31fl3733_leds[i];
+            EXPECT_EQ(pwm[led.r], expected[i][0]) << "LED " << i;
+            EXPECT_EQ(pwm[led.g], expected[i][1]) << "LED " << i;
+            EXPECT_EQ(pwm[led.b], expected[i][2]) << "LED " << i;
+        }
+    }
+};
+
+} // namespace
+
+TEST_F(IS31FL3733, UnchangedFrameSendsNothing) {
+    is31fl3733_flush();
+    EXPECT_EQ(device.take_bytes(), 0u);
+
+    set_color(5, 0, 0, 0);
+    is31fl3733_flush();
+    EXPECT_EQ(device.take_bytes(), 0u);
+}
+
+TEST_F(IS31FL3733, SingleLedSendsOnlyItsChunks) {
+    set_color(5, 10, 20, 30);
+    is31fl3733_flush();
+    EXPECT_EQ(device.take_bytes(), page_select_bytes + 3 * chunk_bytes);
+    expect_device_matches();
+}
+
+TEST_F(IS31FL3733, LedsSharingChunksAreSentOnce) {
+    set_color(0, 10, 20, 30);
+    set_color(15, 40, 50, 60);
+    set_color(16, 70, 80, 90);
+    is31fl3733_flush();
+    EXPECT_EQ(device.take_bytes(), page_select_bytes + 6 * chunk_bytes);
+    expect_device_matches();
+}
+
+TEST_F(IS31FL3733, AllLedsSendsFullBuffer) {
+    is31fl3733_set_color_all(1, 2, 3);
+    for (int i = 0; i < IS31FL3733_LED_COUNT; i++) {
+        expected[i][0] = 1;
+        expected[i][1] = 2;
+        expected[i][2] = 3;
+    }
+    is31fl3733_flush();
+    EXPECT_EQ(device.take_bytes(), full_flush_bytes);
+    expect_device_matches();
+}
+
+TEST_F(IS31FL3733, RandomFramesKeepDeviceInSync) {
+    srand(1337);
+    for (int frame = 0; frame < 200; frame++) {
+        int changes = rand() % 8;
+        for (int i = 0; i < changes; i++) {
+            set_color(rand() % IS31FL3733_LED_COUNT, rand() & 0xFF, rand() & 0xFF, rand() & 0xFF);
+        }
+        is31fl3733_flush();
+        ASSERT_LE(device.take_bytes(), full_flush_bytes);
+        expect_device_matches();
+    }
+}
+
+TEST_F(IS31FL3733, ReactiveFrameBytes) {
+    // A keypress lighting up a small cluster of neighbouring LEDs.
+    uint32_t total  = 0;
+    int      frames = 0;
+    for (uint8_t v = 255; v > 0; v -= 15, frames++) {
+        set_color(20, v, v, v);
+        set_color(21, v / 2, v / 2, v / 2);
+        set_color(19, v / 2, v / 2, v / 2);
+        is31fl3733_flush();
+        total += device.take_bytes();
+    }
+    expect_device_matches();
+
+    uint32_t per_frame = total / frames;
+    std::cout << "IS31FL3733 reactive frame: " << per_frame << " bytes (full buffer " << full_flush_bytes << " bytes)" << std::endl;
+    EXPECT_EQ(per_frame, page_select_bytes + 3 * chunk_bytes);
+}
@@ -0,0 +1,8 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+SRC += \
+	drivers/led/issi/is31fl3741.c \
+	platforms/test/drivers/i2c_master.c
+
+COMMON_VPATH += $(DRIVER_PATH)/led/issi
@@ -0,0 +1,98 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "../led_driver_test_device.hpp"
+
+extern "C" {
+#include "is31fl3741.h"
+
+// Not part of the public header, but exported by the driver.
+void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value);
+}
+
+const is31fl3741_led_t PROGMEM g_is31fl3741_leds[IS31FL3741_LED_COUNT] = {
+    {0, SW1_CS1, SW2_CS1, SW3_CS1},    // PWM page 0 only
+    {0, SW7_CS1, SW8_CS1, SW9_CS1},    // PWM page 1 only
+    {0, SW1_CS31, SW1_CS32, SW1_CS33}, // PWM page 1, single chunk
+    {0, SW6_CS30, SW7_CS30, SW8_CS30}, // Both pages
+};
+
+namespace {
+
+constexpr uint32_t page_select_bytes = 2 * 2;
+constexpr uint32_t chunk_0_bytes     = 1 + 30;
+constexpr uint32_t chunk_1_bytes     = 1 + 19;
+constexpr uint32_t full_flush_bytes  = 2 * page_select_bytes + 6 * chunk_0_bytes + 9 * chunk_1_bytes;
+
+class IS31FL3741 : public ::testing::Test {
+   protected:
+    LedDriverTestDevice device{IS31FL3741_I2C_ADDRESS_1};
+
+    void SetUp() override {
+        is31fl3741_init_drivers();
+        is31fl3741_set_color_all(1, 1, 1);
+        is31fl3741_flush();
+        is31fl3741_set_color_all(0, 0, 0);
+        is31fl3741_flush();
+        device.take_bytes();
+    }
+
+    uint8_t device_pwm(uint16_t reg) {
+        return device.page(reg & 0x100 ? IS31FL3741_COMMAND_PWM_1 : IS31FL3741_COMMAND_PWM_0)[reg & 0xFF];
+    }
+
+    void expect_led(int index, uint8_t red, uint8_t green, uint8_t blue) {
+        is31fl3741_led_t led = g_is31fl3741_leds[index];
+        EXPECT_EQ(device_pwm(led.r), red);
+        EXPECT_EQ(device_pwm(led.g), green);
+        EXPECT_EQ(device_pwm(led.b), blue);
+    }
+};
+
+} // namespace
+
+TEST_F(IS31FL3741, UnchangedFrameSendsNothing) {
+    is31fl3741_flush();
+    EXPECT_EQ(device.take_bytes(), 0u);
+}
+
+TEST_F(IS31FL3741, FirstPageOnly) {
+    is31fl3741_set_color(0, 10, 20, 30);
+    is31fl3741_flush();
+    EXPECT_EQ(device.take_bytes(), page_select_bytes + 3 * chunk_0_bytes);
+    expect_led(0, 10, 20, 30);
+}
+
+TEST_F(IS31FL3741, SecondPageOnly) {
+    // SW7 and SW8 share the first two 19 byte chunks, SW9 lands in the fourth.
+    is31fl3741_set_color(1, 10, 20, 30);
+    is31fl3741_flush();
+    EXPECT_EQ(device.take_bytes(), page_select_bytes + 3 * chunk_1_bytes);
+    expect_led(1, 10, 20, 30);
+
+    is31fl3741_set_color(2, 40, 50, 60);
+    is31fl3741_flush();
+    EXPECT_EQ(device.take_bytes(), page_select_bytes + chunk_1_bytes);
+    expect_led(2, 40, 50, 60);
+}
+
+TEST_F(IS31FL3741, BothPages) {
+    is31fl3741_set_color(3, 10, 20, 30);
+    is31fl3741_flush();
+    EXPECT_EQ(device.take_bytes(), 2 * page_select_bytes + chunk_0_bytes + 2 * chunk_1_bytes);
+    expect_led(3, 10, 20, 30);
+}
+
+TEST_F(IS31FL3741, AllChunks) {
+    for (uint16_t reg = 0; reg < 180; reg++) {
+        set_pwm_value(0, reg, 0xAA);
+    }
+    for (uint16_t reg = 0; reg < 171; reg++) {
+        set_pwm_value(0, 0x100 | reg, 0x55);
+    }
+    is31fl3741_flush();
+    EXPECT_EQ(device.take_bytes(), full_flush_bytes);
+    EXPECT_EQ(device_pwm(SW6_CS30), 0xAA);
+    EXPECT_EQ(device_pwm(SW9_CS39), 0x55);
+}
@@ -0,0 +1,65 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+extern "C" {
+#include "i2c_master.h"
+}
+
+// Models the register file of a paged ISSI style LED driver on the mock
+// I2C bus: writes to the command register select the page that subsequent
+// register writes land in.
+class LedDriverTestDevice {
+   public:
+    static constexpr uint8_t command_register = 0xFD;
+
+    explicit LedDriverTestDevice(uint8_t address) : address_(address) {
+        instance() = this;
+        i2c_test_reset();
+        i2c_test_set_write_callback(&LedDriverTestDevice::on_write);
+    }
+
+    ~LedDriverTestDevice() {
+        i2c_test_set_write_callback(nullptr);
+        instance() = nullptr;
+    }
+
+    const uint8_t* page(uint8_t page) const {
+        return registers_[page];
+    }
+
+    // Returns the number of bytes written to the bus since the last call.
+    uint32_t take_bytes() {
+        uint32_t bytes = i2c_test_get_stats().bytes;
+        i2c_test_reset();
+        return bytes;
+    }
+
+   private:
+    static void on_write(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length) {
+        LedDriverTestDevice* self = instance();
+        if (!self || devaddr != self->address_ << 1) {
+            return;
+        }
+        if (regaddr == command_register) {
+            self->page_ = data[0] & 0x0F;
+            return;
+        }
+        for (uint16_t i = 0; i < length && regaddr + i < 256; i++) {
+            self->registers_[self->page_][regaddr + i] = data[i];
+        }
+    }
+
+    static LedDriverTestDevice*& instance() {
+        static LedDriverTestDevice* device = nullptr;
+        return device;
+    }
+
+    uint8_t address_;
+    uint8_t page_               = 0;
+    uint8_t registers_[16][256] = {};
+};
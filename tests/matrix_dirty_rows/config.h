@@ -0,0 +1,11 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 24
+#define MATRIX_COLS 24
+
+#define DEBUG_MATRIX_SCAN_RATE
+
+#include "test_common.h"
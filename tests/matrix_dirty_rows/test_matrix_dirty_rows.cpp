@@ -0,0 +1,141 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class MatrixDirtyRows : public TestFixture {
+   protected:
+    // Let at least one full scan rate window pass without matrix activity.
+    void settle() {
+        idle_for(2001);
+    }
+
+    // Scan until the next scan rate window is published.
+    void wait_for_scan_rate_window() {
+        uint32_t scans = get_matrix_scan_rate();
+        uint32_t rows  = get_matrix_scan_row_rate();
+        for (unsigned i = 0; i < 1000 && scans == get_matrix_scan_rate() && rows == get_matrix_scan_row_rate(); i++) {
+            run_one_scan_loop();
+        }
+    }
+};
+
+TEST_F(MatrixDirtyRows, KeysOnDistantRowsAndColumnsAreReported) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_first  = KeymapKey(0, 0, 0, KC_A);
+    auto       key_middle = KeymapKey(0, 17, 12, KC_B);
+    auto       key_last   = KeymapKey(0, 23, 23, KC_C);
+
+    set_keymap({key_first, key_middle, key_last});
+
+    key_last.press();
+    EXPECT_REPORT(driver, (key_last.report_code));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_middle.press();
+    EXPECT_REPORT(driver, (key_middle.report_code, key_last.report_code));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_first.press();
+    EXPECT_REPORT(driver, (key_first.report_code, key_middle.report_code, key_last.report_code));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_first.release();
+    key_middle.release();
+    key_last.release();
+    EXPECT_REPORT(driver, (key_middle.report_code, key_last.report_code));
+    EXPECT_REPORT(driver, (key_last.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixDirtyRows, ChangedColumnsInOneRowAreReportedInColumnOrder) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 2, 7, KC_A);
+    auto       key_b = KeymapKey(0, 9, 7, KC_B);
+    auto       key_c = KeymapKey(0, 23, 7, KC_C);
+
+    set_keymap({key_a, key_b, key_c});
+
+    key_c.press();
+    key_a.press();
+    key_b.press();
+    EXPECT_REPORT(driver, (key_a.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    EXPECT_REPORT(driver, (key_b.report_code, key_c.report_code));
+    EXPECT_REPORT(driver, (key_c.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixDirtyRows, RowTouchedButUnchangedProducesNoEvent) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 4, 19, KC_A);
+
+    set_keymap({key});
+
+    key.press();
+    key.release();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixDirtyRows, IdleScansCompareNoRows) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(get_matrix_scan_rate(), 0u);
+    EXPECT_EQ(get_matrix_scan_row_rate(), 0u);
+}
+
+TEST_F(MatrixDirtyRows, OnlyDirtyRowsAreCompared) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 11, 16, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    VERIFY_AND_CLEAR(driver);
+
+    key.press();
+    EXPECT_REPORT(driver, (key.report_code));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    wait_for_scan_rate_window();
+    VERIFY_AND_CLEAR(driver);
+
+    // A full compare would visit every row on every scan
+    EXPECT_EQ(get_matrix_scan_row_rate(), 2u);
+    EXPECT_LT(get_matrix_scan_row_rate(), get_matrix_scan_rate() * MATRIX_ROWS);
+}
@@ -0,0 +1,10 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define OLED_DISPLAY_128X64
+#define OLED_IC OLED_IC_SH1106
+#define OLED_COLUMN_OFFSET 2
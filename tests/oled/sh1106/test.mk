@@ -0,0 +1,9 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+OLED_ENABLE = yes
+OLED_TRANSPORT = i2c
+
+SRC += \
+	platforms/test/drivers/i2c_master.c \
+	tests/oled/ssd1306/test_oled_render.cpp
@@ -0,0 +1,7 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+OLED_ENABLE = yes
+OLED_TRANSPORT = i2c
+
+SRC += platforms/test/drivers/i2c_master.c
@@ -0,0 +1,197 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <iostream>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "oled_driver.h"
+#include "i2c_master.h"
+}
+
+#define GRAM_PAGES 8
+#define GRAM_COLUMNS 132
+
+#define I2C_DATA 0x40
+#define COLUMN_ADDR 0x21
+#define PAGE_ADDR 0x22
+#define PAM_SETCOLUMN_LSB 0x00
+#define PAM_SETCOLUMN_MSB 0x10
+#define PAM_PAGE_ADDR 0xB0
+
+/* Emulates the controller's GRAM, in horizontal addressing mode for the SSD1306 and page addressing mode for the
+ * SH1106, so the result of rendering can be checked. */
+static struct {
+    uint8_t gram[GRAM_PAGES][GRAM_COLUMNS];
+    uint8_t column_start, column_end, page_start, page_end;
+    uint8_t column, page;
+} panel;
+
+static void panel_transmit(uint8_t address, const uint8_t *data, uint16_t length) {
+    // Only the addressing commands sent while rendering are modelled
+#if OLED_IC == OLED_IC_SSD1306
+    if (length == 7 && data[0] == 0x00 && data[1] == COLUMN_ADDR && data[4] == PAGE_ADDR) {
+        panel.column = panel.column_start = data[2];
+        panel.column_end                  = data[3];
+        panel.page = panel.page_start = data[5];
+        panel.page_end                = data[6];
+    }
+#else
+    if (length == 4 && data[0] == 0x00 && (data[1] & 0xF0) == PAM_PAGE_ADDR && (data[2] & 0xF0) == PAM_SETCOLUMN_LSB && (data[3] & 0xF0) == PAM_SETCOLUMN_MSB) {
+        panel.page = panel.page_start = panel.page_end = data[1] & 0x0F;
+        panel.column = panel.column_start = (data[2] & 0x0F) | (data[3] & 0x0F) << 4;
+        panel.column_end                  = GRAM_COLUMNS - 1;
+    }
+#endif
+}
+
+static void panel_write(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length) {
+    ASSERT_EQ(regaddr, I2C_DATA);
+    for (uint16_t i = 0; i < length; i++) {
+        panel.gram[panel.page][panel.column] = data[i];
+        if (panel.column++ == panel.column_end) {
+            panel.column = panel.column_start;
+            if (panel.page++ == panel.page_end) {
+                panel.page = panel.page_start;
+            }
+        }
+    }
+}
+
+static oled_rotation_t test_rotation;
+
+extern "C" oled_rotation_t oled_init_user(oled_rotation_t rotation) {
+    return test_rotation;
+}
+
+class OledRender : public testing::TestWithParam<oled_rotation_t> {
+   protected:
+    void SetUp() override {
+        memset(&panel, 0, sizeof(panel));
+        i2c_test_set_transmit_callback(panel_transmit);
+        i2c_test_set_write_callback(panel_write);
+        test_rotation = GetParam();
+        ASSERT_TRUE(oled_init(test_rotation));
+        oled_render_dirty(true);
+        expect_panel_matches();
+    }
+
+    void TearDown() override {
+        i2c_test_set_transmit_callback(NULL);
+        i2c_test_set_write_callback(NULL);
+    }
+
+    static bool buffer_pixel(uint8_t x, uint8_t y) {
+        uint8_t              width  = (test_rotation & OLED_ROTATION_90) ? OLED_DISPLAY_HEIGHT : OLED_DISPLAY_WIDTH;
+        oled_buffer_reader_t reader = oled_read_raw(x + (y / 8) * width);
+        return *reader.current_element & (1 << (y % 8));
+    }
+
+    static bool panel_pixel(uint8_t x, uint8_t y) {
+        return panel.gram[y / 8][x + OLED_COLUMN_OFFSET] & (1 << (y % 8));
+    }
+
+    void expect_panel_matches() {
+        for (uint8_t x = 0; x < OLED_DISPLAY_WIDTH; x++) {
+            for (uint8_t y = 0; y < OLED_DISPLAY_HEIGHT; y++) {
+                // 90 degree rotation maps the buffer's rows onto the panel's columns
+                bool expected = (test_rotation & OLED_ROTATION_90) ? buffer_pixel(OLED_DISPLAY_HEIGHT - 1 - y, x) : buffer_pixel(x, y);
+                ASSERT_EQ(panel_pixel(x, y), expected) << "at " << (int)x << "," << (int)y;
+            }
+        }
+    }
+
+    /* A typical status display: layer, WPM and lock indicators, where only some of the values change each redraw. */
+    void render_status(int frame) {
+        char line[32];
+        oled_set_cursor(0, 0);
+        oled_write_ln((frame / 8) % 2 ? "Layer: Raise" : "Layer: Base", false);
+        snprintf(line, sizeof(line), "WPM: %3d", 40 + (frame * 7) % 60);
+        oled_write_ln(line, false);
+        oled_write("CAPS", (frame / 4) % 2);
+        oled_write(" NUM", false);
+        oled_write_ln((frame / 16) % 2 ? " SCRL" : "", false);
+    }
+
+    /* A full page of text replacing another, as when switching between status pages. */
+    void render_page(int frame) {
+        oled_set_cursor(0, 0);
+        for (uint8_t line = 0; line < oled_max_lines(); line++) {
+            for (uint8_t col = 0; col < oled_max_chars(); col++) {
+                oled_write_char('A' + (frame + line + col) % 26, false);
+            }
+        }
+    }
+
+    struct redraw_stats {
+        double transfers;
+        double bytes;
+    };
+
+    redraw_stats run_redraws(bool full_page, int frames, bool render_all) {
+        i2c_test_reset();
+        for (int frame = 0; frame < frames; frame++) {
+            if (full_page) {
+                render_page(frame);
+            } else {
+                render_status(frame);
+            }
+            if (render_all) {
+                oled_render_dirty(true);
+            } else {
+                // As oled_task() would over following loops, until everything has been sent
+                for (int i = 0; i < OLED_BLOCK_COUNT; i++) {
+                    oled_render_dirty(false);
+                }
+            }
+            expect_panel_matches();
+        }
+        i2c_test_stats_t stats = i2c_test_get_stats();
+        return {(double)stats.transfers / frames, (double)stats.bytes / frames};
+    }
+};
+
+TEST_P(OledRender, Clear) {
+    oled_write("Hello", false);
+    oled_render_dirty(true);
+    expect_panel_matches();
+    oled_clear();
+    oled_render_dirty(true);
+    expect_panel_matches();
+}
+
+TEST_P(OledRender, Pixels) {
+    for (uint8_t i = 0; i < 128; i += 3) {
+        oled_write_pixel(i % oled_max_chars() * 6, i / 2, true);
+        oled_render_dirty(false);
+    }
+    oled_render_dirty(true);
+    expect_panel_matches();
+}
+
+TEST_P(OledRender, InvertedText) {
+    oled_write_ln("Inverted", true);
+    oled_write_ln("Normal", false);
+    oled_render_dirty(true);
+    expect_panel_matches();
+
+    // Rewriting the same text leaves nothing to send
+    i2c_test_reset();
+    oled_set_cursor(0, 0);
+    oled_write_ln("Inverted", true);
+    oled_write_ln("Normal", false);
+    oled_render_dirty(true);
+    EXPECT_EQ(i2c_test_get_stats().transfers, 0u);
+}
+
+/* Reports the I2C transfers and bytes per redraw, rendering one block per call and everything at once. */
+TEST_P(OledRender, RedrawBenchmark) {
+    auto report = [](const char *name, redraw_stats per_block, redraw_stats all) {
+        std::cout << "rotation " << (int)GetParam() * 90 << ", " << name << ": " << per_block.transfers << " transfers, " << per_block.bytes << " bytes per redraw one block at a time; " << all.transfers << " transfers, " << all.bytes << " bytes rendering all" << std::endl;
+    };
+    report("status", run_redraws(false, 64, false), run_redraws(false, 64, true));
+    report("full page", run_redraws(true, 16, false), run_redraws(true, 16, true));
+}
+
+INSTANTIATE_TEST_CASE_P(Rotations, OledRender, testing::Values(OLED_ROTATION_0, OLED_ROTATION_90, OLED_ROTATION_180, OLED_ROTATION_270));
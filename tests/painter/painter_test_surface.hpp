@@ -0,0 +1,17 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstring>
+
+extern "C" {
+#include "qp_surface_internal.h"
+}
+
+/* Creates an RGB565 surface in a device owned by the test, rather than taking a slot from the painter's own surface
+ * table, so every test starts from a freshly initialised device. */
+static inline painter_device_t make_test_rgb565_surface(surface_painter_device_t *device, uint16_t width, uint16_t height, void *buffer) {
+    memset(device, 0, sizeof(*device));
+    return qp_make_rgb565_surface_advanced(device, 1, width, height, buffer);
+}
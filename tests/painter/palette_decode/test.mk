@@ -0,0 +1,14 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+# Device registration needs at least one display driver, the GC9A01 is built without SPI comms
+OPT_DEFS += -DQUANTUM_PAINTER_GC9A01_ENABLE
+COMMON_VPATH += \
+	$(DRIVER_PATH)/painter/tft_panel \
+	$(DRIVER_PATH)/painter/gc9a01
+SRC += \
+	drivers/painter/tft_panel/qp_tft_panel.c \
+	drivers/painter/gc9a01/qp_gc9a01.c
@@ -0,0 +1,271 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "../painter_test_surface.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal_driver.h"
+#include "qp_draw.h"
+#include "qp_stream.h"
+#include "qp_surface.h"
+}
+
+#define PANEL_SIZE 240
+
+static uint8_t surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_SIZE, PANEL_SIZE, 16)];
+
+/* Generates palette indices resembling a UI asset: a solid background, a few flat widgets, a gradient band and a
+ * patch of noise, so both the long runs and the literal runs of the RLE encoding are exercised. */
+static std::vector<uint8_t> make_indices(uint16_t width, uint16_t height, uint8_t bpp) {
+    std::vector<uint8_t> indices(width * height);
+    std::mt19937         rng(bpp);
+    uint16_t             colors = 1 << bpp;
+    for (uint16_t y = 0; y < height; ++y) {
+        for (uint16_t x = 0; x < width; ++x) {
+            uint8_t index = 0;
+            if (y >= height / 8 && y < height / 4) {
+                index = (x * colors / width) % colors;
+            } else if (x >= width / 8 && x < width / 2 && y >= height / 3 && y < height / 2) {
+                index = 1 % colors;
+            } else if (x >= width / 2 && y >= height / 2 && y < height / 2 + height / 8) {
+                index = rng() % colors;
+            } else if (x >= width / 4 && x < width - width / 4 && y >= height * 3 / 4 && y < height * 7 / 8) {
+                index = (colors - 1) ^ ((x / 4 + y / 4) & 1);
+            }
+            indices[y * width + x] = index;
+        }
+    }
+    return indices;
+}
+
+/* Packs indices least significant bits first, as per QGF. */
+static std::vector<uint8_t> pack_indices(const std::vector<uint8_t> &indices, uint8_t bpp) {
+    uint8_t              pixels_per_byte = 8 / bpp;
+    std::vector<uint8_t> packed((indices.size() + pixels_per_byte - 1) / pixels_per_byte, 0);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        packed[i / pixels_per_byte] |= indices[i] << ((i % pixels_per_byte) * bpp);
+    }
+    return packed;
+}
+
+/* QMK RLE: a marker below 128 repeats the following byte that many times, a marker of 128 or above is followed by
+ * (marker - 127) literal bytes. */
+static std::vector<uint8_t> rle_compress(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> output;
+    size_t               i = 0;
+    while (i < data.size()) {
+        size_t run = 1;
+        while (i + run < data.size() && data[i + run] == data[i] && run < 127) {
+            ++run;
+        }
+        if (run >= 2) {
+            output.push_back(run);
+            output.push_back(data[i]);
+            i += run;
+            continue;
+        }
+        size_t literal = 1;
+        while (i + literal < data.size() && literal < 128 && !(i + literal + 1 < data.size() && data[i + literal] == data[i + literal + 1])) {
+            ++literal;
+        }
+        output.push_back(127 + literal);
+        output.insert(output.end(), data.begin() + i, data.begin() + i + literal);
+        i += literal;
+    }
+    return output;
+}
+
+/* A stream which can only be read through qp_stream_get(), like a file stream. */
+typedef struct slow_stream_t {
+    qp_memory_stream_t mem;
+    int16_t (*mem_get)(qp_stream_t *stream);
+} slow_stream_t;
+
+static int16_t slow_get(qp_stream_t *stream) {
+    slow_stream_t *s = (slow_stream_t *)stream;
+    return s->mem_get(stream);
+}
+
+static slow_stream_t make_slow_stream(std::vector<uint8_t> &data) {
+    slow_stream_t s;
+    s.mem          = qp_make_memory_stream(data.data(), data.size());
+    s.mem_get      = s.mem.base.get;
+    s.mem.base.get = slow_get;
+    return s;
+}
+
+/* The decode pipeline as it was before being made block-oriented: one stream read per input byte, and one
+ * append_pixels() call per pixel. Used as the reference for rendering and as the benchmark baseline. */
+typedef struct reference_state_t {
+    qp_stream_t *stream;
+    bool         rle;
+    uint8_t      mode;
+    uint8_t      remain;
+    uint8_t      curr;
+} reference_state_t;
+
+static uint8_t reference_get_byte(reference_state_t *state) {
+    if (!state->rle) {
+        return qp_stream_get(state->stream);
+    }
+    if (state->mode == MARKER_BYTE) {
+        uint8_t c = qp_stream_get(state->stream);
+        if (c >= 128) {
+            state->mode   = NON_REPEATING_RUN;
+            state->remain = c - 127;
+        } else {
+            state->mode   = REPEATING_RUN;
+            state->remain = c;
+        }
+        state->curr = qp_stream_get(state->stream);
+    }
+    uint8_t c = state->curr;
+    if (--state->remain > 0) {
+        if (state->mode == NON_REPEATING_RUN) {
+            state->curr = qp_stream_get(state->stream);
+        }
+    } else {
+        state->mode = MARKER_BYTE;
+    }
+    return c;
+}
+
+static bool reference_draw(painter_device_t device, uint16_t width, uint16_t height, uint8_t bpp, qp_stream_t *stream, bool rle) {
+    painter_driver_t *driver          = (painter_driver_t *)device;
+    reference_state_t state           = {.stream = stream, .rle = rle, .mode = MARKER_BYTE, .remain = 0, .curr = 0};
+    uint32_t          max_pixels      = qp_internal_num_pixels_in_buffer(device);
+    uint32_t          write_pos       = 0;
+    uint32_t          remaining       = (uint32_t)width * height;
+    uint8_t           pixels_per_byte = 8 / bpp;
+    if (!driver->driver_vtable->viewport(device, 0, 0, width - 1, height - 1)) {
+        return false;
+    }
+    while (remaining > 0) {
+        uint8_t byteval     = reference_get_byte(&state);
+        uint8_t loop_pixels = remaining < pixels_per_byte ? remaining : pixels_per_byte;
+        for (uint8_t q = 0; q < loop_pixels; ++q) {
+            uint8_t index = byteval & ((1 << bpp) - 1);
+            driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, write_pos++, 1, &index);
+            if (write_pos == max_pixels) {
+                driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, write_pos);
+                write_pos = 0;
+            }
+            byteval >>= bpp;
+        }
+        remaining -= loop_pixels;
+    }
+    return write_pos == 0 || driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, write_pos);
+}
+
+class PaletteDecode : public testing::TestWithParam<std::tuple<uint8_t, painter_compression_t>> {
+   protected:
+    surface_painter_device_t surface_device;
+    painter_device_t         surface;
+
+    void SetUp() override {
+        memset(surface_buffer, 0, sizeof(surface_buffer));
+        surface = make_test_rgb565_surface(&surface_device, PANEL_SIZE, PANEL_SIZE, surface_buffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        // Distinct colours for every palette entry
+        painter_driver_t *driver = (painter_driver_t *)surface;
+        for (int i = 0; i < 256; ++i) {
+            qp_internal_global_pixel_lookup_table[i].hsv888 = {(uint8_t)i, 255, (uint8_t)(255 - i / 2)};
+        }
+        driver->driver_vtable->palette_convert(surface, 256, qp_internal_global_pixel_lookup_table);
+        qp_internal_invalidate_palette();
+    }
+
+    std::vector<uint8_t> encode(const std::vector<uint8_t> &indices, uint8_t bpp, painter_compression_t compression) {
+        auto packed = pack_indices(indices, bpp);
+        return compression == IMAGE_COMPRESSED_RLE ? rle_compress(packed) : packed;
+    }
+
+    bool draw(uint16_t width, uint16_t height, uint8_t bpp, painter_compression_t compression, qp_stream_t *stream) {
+        painter_driver_t *driver = (painter_driver_t *)surface;
+        if (!driver->driver_vtable->viewport(surface, 0, 0, width - 1, height - 1)) {
+            return false;
+        }
+        qp_internal_byte_input_state_t  input_state    = {.device = surface, .src_stream = stream};
+        qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, compression);
+        return input_callback && qp_internal_appender(surface, bpp, (uint32_t)width * height, input_callback, &input_state);
+    }
+
+    void expect_identical(uint16_t width, uint16_t height) {
+        uint8_t               bpp         = std::get<0>(GetParam());
+        painter_compression_t compression = std::get<1>(GetParam());
+        auto                  indices     = make_indices(width, height, bpp);
+        auto                  data        = encode(indices, bpp, compression);
+
+        memset(surface_buffer, 0, sizeof(surface_buffer));
+        qp_memory_stream_t ref_stream = qp_make_memory_stream(data.data(), data.size());
+        ASSERT_TRUE(reference_draw(surface, width, height, bpp, (qp_stream_t *)&ref_stream, compression == IMAGE_COMPRESSED_RLE));
+        std::vector<uint8_t> expected(surface_buffer, surface_buffer + sizeof(surface_buffer));
+
+        memset(surface_buffer, 0, sizeof(surface_buffer));
+        qp_memory_stream_t mem_stream = qp_make_memory_stream(data.data(), data.size());
+        ASSERT_TRUE(draw(width, height, bpp, compression, (qp_stream_t *)&mem_stream));
+        EXPECT_EQ(memcmp(expected.data(), surface_buffer, sizeof(surface_buffer)), 0) << "memory stream render differs";
+        EXPECT_EQ(mem_stream.position, (int32_t)data.size());
+
+        memset(surface_buffer, 0, sizeof(surface_buffer));
+        slow_stream_t slow_stream = make_slow_stream(data);
+        ASSERT_TRUE(draw(width, height, bpp, compression, (qp_stream_t *)&slow_stream));
+        EXPECT_EQ(memcmp(expected.data(), surface_buffer, sizeof(surface_buffer)), 0) << "non-memory stream render differs";
+        EXPECT_EQ(slow_stream.mem.position, (int32_t)data.size());
+    }
+};
+
+TEST_P(PaletteDecode, FullPanelIdentical) {
+    expect_identical(PANEL_SIZE, PANEL_SIZE);
+}
+
+/* Pixel counts which don't fill the last input byte, nor the index or pixdata buffers. */
+TEST_P(PaletteDecode, OddSizeIdentical) {
+    expect_identical(37, 23);
+    expect_identical(1, 1);
+    expect_identical(239, 3);
+}
+
+TEST_P(PaletteDecode, TruncatedDataFails) {
+    uint8_t               bpp         = std::get<0>(GetParam());
+    painter_compression_t compression = std::get<1>(GetParam());
+    auto                  data        = encode(make_indices(64, 64, bpp), bpp, compression);
+    data.resize(data.size() / 2);
+    qp_memory_stream_t stream = qp_make_memory_stream(data.data(), data.size());
+    EXPECT_FALSE(draw(64, 64, bpp, compression, (qp_stream_t *)&stream));
+}
+
+/* Reports decode throughput into an RGB565 surface, compared with the per-pixel reference pipeline. */
+TEST_P(PaletteDecode, Benchmark) {
+    const int             iterations  = 20;
+    uint8_t               bpp         = std::get<0>(GetParam());
+    painter_compression_t compression = std::get<1>(GetParam());
+    auto                  data        = encode(make_indices(PANEL_SIZE, PANEL_SIZE, bpp), bpp, compression);
+    double                pixels      = (double)PANEL_SIZE * PANEL_SIZE * iterations;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        qp_memory_stream_t stream = qp_make_memory_stream(data.data(), data.size());
+        reference_draw(surface, PANEL_SIZE, PANEL_SIZE, bpp, (qp_stream_t *)&stream, compression == IMAGE_COMPRESSED_RLE);
+    }
+    double reference = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        qp_memory_stream_t stream = qp_make_memory_stream(data.data(), data.size());
+        ASSERT_TRUE(draw(PANEL_SIZE, PANEL_SIZE, bpp, compression, (qp_stream_t *)&stream));
+    }
+    double block = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << (int)bpp << "bpp " << (compression == IMAGE_COMPRESSED_RLE ? "rle" : "raw") << " (" << data.size() << " bytes): " << pixels / reference / 1e6 << " Mpixels/s per-pixel, " << pixels / block / 1e6 << " Mpixels/s block" << std::endl;
+}
+
+INSTANTIATE_TEST_CASE_P(BppAndCompression, PaletteDecode, testing::Combine(testing::Values(1, 2, 4, 8), testing::Values(IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE)), [](const testing::TestParamInfo<PaletteDecode::ParamType> &info) { return std::to_string(std::get<0>(info.param)) + "bpp_" + (std::get<1>(info.param) == IMAGE_COMPRESSED_RLE ? "rle" : "raw"); });
@@ -0,0 +1,189 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include "gtest/gtest.h"
+#include "../painter_test_surface.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal_driver.h"
+#include "qp_comms_dummy.h"
+#include "qp_surface.h"
+#include "qp_gc9a01_opcodes.h"
+
+extern const painter_driver_vtable_t gc9a01_driver_vtable;
+}
+
+#define PANEL_SIZE 240
+
+/* Bytes sent to the panel to set up each region: column and page address commands with 4 bytes each, then the
+ * memory write command. */
+#define VIEWPORT_BYTES 11
+
+/* Emulates the GC9A01 GRAM on top of the dummy comms driver, so transfers can be checked and their cost measured. */
+static struct {
+    uint16_t gram[PANEL_SIZE * PANEL_SIZE];
+    uint8_t  command;
+    uint16_t window_l, window_t, window_r, window_b;
+    uint16_t cursor_x, cursor_y;
+    uint32_t bytes;
+    uint32_t regions;
+} panel;
+
+static void counting_send_command(painter_device_t device, uint8_t cmd) {
+    panel.command = cmd;
+    panel.bytes += 1;
+    if (cmd == GC9A01_SET_MEM) {
+        panel.cursor_x = panel.window_l;
+        panel.cursor_y = panel.window_t;
+        panel.regions++;
+    }
+}
+
+static uint32_t counting_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    const uint8_t *p = (const uint8_t *)data;
+    panel.bytes += byte_count;
+    if (panel.command == GC9A01_SET_COL_ADDR && byte_count == 4) {
+        panel.window_l = p[0] << 8 | p[1];
+        panel.window_r = p[2] << 8 | p[3];
+    } else if (panel.command == GC9A01_SET_PAGE_ADDR && byte_count == 4) {
+        panel.window_t = p[0] << 8 | p[1];
+        panel.window_b = p[2] << 8 | p[3];
+    } else if (panel.command == GC9A01_SET_MEM) {
+        for (uint32_t i = 0; i + 1 < byte_count; i += 2) {
+            memcpy(&panel.gram[panel.cursor_y * PANEL_SIZE + panel.cursor_x], &p[i], 2);
+            if (++panel.cursor_x > panel.window_r) {
+                panel.cursor_x = panel.window_l;
+                panel.cursor_y++;
+            }
+        }
+    }
+    return dummy_comms_vtable.comms_send(device, data, byte_count);
+}
+
+static void counting_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
+    // Initialisation only, not counted
+}
+
+static painter_comms_with_command_vtable_t counting_comms_vtable;
+
+static uint8_t surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_SIZE, PANEL_SIZE, 16)];
+
+class SurfaceTransfer : public testing::Test {
+   protected:
+    surface_painter_device_t surface_device;
+    painter_device_t         surface;
+    painter_device_t         display;
+
+    void SetUp() override {
+        static painter_driver_t display_driver;
+
+        counting_comms_vtable.base                  = dummy_comms_vtable;
+        counting_comms_vtable.base.comms_send       = counting_send;
+        counting_comms_vtable.send_command          = counting_send_command;
+        counting_comms_vtable.bulk_command_sequence = counting_bulk_command_sequence;
+
+        memset(&display_driver, 0, sizeof(display_driver));
+        display_driver.driver_vtable         = &gc9a01_driver_vtable;
+        display_driver.comms_vtable          = &counting_comms_vtable.base;
+        display_driver.native_bits_per_pixel = 16;
+        display_driver.panel_width           = PANEL_SIZE;
+        display_driver.panel_height          = PANEL_SIZE;
+        display_driver.rotation              = QP_ROTATION_0;
+        display = (painter_device_t)&display_driver;
+
+        memset(&panel, 0, sizeof(panel));
+        memset(surface_buffer, 0, sizeof(surface_buffer));
+        surface = make_test_rgb565_surface(&surface_device, PANEL_SIZE, PANEL_SIZE, surface_buffer);
+        ASSERT_TRUE(qp_init(display, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_surface_draw(surface, display, 0, 0, true));
+        expect_panel_matches();
+    }
+
+    void expect_panel_matches() {
+        EXPECT_EQ(memcmp(panel.gram, surface_buffer, sizeof(panel.gram)), 0) << "panel contents differ from surface";
+    }
+
+    uint32_t draw_frame() {
+        uint32_t before = panel.bytes;
+        EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+        expect_panel_matches();
+        return panel.bytes - before;
+    }
+
+    static uint32_t region_bytes(uint16_t w, uint16_t h) {
+        return VIEWPORT_BYTES + w * h * 2;
+    }
+};
+
+TEST_F(SurfaceTransfer, SingleWidget) {
+    qp_rect(surface, 100, 110, 139, 125, 0, 255, 255, true);
+    uint32_t bytes = draw_frame();
+    std::cout << "single widget: " << bytes << " bytes per frame" << std::endl;
+    EXPECT_EQ(bytes, region_bytes(40, 16));
+}
+
+TEST_F(SurfaceTransfer, OppositeCorners) {
+    uint32_t total  = 0;
+    int      frames = 10;
+    for (int frame = 0; frame < frames; ++frame) {
+        uint8_t hue = frame * 20;
+        qp_rect(surface, 8, 8, 47, 23, hue, 255, 255, true);
+        qp_rect(surface, 192, 216, 231, 231, hue + 128, 255, 255, true);
+        total += draw_frame();
+    }
+    std::cout << "opposite corners: " << total / frames << " bytes per frame" << std::endl;
+
+#if SURFACE_DIRTY_RECTS > 1
+    EXPECT_EQ(total / frames, 2 * region_bytes(40, 16));
+#else
+    EXPECT_EQ(total / frames, region_bytes(224, 224));
+#endif
+}
+
+/* A typical status display: clock at the top, layer name at the bottom, and lock indicators on either side. */
+TEST_F(SurfaceTransfer, StatusDisplay) {
+    uint32_t total   = 0;
+    uint32_t regions = panel.regions;
+    int      frames  = 10;
+    for (int frame = 0; frame < frames; ++frame) {
+        uint8_t hue = frame * 20;
+        qp_rect(surface, 90, 30, 149, 45, hue, 255, 255, true);
+        qp_rect(surface, 80, 200, 159, 211, hue + 32, 255, 255, true);
+        if (frame % 2 == 0) {
+            qp_rect(surface, 20, 112, 35, 127, hue + 64, 255, 255, true);
+            qp_rect(surface, 204, 112, 219, 127, hue + 96, 255, 255, true);
+        }
+        total += draw_frame();
+    }
+    std::cout << "status display: " << total / frames << " bytes per frame, " << panel.regions - regions << " regions in " << frames << " frames" << std::endl;
+
+#if SURFACE_DIRTY_RECTS > 1
+    EXPECT_LT(total / frames, region_bytes(200, 182) / 4);
+#endif
+}
+
+/* Random pixels and lines, exercising the merging of rects when they run out. */
+TEST_F(SurfaceTransfer, ScatteredChanges) {
+    std::mt19937 rng(1234);
+    for (int frame = 0; frame < 20; ++frame) {
+        for (int i = 0; i < 12; ++i) {
+            uint16_t x = rng() % PANEL_SIZE;
+            uint16_t y = rng() % PANEL_SIZE;
+            if (i % 3 == 0) {
+                qp_line(surface, x, y, rng() % PANEL_SIZE, rng() % PANEL_SIZE, rng() & 0xFF, 255, 255);
+            } else {
+                qp_setpixel(surface, x, y, rng() & 0xFF, 255, 255);
+            }
+        }
+        draw_frame();
+    }
+}
+
+TEST_F(SurfaceTransfer, NothingDirty) {
+    EXPECT_EQ(draw_frame(), 0u);
+}
@@ -0,0 +1,8 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../surface_transfer/config.h"
+
+#define SURFACE_DIRTY_RECTS 4
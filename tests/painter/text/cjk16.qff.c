@@ -0,0 +1,1026 @@
+// Copyright 2024 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-font-image -i cjk16.png -f mono2 -n -u "<U+4E00..U+4FFF>"`
+
+#include <qp.h>
+
+const uint32_t font_cjk16_length = 16203;
+
+// clang-format off
+const uint8_t font_cjk16[16203] = {
+    0x00, 0xFF, 0x14, 0x00, 0x00, 0x51, 0x46, 0x46, 0x01, 0x4B, 0x3F, 0x00, 0x00, 0xB4, 0xC0, 0xFF,
+    0xFF, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xFD, 0x00, 0x0C, 0x00, 0x00, 0x4E,
+    0x00, 0x10, 0x00, 0x00, 0x01, 0x4E, 0x00, 0x90, 0x07, 0x00, 0x02, 0x4E, 0x00, 0xD0, 0x0F, 0x00,
+    0x03, 0x4E, 0x00, 0x50, 0x17, 0x00, 0x04, 0x4E, 0x00, 0x10, 0x1E, 0x00, 0x05, 0x4E, 0x00, 0x50,
+    0x25, 0x00, 0x06, 0x4E, 0x00, 0x50, 0x2B, 0x00, 0x07, 0x4E, 0x00, 0xD0, 0x31, 0x00, 0x08, 0x4E,
+    0x00, 0x10, 0x37, 0x00, 0x09, 0x4E, 0x00, 0xD0, 0x3C, 0x00, 0x0A, 0x4E, 0x00, 0x10, 0x45, 0x00,
+    0x0B, 0x4E, 0x00, 0x10, 0x4D, 0x00, 0x0C, 0x4E, 0x00, 0x50, 0x50, 0x00, 0x0D, 0x4E, 0x00, 0x90,
+    0x57, 0x00, 0x0E, 0x4E, 0x00, 0x10, 0x5E, 0x00, 0x0F, 0x4E, 0x00, 0x50, 0x63, 0x00, 0x10, 0x4E,
+    0x00, 0x10, 0x69, 0x00, 0x11, 0x4E, 0x00, 0x10, 0x6D, 0x00, 0x12, 0x4E, 0x00, 0xD0, 0x74, 0x00,
+    0x13, 0x4E, 0x00, 0xD0, 0x7A, 0x00, 0x14, 0x4E, 0x00, 0xD0, 0x80, 0x00, 0x15, 0x4E, 0x00, 0x90,
+    0x88, 0x00, 0x16, 0x4E, 0x00, 0x90, 0x90, 0x00, 0x17, 0x4E, 0x00, 0x90, 0x98, 0x00, 0x18, 0x4E,
+    0x00, 0xD0, 0x9D, 0x00, 0x19, 0x4E, 0x00, 0xD0, 0xA4, 0x00, 0x1A, 0x4E, 0x00, 0xD0, 0xAB, 0x00,
+    0x1B, 0x4E, 0x00, 0xD0, 0xB0, 0x00, 0x1C, 0x4E, 0x00, 0xD0, 0xB7, 0x00, 0x1D, 0x4E, 0x00, 0xD0,
+    0xBB, 0x00, 0x1E, 0x4E, 0x00, 0x10, 0xC2, 0x00, 0x1F, 0x4E, 0x00, 0x90, 0xC9, 0x00, 0x20, 0x4E,
+    0x00, 0x10, 0xD1, 0x00, 0x21, 0x4E, 0x00, 0xD0, 0xD8, 0x00, 0x22, 0x4E, 0x00, 0x10, 0xDF, 0x00,
+    0x23, 0x4E, 0x00, 0x90, 0xE5, 0x00, 0x24, 0x4E, 0x00, 0xD0, 0xE9, 0x00, 0x25, 0x4E, 0x00, 0x50,
+    0xF1, 0x00, 0x26, 0x4E, 0x00, 0x50, 0xF7, 0x00, 0x27, 0x4E, 0x00, 0xD0, 0xFC, 0x00, 0x28, 0x4E,
+    0x00, 0x90, 0x02, 0x01, 0x29, 0x4E, 0x00, 0xD0, 0x0A, 0x01, 0x2A, 0x4E, 0x00, 0xD0, 0x11, 0x01,
+    0x2B, 0x4E, 0x00, 0x10, 0x1A, 0x01, 0x2C, 0x4E, 0x00, 0x10, 0x1F, 0x01, 0x2D, 0x4E, 0x00, 0x90,
+    0x26, 0x01, 0x2E, 0x4E, 0x00, 0x10, 0x2C, 0x01, 0x2F, 0x4E, 0x00, 0xD0, 0x31, 0x01, 0x30, 0x4E,
+    0x00, 0xD0, 0x38, 0x01, 0x31, 0x4E, 0x00, 0x10, 0x40, 0x01, 0x32, 0x4E, 0x00, 0xD0, 0x45, 0x01,
+    0x33, 0x4E, 0x00, 0x10, 0x4D, 0x01, 0x34, 0x4E, 0x00, 0x50, 0x55, 0x01, 0x35, 0x4E, 0x00, 0x10,
+    0x5D, 0x01, 0x36, 0x4E, 0x00, 0x10, 0x61, 0x01, 0x37, 0x4E, 0x00, 0x90, 0x67, 0x01, 0x38, 0x4E,
+    0x00, 0x50, 0x6D, 0x01, 0x39, 0x4E, 0x00, 0xD0, 0x72, 0x01, 0x3A, 0x4E, 0x00, 0x90, 0x77, 0x01,
+    0x3B, 0x4E, 0x00, 0xD0, 0x7D, 0x01, 0x3C, 0x4E, 0x00, 0xD0, 0x81, 0x01, 0x3D, 0x4E, 0x00, 0xD0,
+    0x84, 0x01, 0x3E, 0x4E, 0x00, 0xD0, 0x8A, 0x01, 0x3F, 0x4E, 0x00, 0x10, 0x92, 0x01, 0x40, 0x4E,
+    0x00, 0x10, 0x9A, 0x01, 0x41, 0x4E, 0x00, 0xD0, 0x9F, 0x01, 0x42, 0x4E, 0x00, 0x50, 0xA7, 0x01,
+    0x43, 0x4E, 0x00, 0x10, 0xAE, 0x01, 0x44, 0x4E, 0x00, 0xD0, 0xB4, 0x01, 0x45, 0x4E, 0x00, 0x10,
+    0xBA, 0x01, 0x46, 0x4E, 0x00, 0x50, 0xBD, 0x01, 0x47, 0x4E, 0x00, 0xD0, 0xC4, 0x01, 0x48, 0x4E,
+    0x00, 0x50, 0xCC, 0x01, 0x49, 0x4E, 0x00, 0x50, 0xD3, 0x01, 0x4A, 0x4E, 0x00, 0x90, 0xDA, 0x01,
+    0x4B, 0x4E, 0x00, 0x90, 0xE1, 0x01, 0x4C, 0x4E, 0x00, 0x90, 0xE5, 0x01, 0x4D, 0x4E, 0x00, 0x90,
+    0xEB, 0x01, 0x4E, 0x4E, 0x00, 0xD0, 0xEE, 0x01, 0x4F, 0x4E, 0x00, 0x50, 0xF7, 0x01, 0x50, 0x4E,
+    0x00, 0x10, 0xFF, 0x01, 0x51, 0x4E, 0x00, 0x10, 0x07, 0x02, 0x52, 0x4E, 0x00, 0x10, 0x0F, 0x02,
+    0x53, 0x4E, 0x00, 0x50, 0x13, 0x02, 0x54, 0x4E, 0x00, 0xD0, 0x19, 0x02, 0x55, 0x4E, 0x00, 0x50,
+    0x22, 0x02, 0x56, 0x4E, 0x00, 0x50, 0x29, 0x02, 0x57, 0x4E, 0x00, 0x90, 0x31, 0x02, 0x58, 0x4E,
+    0x00, 0x10, 0x39, 0x02, 0x59, 0x4E, 0x00, 0x90, 0x40, 0x02, 0x5A, 0x4E, 0x00, 0x50, 0x45, 0x02,
+    0x5B, 0x4E, 0x00, 0x50, 0x4B, 0x02, 0x5C, 0x4E, 0x00, 0x90, 0x53, 0x02, 0x5D, 0x4E, 0x00, 0xD0,
+    0x5B, 0x02, 0x5E, 0x4E, 0x00, 0xD0, 0x62, 0x02, 0x5F, 0x4E, 0x00, 0x10, 0x68, 0x02, 0x60, 0x4E,
+    0x00, 0xD0, 0x6E, 0x02, 0x61, 0x4E, 0x00, 0x90, 0x76, 0x02, 0x62, 0x4E, 0x00, 0x10, 0x7D, 0x02,
+    0x63, 0x4E, 0x00, 0xD0, 0x84, 0x02, 0x64, 0x4E, 0x00, 0x50, 0x8C, 0x02, 0x65, 0x4E, 0x00, 0x90,
+    0x91, 0x02, 0x66, 0x4E, 0x00, 0xD0, 0x98, 0x02, 0x67, 0x4E, 0x00, 0x90, 0x9C, 0x02, 0x68, 0x4E,
+    0x00, 0x90, 0xA3, 0x02, 0x69, 0x4E, 0x00, 0xD0, 0xA9, 0x02, 0x6A, 0x4E, 0x00, 0x50, 0xB0, 0x02,
+    0x6B, 0x4E, 0x00, 0x50, 0xB6, 0x02, 0x6C, 0x4E, 0x00, 0x50, 0xBD, 0x02, 0x6D, 0x4E, 0x00, 0x50,
+    0xC4, 0x02, 0x6E, 0x4E, 0x00, 0x10, 0xCB, 0x02, 0x6F, 0x4E, 0x00, 0x50, 0xD3, 0x02, 0x70, 0x4E,
+    0x00, 0x10, 0xDB, 0x02, 0x71, 0x4E, 0x00, 0x50, 0xE0, 0x02, 0x72, 0x4E, 0x00, 0xD0, 0xE5, 0x02,
+    0x73, 0x4E, 0x00, 0x50, 0xED, 0x02, 0x74, 0x4E, 0x00, 0xD0, 0xF2, 0x02, 0x75, 0x4E, 0x00, 0xD0,
+    0xF9, 0x02, 0x76, 0x4E, 0x00, 0x10, 0x02, 0x03, 0x77, 0x4E, 0x00, 0x50, 0x09, 0x03, 0x78, 0x4E,
+    0x00, 0x90, 0x0D, 0x03, 0x79, 0x4E, 0x00, 0x50, 0x15, 0x03, 0x7A, 0x4E, 0x00, 0xD0, 0x1A, 0x03,
+    0x7B, 0x4E, 0x00, 0x50, 0x22, 0x03, 0x7C, 0x4E, 0x00, 0xD0, 0x29, 0x03, 0x7D, 0x4E, 0x00, 0x50,
+    0x30, 0x03, 0x7E, 0x4E, 0x00, 0xD0, 0x37, 0x03, 0x7F, 0x4E, 0x00, 0x90, 0x3F, 0x03, 0x80, 0x4E,
+    0x00, 0x50, 0x47, 0x03, 0x81, 0x4E, 0x00, 0x50, 0x4E, 0x03, 0x82, 0x4E, 0x00, 0x50, 0x51, 0x03,
+    0x83, 0x4E, 0x00, 0x90, 0x58, 0x03, 0x84, 0x4E, 0x00, 0x10, 0x5F, 0x03, 0x85, 0x4E, 0x00, 0x10,
+    0x64, 0x03, 0x86, 0x4E, 0x00, 0x10, 0x6C, 0x03, 0x87, 0x4E, 0x00, 0x90, 0x72, 0x03, 0x88, 0x4E,
+    0x00, 0x10, 0x79, 0x03, 0x89, 0x4E, 0x00, 0xD0, 0x7F, 0x03, 0x8A, 0x4E, 0x00, 0x50, 0x87, 0x03,
+    0x8B, 0x4E, 0x00, 0xD0, 0x8D, 0x03, 0x8C, 0x4E, 0x00, 0x90, 0x94, 0x03, 0x8D, 0x4E, 0x00, 0x10,
+    0x9B, 0x03, 0x8E, 0x4E, 0x00, 0x10, 0xA2, 0x03, 0x8F, 0x4E, 0x00, 0x10, 0xA9, 0x03, 0x90, 0x4E,
+    0x00, 0x90, 0xAE, 0x03, 0x91, 0x4E, 0x00, 0x90, 0xB5, 0x03, 0x92, 0x4E, 0x00, 0x10, 0xBB, 0x03,
+    0x93, 0x4E, 0x00, 0x10, 0xBF, 0x03, 0x94, 0x4E, 0x00, 0x90, 0xC6, 0x03, 0x95, 0x4E, 0x00, 0xD0,
+    0xCB, 0x03, 0x96, 0x4E, 0x00, 0x50, 0xD1, 0x03, 0x97, 0x4E, 0x00, 0x50, 0xD8, 0x03, 0x98, 0x4E,
+    0x00, 0x50, 0xDC, 0x03, 0x99, 0x4E, 0x00, 0xD0, 0xE0, 0x03, 0x9A, 0x4E, 0x00, 0x50, 0xE6, 0x03,
+    0x9B, 0x4E, 0x00, 0xD0, 0xED, 0x03, 0x9C, 0x4E, 0x00, 0x50, 0xF3, 0x03, 0x9D, 0x4E, 0x00, 0xD0,
+    0xF9, 0x03, 0x9E, 0x4E, 0x00, 0xD0, 0x00, 0x04, 0x9F, 0x4E, 0x00, 0x50, 0x08, 0x04, 0xA0, 0x4E,
+    0x00, 0x90, 0x0C, 0x04, 0xA1, 0x4E, 0x00, 0x90, 0x10, 0x04, 0xA2, 0x4E, 0x00, 0x10, 0x16, 0x04,
+    0xA3, 0x4E, 0x00, 0x10, 0x1D, 0x04, 0xA4, 0x4E, 0x00, 0x50, 0x20, 0x04, 0xA5, 0x4E, 0x00, 0x50,
+    0x25, 0x04, 0xA6, 0x4E, 0x00, 0x50, 0x2D, 0x04, 0xA7, 0x4E, 0x00, 0x50, 0x34, 0x04, 0xA8, 0x4E,
+    0x00, 0x10, 0x3A, 0x04, 0xA9, 0x4E, 0x00, 0x10, 0x41, 0x04, 0xAA, 0x4E, 0x00, 0x90, 0x44, 0x04,
+    0xAB, 0x4E, 0x00, 0x50, 0x4A, 0x04, 0xAC, 0x4E, 0x00, 0x90, 0x4E, 0x04, 0xAD, 0x4E, 0x00, 0x90,
+    0x56, 0x04, 0xAE, 0x4E, 0x00, 0x50, 0x5B, 0x04, 0xAF, 0x4E, 0x00, 0x90, 0x62, 0x04, 0xB0, 0x4E,
+    0x00, 0x10, 0x6A, 0x04, 0xB1, 0x4E, 0x00, 0x10, 0x72, 0x04, 0xB2, 0x4E, 0x00, 0x10, 0x79, 0x04,
+    0xB3, 0x4E, 0x00, 0x50, 0x7C, 0x04, 0xB4, 0x4E, 0x00, 0x50, 0x83, 0x04, 0xB5, 0x4E, 0x00, 0x50,
+    0x8A, 0x04, 0xB6, 0x4E, 0x00, 0xD0, 0x91, 0x04, 0xB7, 0x4E, 0x00, 0xD0, 0x95, 0x04, 0xB8, 0x4E,
+    0x00, 0xD0, 0x9D, 0x04, 0xB9, 0x4E, 0x00, 0x10, 0xA5, 0x04, 0xBA, 0x4E, 0x00, 0x50, 0xAB, 0x04,
+    0xBB, 0x4E, 0x00, 0xD0, 0xB0, 0x04, 0xBC, 0x4E, 0x00, 0x90, 0xB5, 0x04, 0xBD, 0x4E, 0x00, 0x10,
+    0xBC, 0x04, 0xBE, 0x4E, 0x00, 0xD0, 0xC2, 0x04, 0xBF, 0x4E, 0x00, 0xD0, 0xCA, 0x04, 0xC0, 0x4E,
+    0x00, 0xD0, 0xD2, 0x04, 0xC1, 0x4E, 0x00, 0x90, 0xD9, 0x04, 0xC2, 0x4E, 0x00, 0x10, 0xE0, 0x04,
+    0xC3, 0x4E, 0x00, 0x10, 0xE8, 0x04, 0xC4, 0x4E, 0x00, 0x10, 0xF0, 0x04, 0xC5, 0x4E, 0x00, 0x50,
+    0xF4, 0x04, 0xC6, 0x4E, 0x00, 0xD0, 0xFA, 0x04, 0xC7, 0x4E, 0x00, 0xD0, 0x02, 0x05, 0xC8, 0x4E,
+    0x00, 0xD0, 0x07, 0x05, 0xC9, 0x4E, 0x00, 0x90, 0x0E, 0x05, 0xCA, 0x4E, 0x00, 0xD0, 0x15, 0x05,
+    0xCB, 0x4E, 0x00, 0xD0, 0x19, 0x05, 0xCC, 0x4E, 0x00, 0x90, 0x20, 0x05, 0xCD, 0x4E, 0x00, 0x10,
+    0x28, 0x05, 0xCE, 0x4E, 0x00, 0x10, 0x30, 0x05, 0xCF, 0x4E, 0x00, 0x10, 0x35, 0x05, 0xD0, 0x4E,
+    0x00, 0xD0, 0x3C, 0x05, 0xD1, 0x4E, 0x00, 0x10, 0x40, 0x05, 0xD2, 0x4E, 0x00, 0x90, 0x47, 0x05,
+    0xD3, 0x4E, 0x00, 0x50, 0x4D, 0x05, 0xD4, 0x4E, 0x00, 0x90, 0x55, 0x05, 0xD5, 0x4E, 0x00, 0x50,
+    0x5D, 0x05, 0xD6, 0x4E, 0x00, 0xD0, 0x62, 0x05, 0xD7, 0x4E, 0x00, 0x10, 0x68, 0x05, 0xD8, 0x4E,
+    0x00, 0x90, 0x6E, 0x05, 0xD9, 0x4E, 0x00, 0x10, 0x76, 0x05, 0xDA, 0x4E, 0x00, 0x90, 0x7C, 0x05,
+    0xDB, 0x4E, 0x00, 0xD0, 0x83, 0x05, 0xDC, 0x4E, 0x00, 0x90, 0x8A, 0x05, 0xDD, 0x4E, 0x00, 0x50,
+    0x8E, 0x05, 0xDE, 0x4E, 0x00, 0xD0, 0x94, 0x05, 0xDF, 0x4E, 0x00, 0x50, 0x9C, 0x05, 0xE0, 0x4E,
+    0x00, 0xD0, 0xA3, 0x05, 0xE1, 0x4E, 0x00, 0x90, 0xAB, 0x05, 0xE2, 0x4E, 0x00, 0x50, 0xB1, 0x05,
+    0xE3, 0x4E, 0x00, 0x50, 0xB9, 0x05, 0xE4, 0x4E, 0x00, 0x10, 0xBF, 0x05, 0xE5, 0x4E, 0x00, 0xD0,
+    0xC6, 0x05, 0xE6, 0x4E, 0x00, 0x50, 0xCB, 0x05, 0xE7, 0x4E, 0x00, 0x50, 0xD0, 0x05, 0xE8, 0x4E,
+    0x00, 0x10, 0xD8, 0x05, 0xE9, 0x4E, 0x00, 0x90, 0xDF, 0x05, 0xEA, 0x4E, 0x00, 0x10, 0xE3, 0x05,
+    0xEB, 0x4E, 0x00, 0xD0, 0xEA, 0x05, 0xEC, 0x4E, 0x00, 0x50, 0xEF, 0x05, 0xED, 0x4E, 0x00, 0x90,
+    0xF4, 0x05, 0xEE, 0x4E, 0x00, 0x90, 0xFB, 0x05, 0xEF, 0x4E, 0x00, 0xD0, 0x03, 0x06, 0xF0, 0x4E,
+    0x00, 0x50, 0x07, 0x06, 0xF1, 0x4E, 0x00, 0xD0, 0x0C, 0x06, 0xF2, 0x4E, 0x00, 0x10, 0x14, 0x06,
+    0xF3, 0x4E, 0x00, 0x90, 0x19, 0x06, 0xF4, 0x4E, 0x00, 0x90, 0x20, 0x06, 0xF5, 0x4E, 0x00, 0x10,
+    0x26, 0x06, 0xF6, 0x4E, 0x00, 0x10, 0x2D, 0x06, 0xF7, 0x4E, 0x00, 0x90, 0x33, 0x06, 0xF8, 0x4E,
+    0x00, 0x90, 0x38, 0x06, 0xF9, 0x4E, 0x00, 0xD0, 0x3D, 0x06, 0xFA, 0x4E, 0x00, 0xD0, 0x45, 0x06,
+    0xFB, 0x4E, 0x00, 0x50, 0x4B, 0x06, 0xFC, 0x4E, 0x00, 0xD0, 0x4E, 0x06, 0xFD, 0x4E, 0x00, 0x50,
+    0x57, 0x06, 0xFE, 0x4E, 0x00, 0x50, 0x5E, 0x06, 0xFF, 0x4E, 0x00, 0xD0, 0x64, 0x06, 0x00, 0x4F,
+    0x00, 0x10, 0x6A, 0x06, 0x01, 0x4F, 0x00, 0x90, 0x6F, 0x06, 0x02, 0x4F, 0x00, 0x90, 0x75, 0x06,
+    0x03, 0x4F, 0x00, 0xD0, 0x7A, 0x06, 0x04, 0x4F, 0x00, 0x90, 0x82, 0x06, 0x05, 0x4F, 0x00, 0x50,
+    0x89, 0x06, 0x06, 0x4F, 0x00, 0x50, 0x8E, 0x06, 0x07, 0x4F, 0x00, 0xD0, 0x94, 0x06, 0x08, 0x4F,
+    0x00, 0x90, 0x9B, 0x06, 0x09, 0x4F, 0x00, 0x50, 0xA2, 0x06, 0x0A, 0x4F, 0x00, 0xD0, 0xA8, 0x06,
+    0x0B, 0x4F, 0x00, 0x10, 0xB0, 0x06, 0x0C, 0x4F, 0x00, 0x10, 0xB4, 0x06, 0x0D, 0x4F, 0x00, 0x10,
+    0xB8, 0x06, 0x0E, 0x4F, 0x00, 0x10, 0xBD, 0x06, 0x0F, 0x4F, 0x00, 0x90, 0xC4, 0x06, 0x10, 0x4F,
+    0x00, 0x50, 0xCC, 0x06, 0x11, 0x4F, 0x00, 0x90, 0xD4, 0x06, 0x12, 0x4F, 0x00, 0x10, 0xD9, 0x06,
+    0x13, 0x4F, 0x00, 0xD0, 0xDE, 0x06, 0x14, 0x4F, 0x00, 0x50, 0xE3, 0x06, 0x15, 0x4F, 0x00, 0x50,
+    0xEB, 0x06, 0x16, 0x4F, 0x00, 0x10, 0xF3, 0x06, 0x17, 0x4F, 0x00, 0x90, 0xFA, 0x06, 0x18, 0x4F,
+    0x00, 0x90, 0x02, 0x07, 0x19, 0x4F, 0x00, 0x10, 0x0A, 0x07, 0x1A, 0x4F, 0x00, 0x50, 0x12, 0x07,
+    0x1B, 0x4F, 0x00, 0xD0, 0x18, 0x07, 0x1C, 0x4F, 0x00, 0x50, 0x1F, 0x07, 0x1D, 0x4F, 0x00, 0x10,
+    0x24, 0x07, 0x1E, 0x4F, 0x00, 0x90, 0x2A, 0x07, 0x1F, 0x4F, 0x00, 0x90, 0x2E, 0x07, 0x20, 0x4F,
+    0x00, 0xD0, 0x35, 0x07, 0x21, 0x4F, 0x00, 0x10, 0x3C, 0x07, 0x22, 0x4F, 0x00, 0x10, 0x44, 0x07,
+    0x23, 0x4F, 0x00, 0x50, 0x4A, 0x07, 0x24, 0x4F, 0x00, 0x50, 0x4F, 0x07, 0x25, 0x4F, 0x00, 0x10,
+    0x57, 0x07, 0x26, 0x4F, 0x00, 0x10, 0x5E, 0x07, 0x27, 0x4F, 0x00, 0xD0, 0x65, 0x07, 0x28, 0x4F,
+    0x00, 0xD0, 0x6C, 0x07, 0x29, 0x4F, 0x00, 0x90, 0x70, 0x07, 0x2A, 0x4F, 0x00, 0x10, 0x75, 0x07,
+    0x2B, 0x4F, 0x00, 0x90, 0x78, 0x07, 0x2C, 0x4F, 0x00, 0x50, 0x80, 0x07, 0x2D, 0x4F, 0x00, 0xD0,
+    0x85, 0x07, 0x2E, 0x4F, 0x00, 0x10, 0x8E, 0x07, 0x2F, 0x4F, 0x00, 0x10, 0x95, 0x07, 0x30, 0x4F,
+    0x00, 0x50, 0x9A, 0x07, 0x31, 0x4F, 0x00, 0xD0, 0x9F, 0x07, 0x32, 0x4F, 0x00, 0x50, 0xA7, 0x07,
+    0x33, 0x4F, 0x00, 0xD0, 0xAE, 0x07, 0x34, 0x4F, 0x00, 0x90, 0xB2, 0x07, 0x35, 0x4F, 0x00, 0x10,
+    0xB9, 0x07, 0x36, 0x4F, 0x00, 0x90, 0xC0, 0x07, 0x37, 0x4F, 0x00, 0x50, 0xC7, 0x07, 0x38, 0x4F,
+    0x00, 0x50, 0xCE, 0x07, 0x39, 0x4F, 0x00, 0x90, 0xD5, 0x07, 0x3A, 0x4F, 0x00, 0xD0, 0xDD, 0x07,
+    0x3B, 0x4F, 0x00, 0xD0, 0xE5, 0x07, 0x3C, 0x4F, 0x00, 0xD0, 0xE8, 0x07, 0x3D, 0x4F, 0x00, 0x50,
+    0xF0, 0x07, 0x3E, 0x4F, 0x00, 0x10, 0xF7, 0x07, 0x3F, 0x4F, 0x00, 0x90, 0xFE, 0x07, 0x40, 0x4F,
+    0x00, 0x90, 0x05, 0x08, 0x41, 0x4F, 0x00, 0x90, 0x0A, 0x08, 0x42, 0x4F, 0x00, 0x50, 0x11, 0x08,
+    0x43, 0x4F, 0x00, 0xD0, 0x18, 0x08, 0x44, 0x4F, 0x00, 0xD0, 0x20, 0x08, 0x45, 0x4F, 0x00, 0x90,
+    0x28, 0x08, 0x46, 0x4F, 0x00, 0x10, 0x30, 0x08, 0x47, 0x4F, 0x00, 0x90, 0x37, 0x08, 0x48, 0x4F,
+    0x00, 0x10, 0x3E, 0x08, 0x49, 0x4F, 0x00, 0x10, 0x43, 0x08, 0x4A, 0x4F, 0x00, 0xD0, 0x48, 0x08,
+    0x4B, 0x4F, 0x00, 0xD0, 0x50, 0x08, 0x4C, 0x4F, 0x00, 0xD0, 0x54, 0x08, 0x4D, 0x4F, 0x00, 0xD0,
+    0x5B, 0x08, 0x4E, 0x4F, 0x00, 0x50, 0x63, 0x08, 0x4F, 0x4F, 0x00, 0x90, 0x67, 0x08, 0x50, 0x4F,
+    0x00, 0xD0, 0x6D, 0x08, 0x51, 0x4F, 0x00, 0x50, 0x74, 0x08, 0x52, 0x4F, 0x00, 0x10, 0x7A, 0x08,
+    0x53, 0x4F, 0x00, 0x90, 0x81, 0x08, 0x54, 0x4F, 0x00, 0x10, 0x89, 0x08, 0x55, 0x4F, 0x00, 0xD0,
+    0x90, 0x08, 0x56, 0x4F, 0x00, 0x50, 0x98, 0x08, 0x57, 0x4F, 0x00, 0x90, 0xA0, 0x08, 0x58, 0x4F,
+    0x00, 0x90, 0xA8, 0x08, 0x59, 0x4F, 0x00, 0x90, 0xAE, 0x08, 0x5A, 0x4F, 0x00, 0xD0, 0xB4, 0x08,
+    0x5B, 0x4F, 0x00, 0xD0, 0xBC, 0x08, 0x5C, 0x4F, 0x00, 0xD0, 0xC0, 0x08, 0x5D, 0x4F, 0x00, 0x10,
+    0xC8, 0x08, 0x5E, 0x4F, 0x00, 0x10, 0xD0, 0x08, 0x5F, 0x4F, 0x00, 0xD0, 0xD6, 0x08, 0x60, 0x4F,
+    0x00, 0x50, 0xDC, 0x08, 0x61, 0x4F, 0x00, 0xD0, 0xDF, 0x08, 0x62, 0x4F, 0x00, 0x10, 0xE5, 0x08,
+    0x63, 0x4F, 0x00, 0x50, 0xE9, 0x08, 0x64, 0x4F, 0x00, 0x10, 0xEF, 0x08, 0x65, 0x4F, 0x00, 0x10,
+    0xF2, 0x08, 0x66, 0x4F, 0x00, 0x50, 0xF9, 0x08, 0x67, 0x4F, 0x00, 0xD0, 0xFC, 0x08, 0x68, 0x4F,
+    0x00, 0xD0, 0x02, 0x09, 0x69, 0x4F, 0x00, 0xD0, 0x07, 0x09, 0x6A, 0x4F, 0x00, 0x50, 0x0F, 0x09,
+    0x6B, 0x4F, 0x00, 0x10, 0x16, 0x09, 0x6C, 0x4F, 0x00, 0xD0, 0x19, 0x09, 0x6D, 0x4F, 0x00, 0x10,
+    0x20, 0x09, 0x6E, 0x4F, 0x00, 0x10, 0x25, 0x09, 0x6F, 0x4F, 0x00, 0xD0, 0x2C, 0x09, 0x70, 0x4F,
+    0x00, 0xD0, 0x34, 0x09, 0x71, 0x4F, 0x00, 0x10, 0x3B, 0x09, 0x72, 0x4F, 0x00, 0x90, 0x42, 0x09,
+    0x73, 0x4F, 0x00, 0x50, 0x4A, 0x09, 0x74, 0x4F, 0x00, 0x50, 0x52, 0x09, 0x75, 0x4F, 0x00, 0xD0,
+    0x5A, 0x09, 0x76, 0x4F, 0x00, 0xD0, 0x62, 0x09, 0x77, 0x4F, 0x00, 0xD0, 0x67, 0x09, 0x78, 0x4F,
+    0x00, 0x10, 0x70, 0x09, 0x79, 0x4F, 0x00, 0x50, 0x76, 0x09, 0x7A, 0x4F, 0x00, 0x50, 0x7D, 0x09,
+    0x7B, 0x4F, 0x00, 0xD0, 0x82, 0x09, 0x7C, 0x4F, 0x00, 0x50, 0x8A, 0x09, 0x7D, 0x4F, 0x00, 0x10,
+    0x91, 0x09, 0x7E, 0x4F, 0x00, 0x50, 0x99, 0x09, 0x7F, 0x4F, 0x00, 0xD0, 0x9D, 0x09, 0x80, 0x4F,
+    0x00, 0x90, 0xA5, 0x09, 0x81, 0x4F, 0x00, 0xD0, 0xAD, 0x09, 0x82, 0x4F, 0x00, 0xD0, 0xB2, 0x09,
+    0x83, 0x4F, 0x00, 0x50, 0xBA, 0x09, 0x84, 0x4F, 0x00, 0x50, 0xC2, 0x09, 0x85, 0x4F, 0x00, 0x10,
+    0xC9, 0x09, 0x86, 0x4F, 0x00, 0xD0, 0xCD, 0x09, 0x87, 0x4F, 0x00, 0x50, 0xD4, 0x09, 0x88, 0x4F,
+    0x00, 0x50, 0xDB, 0x09, 0x89, 0x4F, 0x00, 0x50, 0xE0, 0x09, 0x8A, 0x4F, 0x00, 0xD0, 0xE5, 0x09,
+    0x8B, 0x4F, 0x00, 0xD0, 0xEB, 0x09, 0x8C, 0x4F, 0x00, 0x90, 0xF3, 0x09, 0x8D, 0x4F, 0x00, 0xD0,
+    0xFB, 0x09, 0x8E, 0x4F, 0x00, 0x50, 0xFF, 0x09, 0x8F, 0x4F, 0x00, 0xD0, 0x05, 0x0A, 0x90, 0x4F,
+    0x00, 0x90, 0x0B, 0x0A, 0x91, 0x4F, 0x00, 0x50, 0x13, 0x0A, 0x92, 0x4F, 0x00, 0x10, 0x17, 0x0A,
+    0x93, 0x4F, 0x00, 0xD0, 0x1C, 0x0A, 0x94, 0x4F, 0x00, 0x90, 0x24, 0x0A, 0x95, 0x4F, 0x00, 0x50,
+    0x29, 0x0A, 0x96, 0x4F, 0x00, 0x50, 0x30, 0x0A, 0x97, 0x4F, 0x00, 0xD0, 0x36, 0x0A, 0x98, 0x4F,
+    0x00, 0x50, 0x3D, 0x0A, 0x99, 0x4F, 0x00, 0x50, 0x43, 0x0A, 0x9A, 0x4F, 0x00, 0x10, 0x48, 0x0A,
+    0x9B, 0x4F, 0x00, 0x50, 0x50, 0x0A, 0x9C, 0x4F, 0x00, 0x10, 0x58, 0x0A, 0x9D, 0x4F, 0x00, 0x50,
+    0x60, 0x0A, 0x9E, 0x4F, 0x00, 0x50, 0x64, 0x0A, 0x9F, 0x4F, 0x00, 0x90, 0x6A, 0x0A, 0xA0, 0x4F,
+    0x00, 0x10, 0x72, 0x0A, 0xA1, 0x4F, 0x00, 0x10, 0x7A, 0x0A, 0xA2, 0x4F, 0x00, 0x90, 0x7E, 0x0A,
+    0xA3, 0x4F, 0x00, 0x50, 0x84, 0x0A, 0xA4, 0x4F, 0x00, 0x50, 0x8B, 0x0A, 0xA5, 0x4F, 0x00, 0x90,
+    0x92, 0x0A, 0xA6, 0x4F, 0x00, 0xD0, 0x96, 0x0A, 0xA7, 0x4F, 0x00, 0xD0, 0x9E, 0x0A, 0xA8, 0x4F,
+    0x00, 0x50, 0xA6, 0x0A, 0xA9, 0x4F, 0x00, 0xD0, 0xAA, 0x0A, 0xAA, 0x4F, 0x00, 0xD0, 0xB1, 0x0A,
+    0xAB, 0x4F, 0x00, 0x90, 0xB7, 0x0A, 0xAC, 0x4F, 0x00, 0x50, 0xBF, 0x0A, 0xAD, 0x4F, 0x00, 0x90,
+    0xC3, 0x0A, 0xAE, 0x4F, 0x00, 0xD0, 0xCB, 0x0A, 0xAF, 0x4F, 0x00, 0x10, 0xD4, 0x0A, 0xB0, 0x4F,
+    0x00, 0x10, 0xDC, 0x0A, 0xB1, 0x4F, 0x00, 0x10, 0xE2, 0x0A, 0xB2, 0x4F, 0x00, 0x90, 0xE9, 0x0A,
+    0xB3, 0x4F, 0x00, 0x90, 0xEE, 0x0A, 0xB4, 0x4F, 0x00, 0xD0, 0xF3, 0x0A, 0xB5, 0x4F, 0x00, 0x90,
+    0xFA, 0x0A, 0xB6, 0x4F, 0x00, 0xD0, 0x01, 0x0B, 0xB7, 0x4F, 0x00, 0x50, 0x09, 0x0B, 0xB8, 0x4F,
+    0x00, 0x90, 0x11, 0x0B, 0xB9, 0x4F, 0x00, 0x90, 0x18, 0x0B, 0xBA, 0x4F, 0x00, 0x90, 0x20, 0x0B,
+    0xBB, 0x4F, 0x00, 0x90, 0x24, 0x0B, 0xBC, 0x4F, 0x00, 0xD0, 0x2B, 0x0B, 0xBD, 0x4F, 0x00, 0xD0,
+    0x31, 0x0B, 0xBE, 0x4F, 0x00, 0x90, 0x35, 0x0B, 0xBF, 0x4F, 0x00, 0xD0, 0x3D, 0x0B, 0xC0, 0x4F,
+    0x00, 0xD0, 0x45, 0x0B, 0xC1, 0x4F, 0x00, 0x90, 0x49, 0x0B, 0xC2, 0x4F, 0x00, 0x10, 0x4F, 0x0B,
+    0xC3, 0x4F, 0x00, 0x90, 0x55, 0x0B, 0xC4, 0x4F, 0x00, 0x50, 0x5C, 0x0B, 0xC5, 0x4F, 0x00, 0x90,
+    0x60, 0x0B, 0xC6, 0x4F, 0x00, 0x90, 0x65, 0x0B, 0xC7, 0x4F, 0x00, 0x90, 0x69, 0x0B, 0xC8, 0x4F,
+    0x00, 0x90, 0x6E, 0x0B, 0xC9, 0x4F, 0x00, 0x90, 0x75, 0x0B, 0xCA, 0x4F, 0x00, 0xD0, 0x7B, 0x0B,
+    0xCB, 0x4F, 0x00, 0x90, 0x80, 0x0B, 0xCC, 0x4F, 0x00, 0xD0, 0x87, 0x0B, 0xCD, 0x4F, 0x00, 0xD0,
+    0x8E, 0x0B, 0xCE, 0x4F, 0x00, 0xD0, 0x94, 0x0B, 0xCF, 0x4F, 0x00, 0x90, 0x97, 0x0B, 0xD0, 0x4F,
+    0x00, 0x90, 0x9C, 0x0B, 0xD1, 0x4F, 0x00, 0x50, 0xA1, 0x0B, 0xD2, 0x4F, 0x00, 0x90, 0xA5, 0x0B,
+    0xD3, 0x4F, 0x00, 0x50, 0xAB, 0x0B, 0xD4, 0x4F, 0x00, 0xD0, 0xB2, 0x0B, 0xD5, 0x4F, 0x00, 0x10,
+    0xB6, 0x0B, 0xD6, 0x4F, 0x00, 0x50, 0xBD, 0x0B, 0xD7, 0x4F, 0x00, 0x50, 0xC4, 0x0B, 0xD8, 0x4F,
+    0x00, 0x50, 0xCB, 0x0B, 0xD9, 0x4F, 0x00, 0x90, 0xD1, 0x0B, 0xDA, 0x4F, 0x00, 0xD0, 0xD5, 0x0B,
+    0xDB, 0x4F, 0x00, 0xD0, 0xDA, 0x0B, 0xDC, 0x4F, 0x00, 0x10, 0xE1, 0x0B, 0xDD, 0x4F, 0x00, 0xD0,
+    0xE7, 0x0B, 0xDE, 0x4F, 0x00, 0x10, 0xED, 0x0B, 0xDF, 0x4F, 0x00, 0xD0, 0xF1, 0x0B, 0xE0, 0x4F,
+    0x00, 0x10, 0xF5, 0x0B, 0xE1, 0x4F, 0x00, 0x90, 0xFC, 0x0B, 0xE2, 0x4F, 0x00, 0x10, 0x02, 0x0C,
+    0xE3, 0x4F, 0x00, 0x90, 0x09, 0x0C, 0xE4, 0x4F, 0x00, 0x90, 0x11, 0x0C, 0xE5, 0x4F, 0x00, 0x90,
+    0x18, 0x0C, 0xE6, 0x4F, 0x00, 0x50, 0x1E, 0x0C, 0xE7, 0x4F, 0x00, 0x50, 0x26, 0x0C, 0xE8, 0x4F,
+    0x00, 0x50, 0x2C, 0x0C, 0xE9, 0x4F, 0x00, 0x90, 0x33, 0x0C, 0xEA, 0x4F, 0x00, 0x90, 0x3A, 0x0C,
+    0xEB, 0x4F, 0x00, 0x90, 0x3F, 0x0C, 0xEC, 0x4F, 0x00, 0x50, 0x47, 0x0C, 0xED, 0x4F, 0x00, 0x10,
+    0x4D, 0x0C, 0xEE, 0x4F, 0x00, 0xD0, 0x53, 0x0C, 0xEF, 0x4F, 0x00, 0x10, 0x5B, 0x0C, 0xF0, 0x4F,
+    0x00, 0x10, 0x61, 0x0C, 0xF1, 0x4F, 0x00, 0x90, 0x68, 0x0C, 0xF2, 0x4F, 0x00, 0x90, 0x70, 0x0C,
+    0xF3, 0x4F, 0x00, 0x50, 0x76, 0x0C, 0xF4, 0x4F, 0x00, 0x50, 0x7E, 0x0C, 0xF5, 0x4F, 0x00, 0x10,
+    0x85, 0x0C, 0xF6, 0x4F, 0x00, 0x50, 0x8B, 0x0C, 0xF7, 0x4F, 0x00, 0xD0, 0x91, 0x0C, 0xF8, 0x4F,
+    0x00, 0x90, 0x98, 0x0C, 0xF9, 0x4F, 0x00, 0x50, 0x9C, 0x0C, 0xFA, 0x4F, 0x00, 0x90, 0xA2, 0x0C,
+    0xFB, 0x4F, 0x00, 0x10, 0xAA, 0x0C, 0xFC, 0x4F, 0x00, 0x90, 0xB1, 0x0C, 0xFD, 0x4F, 0x00, 0xD0,
+    0xB7, 0x0C, 0xFE, 0x4F, 0x00, 0xD0, 0xBD, 0x0C, 0xFF, 0x4F, 0x00, 0xD0, 0xC3, 0x0C, 0x04, 0xFB,
+    0x28, 0x33, 0x00, 0x03, 0x00, 0x93, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x3E, 0x03, 0x00, 0x81, 0xC0, 0x03, 0x04,
+    0x00, 0x02, 0x00, 0x9D, 0x08, 0x04, 0xFC, 0x3F, 0x08, 0x04, 0x08, 0x04, 0x08, 0x05, 0x08, 0x01,
+    0x00, 0x01, 0x00, 0x21, 0x80, 0x27, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x20,
+    0x00, 0x20, 0x05, 0x00, 0x9A, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22,
+    0xF0, 0x7F, 0x40, 0x22, 0xC0, 0x22, 0xC0, 0x22, 0x40, 0x22, 0x40, 0x22, 0x40, 0x22, 0x00, 0x02,
+    0x08, 0x00, 0x8D, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xE8,
+    0x0F, 0x03, 0x00, 0x84, 0x10, 0x80, 0x11, 0xE0, 0x11, 0x02, 0x00, 0x04, 0x00, 0x91, 0xFC, 0x01,
+    0x20, 0x00, 0xA0, 0x00, 0xA0, 0x01, 0xA0, 0x01, 0x20, 0x01, 0x20, 0x01, 0xFE, 0x3F, 0x00, 0x01,
+    0x04, 0x00, 0x82, 0x20, 0x00, 0x20, 0x03, 0x00, 0x08, 0x00, 0x81, 0xC0, 0x07, 0x05, 0x00, 0x82,
+    0x01, 0x00, 0x01, 0x02, 0x00, 0x83, 0xF0, 0x1F, 0xE0, 0x3F, 0x04, 0x00, 0x80, 0x60, 0x03, 0x00,
+    0x0A, 0x00, 0x81, 0xFE, 0x0F, 0x02, 0x00, 0x91, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0xFC, 0x7F,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x0C, 0x00, 0x83, 0xC0, 0x01, 0x00,
+    0x1E, 0x04, 0x00, 0x88, 0x80, 0x1F, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0xC0, 0x03, 0x00, 0x02,
+    0x00, 0x84, 0x10, 0x00, 0x10, 0x00, 0x10, 0x06, 0x00, 0x80, 0x3E, 0x08, 0x00, 0x81, 0xC0, 0x3F,
+    0x05, 0x00, 0x80, 0x7E, 0x02, 0x00, 0x02, 0x00, 0x9D, 0x02, 0x00, 0x02, 0x00, 0x02, 0x1E, 0x02,
+    0x00, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x82, 0x40, 0x82, 0x40, 0xFE, 0x0F, 0x82, 0x00, 0x82,
+    0x00, 0xBE, 0x00, 0x82, 0x00, 0x80, 0x00, 0x03, 0x00, 0x9A, 0x40, 0x00, 0x40, 0x00, 0x40, 0xFE,
+    0x47, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x80, 0x44, 0x80, 0x44, 0x80, 0x44, 0x00,
+    0x44, 0x78, 0x40, 0x80, 0x43, 0x02, 0x00, 0x06, 0x00, 0x83, 0x12, 0x00, 0xFE, 0x1F, 0x11, 0x00,
+    0x80, 0x40, 0x04, 0x00, 0x02, 0x00, 0x97, 0x02, 0x04, 0x02, 0x04, 0x42, 0x00, 0x42, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x42, 0x00, 0x42, 0x01, 0x42, 0x01, 0x00, 0x01, 0x80, 0x07, 0x06,
+    0x00, 0x07, 0x00, 0x80, 0x06, 0x02, 0x00, 0x90, 0x88, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0A, 0x00,
+    0x0A, 0x00, 0x0A, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x05, 0x00, 0x04, 0x00, 0x8F, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x04, 0x02, 0x0C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x0C, 0x00,
+    0x0B, 0x00, 0x91, 0x04, 0x00, 0x04, 0x00, 0x04, 0x3E, 0x04, 0x00, 0x06, 0x00, 0x04, 0x00, 0x04,
+    0x10, 0x00, 0x10, 0x00, 0x10, 0x03, 0x00, 0x0F, 0x00, 0x84, 0x70, 0x00, 0x02, 0xFE, 0x1F, 0x06,
+    0x00, 0x82, 0x10, 0x00, 0x10, 0x03, 0x00, 0x04, 0x00, 0x9B, 0x04, 0x00, 0x04, 0x20, 0x04, 0x60,
+    0x0C, 0x20, 0x00, 0x20, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21,
+    0x00, 0x21, 0x00, 0x31, 0x00, 0x40, 0x05, 0x00, 0x92, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x08, 0x00, 0x08, 0x00, 0x28, 0x00, 0x3C, 0x00, 0x20, 0x00, 0x20, 0x08, 0x00, 0x03, 0x00,
+    0x88, 0x20, 0xE0, 0x21, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x07, 0x00, 0x86, 0x01, 0x00, 0x41,
+    0xF8, 0x41, 0xFC, 0x5F, 0x06, 0x00, 0x02, 0x00, 0x99, 0x28, 0x00, 0x28, 0x01, 0x28, 0x01, 0x28,
+    0x09, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0xFC, 0x09, 0xFE, 0x0F, 0x60, 0x09, 0x60,
+    0x01, 0x40, 0x01, 0x04, 0x00, 0x03, 0x00, 0x9C, 0x20, 0x00, 0x20, 0x00, 0x20, 0x40, 0x20, 0x40,
+    0x20, 0x42, 0x20, 0x42, 0x21, 0x42, 0x00, 0x5E, 0x00, 0x42, 0x00, 0x02, 0x00, 0x02, 0x40, 0x02,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x03, 0x00, 0x9C, 0x01, 0x00, 0x09, 0x00, 0x09, 0x84, 0x09, 0x84,
+    0x09, 0x84, 0x09, 0x84, 0x09, 0x44, 0x08, 0x44, 0x08, 0x44, 0x08, 0x54, 0x00, 0x50, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x04, 0x00, 0x80, 0x30, 0x0D, 0x00, 0x82, 0x80, 0x0F, 0x02, 0x03,
+    0x00, 0x87, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x8D, 0x40, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x01, 0x40, 0x00, 0xFC, 0x0F, 0x06, 0x00, 0x80, 0x7E, 0x05,
+    0x00, 0x81, 0xFC, 0x1F, 0x02, 0x00, 0x05, 0x00, 0x96, 0x7C, 0x00, 0x08, 0x02, 0x08, 0x02, 0x08,
+    0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0xE2, 0x08, 0xFE, 0x07,
+    0x04, 0x00, 0x02, 0x00, 0x08, 0x10, 0x83, 0xFC, 0x3F, 0x10, 0x12, 0x04, 0x10, 0x85, 0x00, 0x10,
+    0x80, 0x7F, 0x0E, 0x10, 0x08, 0x00, 0x04, 0x00, 0x81, 0xF0, 0x07, 0x02, 0x00, 0x86, 0x0A, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x02, 0x00, 0x80, 0x01, 0x08, 0x00, 0x85, 0xFE, 0x1F, 0x02, 0x00,
+    0x02, 0x00, 0x06, 0x00, 0x88, 0x20, 0x00, 0x20, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x0C, 0x20,
+    0x05, 0x00, 0x06, 0x00, 0x81, 0xC0, 0x07, 0x08, 0x00, 0x81, 0xE0, 0x3F, 0x02, 0x00, 0x81, 0xFE,
+    0x03, 0x03, 0x00, 0x86, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x04, 0x00, 0x98, 0xFC, 0x1F,
+    0x1E, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x0A, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x03, 0x00, 0x05, 0x00, 0x98, 0x10, 0x00, 0x18, 0xC0,
+    0x1F, 0x00, 0x18, 0x02, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x80, 0x3B, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x02, 0x00, 0x03, 0x00, 0x99, 0x08, 0x00, 0x08, 0x00, 0x08, 0x40,
+    0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x7F, 0x40, 0x08, 0x40, 0x00, 0x40, 0x00, 0xF0, 0x3F, 0x40,
+    0x08, 0xC0, 0x3F, 0x40, 0x03, 0x00, 0x0A, 0x00, 0x93, 0x80, 0x00, 0xC0, 0x09, 0xC0, 0x09, 0x40,
+    0x09, 0x40, 0x09, 0x40, 0x09, 0xFC, 0x09, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x02, 0x00, 0x05,
+    0x00, 0x94, 0x01, 0xFE, 0x01, 0xE0, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0x04, 0x00, 0x8B, 0x38, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0xE0, 0x03, 0x10, 0x00, 0x05, 0x00, 0x98, 0x40, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x78, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0xE0, 0x47, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x02, 0x00, 0x0B, 0x00, 0x92, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x20, 0x01, 0x20, 0x01, 0x20, 0x03, 0x20, 0x03, 0x20, 0x03, 0x20, 0x02, 0x20, 0x02, 0x02, 0x00,
+    0x06, 0x00, 0x90, 0x02, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x02,
+    0x00, 0xC2, 0x3F, 0x02, 0x09, 0x00, 0x0C, 0x00, 0x91, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20,
+    0x10, 0x20, 0x10, 0xFE, 0x1F, 0x20, 0x10, 0x00, 0x10, 0x00, 0x10, 0x02, 0x00, 0x02, 0x00, 0x9B,
+    0x02, 0x00, 0x02, 0x00, 0xC2, 0x07, 0x42, 0x00, 0x42, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10,
+    0x40, 0x10, 0x00, 0x10, 0x80, 0x1F, 0xFE, 0x10, 0x00, 0x10, 0x00, 0x10, 0x02, 0x00, 0x06, 0x00,
+    0x96, 0x40, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x7C, 0x50, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x90, 0x0F, 0x10, 0x00, 0x10, 0x00, 0x10, 0x03, 0x00, 0x02, 0x00, 0x9D, 0x10, 0x00, 0x90,
+    0x3F, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0xFE, 0x00, 0x90, 0x00, 0x90,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x8E, 0x10, 0x00,
+    0x10, 0x00, 0x10, 0x1C, 0x10, 0x00, 0x10, 0xF8, 0x1F, 0x00, 0x10, 0x00, 0x10, 0x02, 0x00, 0x03,
+    0x00, 0x86, 0x10, 0x00, 0x11, 0x00, 0x01, 0x00, 0x01, 0x03, 0x00, 0x8E, 0x04, 0x10, 0x04, 0x10,
+    0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x09, 0x00, 0x80,
+    0x3E, 0x06, 0x00, 0x80, 0x18, 0x04, 0x00, 0x88, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
+    0x70, 0x02, 0x00, 0x04, 0x00, 0x80, 0x06, 0x0B, 0x00, 0x8F, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x02, 0x08, 0x00, 0x08, 0x00, 0x03, 0x00, 0x96, 0x18, 0x00, 0x3E,
+    0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x08, 0xFE, 0x7F, 0x06, 0x00, 0x06, 0x00, 0x80, 0x7C, 0x03, 0x00, 0x95, 0x28, 0x00, 0xFC,
+    0x7F, 0xE8, 0x7F, 0x28, 0x00, 0x28, 0x00, 0x28, 0x18, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x08, 0x00, 0x09, 0x00, 0x91, 0x40, 0x00, 0x40, 0x80, 0x43, 0x00, 0x40, 0x00, 0x40, 0x60,
+    0x48, 0x00, 0x40, 0x00, 0x43, 0x00, 0x7E, 0x1E, 0x05, 0x00, 0x06, 0x00, 0x99, 0x02, 0x40, 0x02,
+    0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x49, 0x02, 0x71, 0x00, 0x7F, 0x00, 0x61, 0x00,
+    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x20, 0x02, 0x00, 0x9B, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02,
+    0x40, 0x02, 0x40, 0x06, 0x40, 0x46, 0x40, 0x46, 0x40, 0x46, 0x00, 0x44, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x40, 0x08, 0x40, 0x08, 0x40, 0x02, 0x00, 0x04, 0x00, 0x81, 0xF8, 0x03, 0x03, 0x00, 0x96,
+    0x0E, 0xF0, 0x0F, 0x00, 0x08, 0x70, 0x08, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20,
+    0x08, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x04, 0x00, 0x81, 0xE0, 0x07, 0x02, 0x00, 0x81, 0xE0,
+    0x07, 0x0F, 0x00, 0x80, 0x3C, 0x06, 0x00, 0x04, 0x00, 0x94, 0x10, 0x20, 0x10, 0x20, 0xF8, 0x27,
+    0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x00, 0x10, 0x00, 0xD0, 0x07, 0x10, 0x00, 0x10, 0x07,
+    0x00, 0x05, 0x00, 0x8C, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0xFE,
+    0x23, 0x05, 0x20, 0x81, 0x00, 0x20, 0x07, 0x00, 0x0B, 0x00, 0x90, 0x10, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x17, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0xF8, 0x1F, 0x00, 0x10, 0x04, 0x00, 0x06, 0x00,
+    0x81, 0xF0, 0x7F, 0x0D, 0x00, 0x8A, 0x20, 0xF8, 0x20, 0x00, 0x20, 0x80, 0x3F, 0x00, 0x20, 0x00,
+    0x20, 0x04, 0x00, 0x8F, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x40,
+    0x02, 0x40, 0x00, 0x40, 0x06, 0x00, 0x80, 0xE0, 0x05, 0x00, 0x09, 0x00, 0x81, 0x01, 0x70, 0x07,
+    0x00, 0x81, 0xFE, 0x1F, 0x05, 0x00, 0x80, 0x70, 0x06, 0x00, 0x04, 0x00, 0x81, 0x38, 0x1C, 0x0C,
+    0x00, 0x81, 0xC0, 0x3F, 0x0C, 0x00, 0x03, 0x00, 0x80, 0x04, 0x08, 0x00, 0x8A, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x05, 0x00, 0x80, 0x20, 0x03, 0x00, 0x02, 0x00,
+    0x95, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x0F, 0x70,
+    0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x06, 0x40, 0x02, 0x00, 0x03, 0x00, 0x9C, 0x10, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x10, 0x80, 0x10, 0x80, 0x00, 0xFE, 0x07, 0x80, 0x04, 0x00, 0x14, 0x00,
+    0x14, 0x00, 0x7C, 0x00, 0x10, 0xF8, 0x3F, 0x00, 0x10, 0x00, 0x10, 0x07, 0x00, 0x91, 0x20, 0x80,
+    0x2F, 0x00, 0x02, 0xF8, 0x0F, 0x90, 0x02, 0xD0, 0x02, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x40,
+    0x07, 0x00, 0x05, 0x00, 0x9A, 0x0F, 0x00, 0x02, 0xF8, 0x1F, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
+    0x00, 0x12, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0xFE, 0x11, 0x00, 0x10,
+    0x02, 0x00, 0x95, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x08, 0xD0, 0x3F, 0xF0, 0x3F, 0x10,
+    0x08, 0x10, 0x1E, 0x10, 0x08, 0x00, 0x08, 0x00, 0x08, 0x08, 0x00, 0x06, 0x00, 0x95, 0xC0, 0x00,
+    0x40, 0x00, 0xFC, 0x7F, 0x40, 0x02, 0xF0, 0x02, 0x40, 0x02, 0x40, 0x02, 0xF0, 0x03, 0x40, 0x01,
+    0x40, 0x01, 0x00, 0x01, 0x04, 0x00, 0x06, 0x00, 0x85, 0x80, 0x00, 0x80, 0x03, 0x80, 0x1E, 0x02,
+    0x00, 0x80, 0x0C, 0x0B, 0x00, 0x82, 0xF8, 0x1F, 0xFC, 0x03, 0x00, 0x16, 0x00, 0x87, 0xE0, 0x0F,
+    0x00, 0x06, 0x00, 0x10, 0x00, 0x10, 0x02, 0x00, 0x05, 0x00, 0x9A, 0x40, 0x38, 0x40, 0x00, 0x40,
+    0x7E, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7C, 0x00, 0x60,
+    0x00, 0x60, 0x00, 0x60, 0x00, 0x20, 0x03, 0x00, 0x98, 0x02, 0x04, 0x02, 0xE4, 0x03, 0x04, 0x40,
+    0x0C, 0x40, 0x0C, 0x40, 0x0C, 0x40, 0x0C, 0x40, 0x0C, 0x40, 0x0C, 0x40, 0x04, 0x40, 0x00, 0x40,
+    0x00, 0x40, 0x04, 0x00, 0x02, 0x00, 0x06, 0x04, 0x94, 0x84, 0x04, 0xF4, 0x3F, 0x84, 0x04, 0xC4,
+    0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x04, 0x00, 0xFC, 0x03, 0x00,
+    0x03, 0x00, 0x8A, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x01, 0xFE, 0x3F, 0x05, 0x00,
+    0x89, 0x01, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0xA0, 0x00, 0x20, 0x03, 0x00, 0x02, 0x00, 0x96,
+    0x80, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0xFA, 0x03, 0x82, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x07, 0x00, 0x13, 0x00, 0x8C, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0xE0, 0x7F, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x09, 0x00, 0x92, 0x20, 0x08, 0x20, 0x08,
+    0x20, 0x08, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x04,
+    0x00, 0x10, 0x00, 0x80, 0x3C, 0x09, 0x00, 0x83, 0xE0, 0x03, 0xC0, 0x1F, 0x02, 0x00, 0x02, 0x00,
+    0x88, 0x02, 0x00, 0x02, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x02, 0x00, 0x90, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x02, 0x00,
+    0x04, 0x00, 0x99, 0xE0, 0x0F, 0x00, 0x01, 0x00, 0x05, 0x00, 0x45, 0x00, 0x45, 0x00, 0x45, 0xF8,
+    0x7F, 0x00, 0x45, 0x00, 0x49, 0x00, 0x49, 0xE0, 0x7F, 0x00, 0x08, 0x00, 0x08, 0x02, 0x00, 0x02,
+    0x00, 0x96, 0x20, 0x00, 0x20, 0x00, 0x24, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x00,
+    0x06, 0x00, 0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x04, 0x00, 0x82, 0x08, 0x40, 0x08, 0x02,
+    0x00, 0x9A, 0x80, 0x00, 0xF0, 0x1F, 0x80, 0x00, 0x88, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x0F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x0F, 0x80, 0x08, 0x80, 0x08, 0x80, 0x03, 0x00, 0x09,
+    0x00, 0x80, 0x0F, 0x07, 0x00, 0x82, 0x7F, 0x00, 0x40, 0x06, 0x00, 0x81, 0xF8, 0x03, 0x04, 0x00,
+    0x04, 0x00, 0x90, 0xFA, 0x7F, 0x82, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFA,
+    0x3F, 0x02, 0x00, 0x02, 0x06, 0x00, 0x80, 0x60, 0x04, 0x00, 0x02, 0x00, 0x98, 0x02, 0x00, 0x02,
+    0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x70, 0x00, 0x40, 0x00, 0x40, 0x02, 0x00, 0x80, 0x3C, 0x02, 0x00, 0x06, 0x00, 0x8C, 0x20,
+    0x00, 0xF8, 0x03, 0x20, 0x00, 0x20, 0x00, 0x2E, 0x00, 0x20, 0x00, 0x20, 0x03, 0x00, 0x86, 0x80,
+    0x3F, 0x04, 0x00, 0x04, 0x00, 0x04, 0x03, 0x00, 0x02, 0x00, 0x84, 0x02, 0x00, 0x02, 0x00, 0x02,
+    0x03, 0x00, 0x95, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xFC, 0x7F, 0x24,
+    0x00, 0x24, 0x00, 0x24, 0x00, 0x20, 0x00, 0x20, 0x00, 0x05, 0x00, 0x9A, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0xF8, 0x1F, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x05, 0x00, 0x9A, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x06, 0x08, 0x06, 0x08, 0x06, 0x00, 0x06, 0xF4, 0x0F, 0x04, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0xE0, 0x3F, 0x00, 0x04, 0x0E, 0x00, 0x8D, 0x60, 0x00, 0xFE, 0x3F, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x02, 0x00, 0x82, 0x10, 0x00, 0x04, 0x05, 0x00,
+    0x82, 0x78, 0x00, 0x0E, 0x09, 0x00, 0x86, 0x44, 0x00, 0x04, 0x00, 0x04, 0x10, 0x04, 0x03, 0x00,
+    0x02, 0x00, 0x9B, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x20, 0xF0, 0x2F, 0x80, 0x20, 0x80, 0x20, 0x00, 0x20, 0x00, 0x20, 0x02,
+    0x00, 0x04, 0x00, 0x81, 0xF8, 0x1F, 0x02, 0x00, 0x80, 0xC0, 0x02, 0x00, 0x8E, 0x03, 0x1C, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0xC0, 0x03, 0x00, 0x02, 0x00, 0x02, 0x02, 0x00, 0x80, 0x08,
+    0x03, 0x00, 0x06, 0x00, 0x80, 0xF0, 0x02, 0x00, 0x92, 0x02, 0x00, 0x02, 0x80, 0x02, 0x80, 0x02,
+    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x3F, 0x00, 0x02, 0x04, 0x00, 0x0B, 0x00,
+    0x8F, 0x01, 0xC0, 0x0F, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x00, 0x40, 0x00, 0x40, 0x78,
+    0x40, 0x05, 0x00, 0x07, 0x00, 0x95, 0x04, 0xFC, 0x0F, 0x00, 0x04, 0x38, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x00, 0x20, 0x00, 0x20, 0x78, 0x20, 0x03, 0x00, 0x04, 0x00,
+    0x99, 0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x08, 0xC0,
+    0x08, 0xC0, 0x08, 0x40, 0x08, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x08, 0x02, 0x00, 0x08, 0x00, 0x8F,
+    0xFE, 0x7F, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x1E, 0x00, 0x02,
+    0x04, 0x00, 0x81, 0xF8, 0x3F, 0x02, 0x00, 0x04, 0x00, 0x99, 0xFE, 0x10, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0xF8, 0x17, 0xFE, 0x01, 0x08, 0x01,
+    0x08, 0x01, 0xFC, 0x7F, 0x02, 0x00, 0x05, 0x00, 0x98, 0x60, 0x00, 0x60, 0x04, 0x60, 0x04, 0x60,
+    0x84, 0x60, 0x84, 0x64, 0x84, 0x64, 0x84, 0x60, 0x84, 0x60, 0x84, 0x60, 0x80, 0x20, 0x00, 0x20,
+    0x00, 0x20, 0x02, 0x00, 0x04, 0x00, 0x8A, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x84, 0x01, 0x04,
+    0x0F, 0x04, 0x09, 0x00, 0x81, 0xFE, 0x03, 0x06, 0x00, 0x06, 0x00, 0x99, 0xFC, 0x01, 0x0A, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xE8, 0x0F, 0x08, 0x20, 0x00, 0x20,
+    0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x03, 0x00, 0x12, 0x08, 0x87, 0x00, 0xFE, 0x01, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x03, 0x00, 0x07, 0x00, 0x96, 0x21, 0xE0, 0x23, 0xC0, 0x3F, 0x00, 0x21, 0x00,
+    0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x20, 0x02,
+    0x00, 0x04, 0x00, 0x82, 0x20, 0x00, 0x20, 0x08, 0x00, 0x03, 0x20, 0x8B, 0xF8, 0x3F, 0x20, 0x30,
+    0x00, 0x30, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x02, 0x00, 0x04, 0x00, 0x86, 0xE0, 0x07, 0x60,
+    0x00, 0x60, 0x00, 0x60, 0x08, 0x00, 0x8C, 0x04, 0x00, 0x04, 0xFE, 0x3F, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x04, 0x02, 0x00, 0x8E, 0x40, 0x00, 0x40, 0x00, 0x40, 0x1F, 0x40, 0x00, 0x40,
+    0x01, 0x40, 0x01, 0x40, 0x00, 0x40, 0x0A, 0x00, 0x80, 0x0F, 0x04, 0x00, 0x06, 0x00, 0x96, 0x80,
+    0x00, 0x80, 0x08, 0x80, 0x08, 0xA0, 0x08, 0xA0, 0x08, 0xA0, 0x08, 0xA0, 0x08, 0xA0, 0x00, 0xFC,
+    0x6F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x07, 0x00, 0x98, 0x1C, 0x40, 0x04, 0x40, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+    0x10, 0x02, 0x00, 0x02, 0x04, 0x00, 0x95, 0xC0, 0x05, 0x00, 0x06, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x06, 0x00, 0x02,
+    0x00, 0x9D, 0x20, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x32, 0x00, 0x32, 0x00, 0xFE, 0x7F,
+    0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0xF2, 0x01, 0xFE, 0x00, 0x22, 0x00, 0x22, 0x00, 0x20, 0x00,
+    0x04, 0x00, 0x9B, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x06, 0x08,
+    0x06, 0x08, 0x06, 0x08, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x02, 0x0E,
+    0x00, 0x91, 0xF8, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x1D, 0x80, 0x00, 0xC0, 0x00,
+    0xF8, 0x03, 0x88, 0x00, 0x04, 0x00, 0x81, 0xFC, 0x7F, 0x06, 0x00, 0x8B, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0xFC, 0x1F, 0x08, 0x00, 0x04, 0x00, 0x98, 0xE0, 0x0F, 0x00,
+    0x06, 0x0A, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x02, 0x0F, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0xFA, 0x3F, 0x02, 0x03, 0x00, 0x0B, 0x00, 0x90, 0x60, 0x00, 0x60, 0x00, 0x60,
+    0x00, 0x60, 0x00, 0x60, 0x80, 0x67, 0x00, 0x20, 0x00, 0x20, 0xF0, 0x01, 0x04, 0x00, 0x07, 0x00,
+    0x98, 0x39, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x09, 0x08, 0x0A, 0xFC, 0x1F, 0x08, 0x0A,
+    0x08, 0x0A, 0x08, 0x0A, 0x08, 0x0A, 0xFE, 0x7F, 0x08, 0x0A, 0x02, 0x00, 0x9D, 0x20, 0x00, 0x20,
+    0x00, 0x20, 0x04, 0x20, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+    0x4C, 0x04, 0x4C, 0x04, 0x4C, 0x04, 0x4C, 0x00, 0x0C, 0x00, 0x0C, 0x06, 0x00, 0x97, 0x10, 0x40,
+    0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x48, 0x10, 0x48, 0x10, 0x48, 0x10, 0x48,
+    0x10, 0x1E, 0x00, 0x08, 0x00, 0x08, 0x02, 0x00, 0x10, 0x00, 0x82, 0x40, 0x00, 0x40, 0x06, 0x00,
+    0x80, 0x0F, 0x02, 0x00, 0x81, 0xE0, 0x1F, 0x02, 0x00, 0x04, 0x00, 0x9B, 0x08, 0x00, 0x08, 0x3F,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02,
+    0x08, 0x02, 0xE8, 0x1F, 0x08, 0x02, 0x00, 0x02, 0x04, 0x00, 0x80, 0xFE, 0x04, 0x00, 0x8C, 0x18,
+    0x20, 0x00, 0x38, 0x04, 0x20, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x0A, 0x00, 0x05, 0x00,
+    0x9A, 0x02, 0x00, 0x02, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12,
+    0x00, 0x12, 0x00, 0x12, 0xC0, 0x1F, 0x00, 0x12, 0x00, 0x12, 0x00, 0x02, 0x05, 0x00, 0x8C, 0x01,
+    0x00, 0x11, 0x00, 0x10, 0x00, 0x50, 0x00, 0x7E, 0x00, 0x50, 0x10, 0x50, 0x03, 0x10, 0x88, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0xFE, 0x0F, 0x02, 0x00, 0x04, 0x00, 0x8C, 0x82, 0x00, 0x82,
+    0x3F, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x02, 0x08, 0x00, 0x84, 0x02, 0xFE, 0x7B,
+    0x00, 0x02, 0x02, 0x00, 0x05, 0x00, 0x9A, 0x04, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x7F, 0x00, 0x0C,
+    0x00, 0x0C, 0x00, 0x3F, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0xF8, 0x04, 0x00, 0x3C, 0x00, 0x04,
+    0x00, 0x04, 0x04, 0x00, 0x9B, 0xC0, 0x1F, 0xF8, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x10, 0x02, 0xFE, 0x7F, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x04, 0x00,
+    0x04, 0x05, 0x00, 0x95, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x84, 0x00, 0x84,
+    0x00, 0x8C, 0x00, 0xFE, 0x7F, 0x04, 0x00, 0x04, 0x00, 0x04, 0x02, 0x00, 0x80, 0x18, 0x02, 0x00,
+    0x04, 0x00, 0x8F, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x38, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x20, 0x00, 0x06, 0x20, 0x02, 0x00, 0x81, 0xFC, 0x1F, 0x02, 0x00, 0x08, 0x00, 0x81, 0xFC,
+    0x0F, 0x0A, 0x00, 0x81, 0xF8, 0x07, 0x0A, 0x00, 0x04, 0x00, 0x97, 0x02, 0x00, 0x02, 0x00, 0xC2,
+    0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x04, 0xFC, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x04, 0x00, 0x05, 0x00, 0x94, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+    0x18, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0xFE, 0x3F, 0x00, 0x10, 0x06, 0x00, 0x0E,
+    0x00, 0x8E, 0x40, 0x00, 0x40, 0x00, 0x40, 0x0C, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00,
+    0x10, 0x03, 0x00, 0x02, 0x00, 0x9A, 0x02, 0x00, 0x02, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x03, 0xF2, 0x03, 0x42, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, 0x00,
+    0x20, 0x03, 0x00, 0x07, 0x00, 0x80, 0x40, 0x04, 0x00, 0x80, 0xC0, 0x04, 0x00, 0x8C, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0xFE, 0x5F, 0x00, 0x42, 0xF8, 0x5F, 0x00, 0x40, 0x02, 0x00, 0x07, 0x00, 0x94,
+    0x04, 0x20, 0x04, 0x20, 0x00, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x08, 0x00, 0x95, 0x08, 0x01, 0x08, 0x00, 0x08, 0x00,
+    0x0A, 0x00, 0xFE, 0x1F, 0x0A, 0x00, 0x0A, 0x20, 0x0A, 0x60, 0x02, 0x60, 0x02, 0x40, 0x02, 0x40,
+    0x02, 0x00, 0x05, 0x00, 0x98, 0x10, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,
+    0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0xE0, 0x0F, 0x00, 0x08, 0x02, 0x00,
+    0x03, 0x00, 0x8A, 0x60, 0x00, 0x60, 0x00, 0x60, 0x20, 0x60, 0x20, 0x60, 0x20, 0x60, 0x07, 0x20,
+    0x02, 0x00, 0x80, 0x08, 0x03, 0x00, 0x80, 0x0F, 0x04, 0x00, 0x08, 0x00, 0x97, 0x40, 0x00, 0x40,
+    0x00, 0x40, 0x0E, 0x40, 0x00, 0x40, 0x00, 0xF0, 0x03, 0x40, 0x00, 0x44, 0x00, 0x04, 0x00, 0xFE,
+    0x01, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x94, 0x80, 0x01, 0x80, 0x20, 0x80, 0x23, 0x80, 0x20,
+    0x80, 0x20, 0x80, 0x20, 0x90, 0x20, 0x90, 0x20, 0x90, 0x00, 0x90, 0x1E, 0x90, 0x07, 0x00, 0x07,
+    0x00, 0x98, 0x20, 0xC0, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x80, 0x3F, 0x00, 0x2B, 0x00, 0x28, 0x00, 0x28, 0x00, 0x08, 0x02, 0x00, 0x96, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x02, 0x88, 0x1F, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0xF8, 0x01, 0x0E, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x07, 0x00, 0x0D, 0x00, 0x92, 0x01, 0x00, 0x7F, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0xF8, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03, 0x00, 0x91,
+    0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0xC0, 0x17, 0x40, 0x10, 0xC0, 0x1F, 0x40,
+    0x10, 0x40, 0x03, 0x00, 0x81, 0xC0, 0x3F, 0x06, 0x00, 0x0C, 0x00, 0x90, 0x10, 0x00, 0x10, 0x02,
+    0x30, 0x02, 0xFE, 0x3F, 0x30, 0x02, 0xF8, 0x01, 0x30, 0x00, 0x10, 0x00, 0x06, 0x03, 0x00, 0x05,
+    0x00, 0x85, 0x1E, 0x40, 0x00, 0x40, 0x00, 0x70, 0x09, 0x00, 0x81, 0xFE, 0x07, 0x0A, 0x00, 0x05,
+    0x00, 0x9A, 0x01, 0x40, 0x01, 0xFE, 0x7F, 0x00, 0x01, 0x20, 0x11, 0x20, 0x11, 0x20, 0x11, 0x20,
+    0x10, 0x20, 0x10, 0x20, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x08, 0x00, 0x03, 0x00, 0x88,
+    0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x0E, 0x00, 0x85, 0x08, 0x3F, 0x08, 0x00,
+    0x08, 0x00, 0x07, 0x00, 0x84, 0x46, 0x00, 0x40, 0x00, 0x40, 0x09, 0x00, 0x8A, 0x02, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x07, 0x00, 0x98, 0x20, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x20, 0x00, 0x23, 0x00, 0x20, 0x00, 0x20, 0xC0, 0x3F, 0x00, 0x20, 0xF0, 0x21, 0x00, 0x20,
+    0x00, 0x20, 0x00, 0x20, 0x08, 0x00, 0x81, 0x80, 0x03, 0x02, 0x00, 0x80, 0xC0, 0x07, 0x00, 0x81,
+    0xC0, 0x3F, 0x0A, 0x00, 0x04, 0x00, 0x80, 0x02, 0x10, 0x00, 0x8A, 0x02, 0x00, 0x02, 0x40, 0x02,
+    0x40, 0x02, 0x40, 0x00, 0x40, 0x00, 0x06, 0x00, 0x80, 0x20, 0x09, 0x00, 0x8C, 0x02, 0x00, 0x02,
+    0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x03, 0x00, 0x03, 0x00, 0x80, 0x20,
+    0x02, 0x00, 0x90, 0x82, 0x7F, 0x3E, 0x00, 0xFA, 0x1F, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x02, 0x02, 0x00, 0x80, 0x0C, 0x06, 0x00, 0x05, 0x00, 0x90, 0x07, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0xE0, 0x7F, 0x00, 0x38, 0x0A, 0x00,
+    0x09, 0x00, 0x8F, 0x04, 0x00, 0x04, 0x00, 0x7C, 0x00, 0x40, 0x00, 0x40, 0x80, 0x5F, 0x00, 0x40,
+    0x00, 0x40, 0x3C, 0x03, 0x00, 0x81, 0xC0, 0x1F, 0x02, 0x00, 0x07, 0x00, 0x96, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0xC0, 0x05, 0x00, 0x04, 0x00, 0x04,
+    0xFC, 0x07, 0x00, 0x04, 0x02, 0x00, 0x05, 0x00, 0x9A, 0x78, 0xF0, 0x03, 0x40, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x00, 0x0B, 0x00, 0x86, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x5F, 0x08, 0x00,
+    0x81, 0xF8, 0x03, 0x04, 0x00, 0x0B, 0x00, 0x82, 0x40, 0x00, 0x40, 0x06, 0x00, 0x84, 0x20, 0x00,
+    0x20, 0x00, 0x1C, 0x07, 0x00, 0x07, 0x00, 0x90, 0x10, 0x00, 0x10, 0x00, 0x10, 0x38, 0x10, 0x20,
+    0x12, 0x20, 0x12, 0x20, 0x12, 0x20, 0x12, 0x00, 0x10, 0x08, 0x00, 0x04, 0x00, 0x96, 0xFC, 0x1F,
+    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xA0, 0x40, 0xA0, 0x40, 0xA0, 0x40, 0xA0, 0x40, 0x20, 0x00,
+    0x3C, 0x00, 0x20, 0x00, 0x20, 0x05, 0x00, 0x06, 0x00, 0x83, 0xFE, 0x07, 0x80, 0x03, 0x03, 0x00,
+    0x80, 0x3C, 0x12, 0x00, 0x05, 0x00, 0x8E, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x18, 0xF0, 0x1B, 0x00, 0x18, 0x0C, 0x00, 0x02, 0x00, 0x9A, 0x04, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x14, 0x00, 0x14, 0x07, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x10, 0x38, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x03, 0x00, 0x02, 0x00, 0x96, 0x40, 0x00, 0x40, 0x00, 0x42,
+    0x00, 0xF2, 0x0F, 0x42, 0x20, 0x40, 0x20, 0x60, 0x20, 0xE0, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60,
+    0x00, 0x40, 0x07, 0x00, 0x06, 0x00, 0x8C, 0xF8, 0x3F, 0x10, 0x00, 0xFE, 0x1F, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x05, 0x00, 0x81, 0x80, 0x3F, 0x06, 0x00, 0x05, 0x00, 0x96, 0x20, 0x00,
+    0x20, 0xFC, 0x21, 0xE0, 0x3F, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x61, 0x00, 0x61, 0x00,
+    0x61, 0x00, 0x61, 0x00, 0x21, 0x04, 0x00, 0x08, 0x00, 0x88, 0x60, 0x00, 0xF0, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x40, 0x0F, 0x00, 0x04, 0x00, 0x85, 0xFC, 0x4F, 0x00, 0x40, 0x00, 0x40, 0x06, 0x00,
+    0x81, 0xF0, 0x7F, 0x08, 0x00, 0x85, 0xC0, 0x7F, 0xE0, 0x09, 0x00, 0x08, 0x0A, 0x00, 0x81, 0xF0,
+    0x0F, 0x06, 0x00, 0x81, 0xFC, 0x7F, 0x04, 0x00, 0x81, 0xF8, 0x0F, 0x06, 0x00, 0x05, 0x00, 0x90,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0xC0,
+    0x7F, 0x02, 0x00, 0x81, 0xE0, 0x7F, 0x02, 0x00, 0x81, 0xF0, 0x7F, 0x02, 0x00, 0x04, 0x00, 0x81,
+    0xF8, 0x3F, 0x0D, 0x00, 0x88, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0E, 0x04, 0x00,
+    0x03, 0x00, 0x97, 0x08, 0x00, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x10, 0x1F, 0x10, 0x00, 0x10, 0x00, 0x16, 0x05, 0x00, 0x05, 0x00, 0x80,
+    0x7E, 0x03, 0x00, 0x90, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x10, 0x04, 0x10,
+    0x04, 0x10, 0x04, 0x10, 0x04, 0x02, 0x00, 0x80, 0x38, 0x03, 0x00, 0x03, 0x00, 0x9C, 0x10, 0x00,
+    0x10, 0x20, 0x10, 0x00, 0x7E, 0x00, 0x18, 0xF0, 0x3F, 0x00, 0x38, 0x00, 0x38, 0x04, 0x28, 0x04,
+    0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x00, 0x08, 0x05, 0x00, 0x96, 0x18, 0x00,
+    0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x00, 0x08, 0x01, 0x08, 0x0D, 0x08,
+    0x01, 0x08, 0x01, 0x00, 0x01, 0x04, 0x00, 0x0A, 0x00, 0x81, 0xE0, 0x01, 0x0B, 0x00, 0x82, 0x20,
+    0x00, 0x3C, 0x06, 0x00, 0x02, 0x00, 0x96, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x20, 0x04,
+    0x20, 0x04, 0x20, 0x3C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xF4, 0x01, 0x04, 0x07, 0x00,
+    0x04, 0x00, 0x96, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xF0, 0x01, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x05, 0x00, 0x04, 0x00, 0x98, 0x08,
+    0x00, 0x28, 0x00, 0x78, 0x00, 0x28, 0x00, 0x28, 0x40, 0x28, 0x40, 0xA8, 0x43, 0x20, 0x00, 0x22,
+    0x00, 0xE2, 0x3F, 0x02, 0x00, 0x02, 0x00, 0x02, 0x03, 0x00, 0x06, 0x00, 0x81, 0xE0, 0x7F, 0x09,
+    0x00, 0x80, 0x0F, 0x08, 0x00, 0x81, 0xFE, 0x07, 0x04, 0x00, 0x02, 0x00, 0x95, 0x02, 0x00, 0x82,
+    0x00, 0x82, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0xFE, 0x40, 0x80, 0x40, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x40, 0x02, 0x00, 0x81, 0xC0, 0x03, 0x04, 0x00, 0x04, 0x00, 0x91, 0x80, 0x01, 0xF0,
+    0x00, 0xE0, 0x11, 0x00, 0x10, 0xFE, 0x1F, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x03,
+    0x00, 0x82, 0x60, 0xF0, 0x1F, 0x04, 0x00, 0x03, 0x00, 0x81, 0x10, 0x00, 0x0A, 0x10, 0x8E, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x20, 0x00, 0x20, 0x80, 0x3F, 0x00, 0x20, 0x02, 0x00,
+    0x0D, 0x00, 0x90, 0x10, 0x00, 0x18, 0x80, 0x1B, 0x00, 0x1E, 0x00, 0x18, 0x04, 0x08, 0x04, 0x08,
+    0x04, 0x0C, 0x04, 0x08, 0x02, 0x00, 0x0A, 0x00, 0x8D, 0x80, 0x0F, 0x02, 0x00, 0x02, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x02, 0x00, 0xFE, 0x0F, 0x08, 0x00, 0x03, 0x00, 0x94, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x1E, 0x02, 0x00, 0x42, 0x00,
+    0x42, 0x08, 0x00, 0x05, 0x00, 0x87, 0x04, 0x00, 0x04, 0x78, 0x04, 0x00, 0x04, 0x00, 0x06, 0x04,
+    0x80, 0x3C, 0x02, 0x04, 0x81, 0xF4, 0x07, 0x04, 0x04, 0x83, 0x84, 0x7F, 0x04, 0x00, 0x03, 0x00,
+    0x9C, 0x41, 0x00, 0x41, 0x00, 0x7F, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41,
+    0x00, 0x41, 0x00, 0x51, 0x40, 0x17, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03, 0x00,
+    0x9C, 0x04, 0x00, 0x04, 0x40, 0x04, 0x40, 0x04, 0x40, 0x04, 0x40, 0x00, 0x40, 0x20, 0x40, 0x20,
+    0x40, 0x20, 0x40, 0x20, 0x60, 0x20, 0x60, 0x20, 0x60, 0x00, 0x60, 0x00, 0x40, 0x00, 0x05, 0x00,
+    0x95, 0x40, 0x00, 0x40, 0xFC, 0x47, 0x10, 0x40, 0x10, 0x7E, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
+    0x16, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x05, 0x00, 0x04, 0x00, 0x94, 0x0C, 0x00, 0x0C, 0x00,
+    0x0C, 0x00, 0x0C, 0x00, 0x04, 0x38, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x3E, 0x00, 0x04, 0x00,
+    0x04, 0x07, 0x00, 0x03, 0x00, 0x9C, 0x01, 0x00, 0x19, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xC0, 0x01, 0x00, 0x01, 0xFC, 0x0F, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x05, 0x00, 0x80, 0x06, 0x02, 0x00, 0x81, 0xFC, 0x03, 0x02, 0x00, 0x81, 0xFE,
+    0x03, 0x03, 0x00, 0x8E, 0x08, 0x00, 0x08, 0x00, 0x08, 0xF8, 0x1F, 0x06, 0x08, 0x04, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x08, 0x00, 0x83, 0xFC, 0x3F, 0xFC, 0x0F, 0x08, 0x00, 0x81, 0x9C, 0x0F, 0x08,
+    0x00, 0x81, 0x20, 0x00, 0x03, 0x00, 0x94, 0x10, 0x00, 0x10, 0x00, 0x10, 0x18, 0x10, 0x00, 0x10,
+    0xE0, 0x7F, 0x00, 0x10, 0x02, 0x10, 0xC2, 0x11, 0x02, 0x10, 0x3C, 0x10, 0x08, 0x00, 0x03, 0x00,
+    0x9A, 0x01, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13,
+    0x00, 0x11, 0x00, 0x11, 0x80, 0x13, 0x80, 0x31, 0x00, 0x10, 0x00, 0x10, 0x02, 0x00, 0x0D, 0x00,
+    0x82, 0x40, 0x00, 0x40, 0x05, 0x00, 0x88, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x80, 0x07,
+    0x02, 0x00, 0x04, 0x00, 0x83, 0xE0, 0x7F, 0x20, 0x40, 0x02, 0x00, 0x81, 0xE0, 0x07, 0x03, 0x00,
+    0x80, 0x3F, 0x02, 0x00, 0x80, 0x18, 0x07, 0x00, 0x81, 0xF0, 0x07, 0x04, 0x00, 0x02, 0x00, 0x97,
+    0x10, 0x00, 0xFC, 0x03, 0x32, 0x00, 0x12, 0x00, 0x12, 0x00, 0x02, 0x00, 0x1A, 0x00, 0xE2, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xE0, 0x0F, 0x06, 0x00, 0x06, 0x00, 0x81, 0xE0, 0x0F, 0x0C,
+    0x00, 0x81, 0xC0, 0x3F, 0x03, 0x00, 0x80, 0x7E, 0x06, 0x00, 0x08, 0x00, 0x97, 0x20, 0x00, 0x20,
+    0x70, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0xE0, 0x09, 0x20,
+    0x00, 0x20, 0x00, 0x20, 0x00, 0x03, 0x00, 0x98, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x80,
+    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x7A, 0x00,
+    0x02, 0x04, 0x00, 0x03, 0x00, 0x9A, 0x40, 0x00, 0x7E, 0x00, 0x40, 0xFE, 0x7F, 0x10, 0x40, 0x10,
+    0x40, 0x14, 0x4C, 0x84, 0x7F, 0x04, 0x40, 0x04, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+    0x40, 0x02, 0x00, 0x09, 0x00, 0x80, 0x60, 0x09, 0x00, 0x8A, 0x02, 0x00, 0x02, 0x00, 0x12, 0x00,
+    0x12, 0x00, 0x02, 0x00, 0x02, 0x02, 0x00, 0x04, 0x00, 0x81, 0x80, 0x03, 0x04, 0x00, 0x8F, 0xF0,
+    0x7F, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x7E, 0x40, 0x02,
+    0x00, 0x81, 0xF8, 0x1F, 0x02, 0x00, 0x08, 0x00, 0x82, 0xFE, 0x3F, 0x1C, 0x11, 0x00, 0x83, 0x08,
+    0x00, 0x08, 0x00, 0x05, 0x00, 0x84, 0x40, 0x00, 0x5F, 0x00, 0x40, 0x02, 0x00, 0x90, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x08, 0x00, 0x38, 0x80, 0x03,
+    0x00, 0x0B, 0x00, 0x8C, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x22, 0x00, 0x22, 0x00,
+    0x20, 0x04, 0x00, 0x81, 0xF0, 0x7F, 0x02, 0x00, 0x02, 0x00, 0x92, 0x20, 0x00, 0xF0, 0x7F, 0x20,
+    0x00, 0x20, 0x00, 0xFC, 0x07, 0xF0, 0x0F, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x03, 0x00,
+    0x87, 0xFA, 0x00, 0x02, 0x00, 0xFE, 0x1F, 0x02, 0x00, 0x04, 0x00, 0x9B, 0x20, 0x38, 0x30, 0x42,
+    0x30, 0x42, 0x30, 0x42, 0x30, 0x42, 0x30, 0x48, 0x30, 0x48, 0x30, 0x40, 0x30, 0x40, 0x10, 0x40,
+    0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x08, 0x00, 0x81, 0xFE, 0x3F, 0x03, 0x00, 0x87,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0C, 0x02, 0x00, 0x80, 0x1F, 0x08, 0x00, 0x06, 0x00,
+    0x81, 0xF0, 0x07, 0x04, 0x00, 0x81, 0xF8, 0x1F, 0x08, 0x00, 0x81, 0xFE, 0x0F, 0x05, 0x00, 0x80,
+    0x07, 0x02, 0x00, 0x05, 0x00, 0x8C, 0x48, 0x00, 0x4A, 0x00, 0x4A, 0x10, 0x4A, 0x02, 0x4A, 0x02,
+    0x4A, 0x02, 0x4A, 0x04, 0x02, 0x84, 0xFA, 0x7F, 0x02, 0x00, 0x3A, 0x05, 0x00, 0x05, 0x00, 0x9A,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x60, 0x80, 0x20, 0xF8, 0x20, 0xC0,
+    0x20, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0xFE, 0x01, 0x40, 0x00, 0x09, 0x00, 0x94, 0x7F, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x14, 0x88, 0x14, 0x88, 0x10, 0x88, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08,
+    0x10, 0x08, 0x10, 0x02, 0x00, 0x04, 0x00, 0x80, 0xE0, 0x05, 0x00, 0x93, 0xFE, 0x0F, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xFC, 0x0F, 0x00, 0x01, 0x00, 0x01,
+    0x02, 0x00, 0x06, 0x00, 0x95, 0xFE, 0x7F, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0xE0, 0x3F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x04, 0x00, 0x04, 0x00, 0x83,
+    0xFC, 0x10, 0xF0, 0x7F, 0x06, 0x00, 0x82, 0x40, 0x00, 0x40, 0x0F, 0x00, 0x05, 0x00, 0x94, 0x40,
+    0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0xFC, 0x7F, 0xE0, 0x7F, 0x00, 0x40, 0xFE, 0x43, 0x7E, 0x40,
+    0x00, 0x40, 0x00, 0x40, 0x06, 0x00, 0x03, 0x00, 0x96, 0x40, 0x00, 0x40, 0xF8, 0x40, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x40, 0x00, 0x40, 0x00, 0x08, 0xFC, 0x0B,
+    0x02, 0x08, 0x04, 0x00, 0x04, 0x00, 0x98, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x18, 0x20,
+    0x00, 0x30, 0x00, 0x30, 0x00, 0xFE, 0x2F, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x10,
+    0x03, 0x00, 0x03, 0x00, 0x99, 0x10, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x80, 0x11, 0x80, 0x11,
+    0x80, 0x11, 0x80, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x10, 0x08, 0x10, 0x08, 0x03,
+    0x00, 0x05, 0x00, 0x8D, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10,
+    0x40, 0x10, 0x08, 0x00, 0x80, 0x40, 0x04, 0x00, 0x03, 0x00, 0x9C, 0x08, 0x00, 0x48, 0x00, 0x48,
+    0x10, 0x48, 0x10, 0x49, 0x10, 0x49, 0x10, 0x49, 0x10, 0x49, 0x10, 0x49, 0x10, 0x48, 0x10, 0x48,
+    0x10, 0x48, 0x10, 0x48, 0x00, 0x08, 0x00, 0x08, 0x08, 0x00, 0x83, 0x20, 0x00, 0x20, 0x78, 0x04,
+    0x00, 0x81, 0xE0, 0x3F, 0x05, 0x00, 0x85, 0x0E, 0x28, 0x00, 0x20, 0x00, 0x20, 0x03, 0x00, 0x03,
+    0x00, 0x99, 0x04, 0x00, 0x04, 0x00, 0x04, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x01, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0xF0, 0x01, 0x10, 0x00, 0x10, 0x03, 0x00, 0x06, 0x00,
+    0x80, 0x7C, 0x03, 0x00, 0x81, 0xE0, 0x07, 0x04, 0x00, 0x83, 0x80, 0x03, 0x00, 0x0E, 0x0C, 0x00,
+    0x0A, 0x00, 0x8A, 0xE0, 0x7F, 0x20, 0x00, 0xF8, 0x01, 0x20, 0x00, 0x20, 0x00, 0x20, 0x02, 0x00,
+    0x80, 0x60, 0x08, 0x00, 0x02, 0x00, 0x99, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFA, 0x1F, 0x02,
+    0x00, 0x7E, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x78, 0xF8,
+    0x0F, 0x04, 0x00, 0x05, 0x00, 0x98, 0x20, 0x00, 0x20, 0xF0, 0x2F, 0x40, 0x09, 0x40, 0x09, 0x40,
+    0x09, 0x40, 0x09, 0x60, 0x09, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x00, 0x01, 0x02,
+    0x00, 0x0A, 0x00, 0x80, 0x78, 0x0B, 0x00, 0x80, 0x7E, 0x02, 0x00, 0x80, 0x40, 0x06, 0x00, 0x04,
+    0x00, 0x9B, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00,
+    0x50, 0x00, 0xFE, 0x1F, 0x10, 0x00, 0x10, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x10, 0x00, 0x05, 0x00,
+    0x81, 0x7F, 0x00, 0x07, 0x08, 0x82, 0xFC, 0x0B, 0x88, 0x05, 0x08, 0x81, 0x00, 0x08, 0x08, 0x00,
+    0x0B, 0x00, 0x89, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x00, 0x80, 0x00, 0x80, 0x02, 0x00, 0x82,
+    0x01, 0x9C, 0x01, 0x06, 0x00, 0x07, 0x00, 0x94, 0x08, 0x00, 0x08, 0xF8, 0x0B, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0xF8, 0x0F, 0xC0, 0x01, 0x03, 0x00, 0x80,
+    0x20, 0x02, 0x00, 0x9D, 0x04, 0x08, 0x04, 0x28, 0x14, 0x28, 0x14, 0x28, 0xFC, 0x3F, 0x14, 0x28,
+    0x04, 0x28, 0x04, 0x28, 0x00, 0x20, 0xFE, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0xC0, 0x2F,
+    0x00, 0x20, 0x10, 0x00, 0x82, 0xFC, 0x07, 0x30, 0x07, 0x00, 0x82, 0x02, 0x00, 0x02, 0x03, 0x00,
+    0x09, 0x00, 0x90, 0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42,
+    0x00, 0x42, 0x00, 0x42, 0x06, 0x00, 0x06, 0x00, 0x8E, 0xF0, 0x7F, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0xF8, 0x1F, 0x80, 0x00, 0x80, 0x02, 0x00, 0x80, 0x7C, 0x02, 0x00, 0x81, 0xFC,
+    0x07, 0x04, 0x00, 0x0A, 0x00, 0x90, 0x20, 0x00, 0xA0, 0x00, 0xA2, 0x00, 0xFE, 0x00, 0xA2, 0x00,
+    0xA2, 0x00, 0xA2, 0x00, 0xA2, 0x00, 0x82, 0x05, 0x00, 0x05, 0x00, 0x82, 0x40, 0x00, 0x40, 0x05,
+    0x00, 0x92, 0x04, 0x00, 0x0C, 0x00, 0x0C, 0x04, 0x0C, 0x00, 0x0C, 0x00, 0x4C, 0x00, 0x7C, 0x00,
+    0x4C, 0x00, 0x4C, 0x00, 0x48, 0x02, 0x00, 0x88, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
+    0x10, 0x07, 0x00, 0x80, 0x18, 0x05, 0x00, 0x80, 0x7C, 0x07, 0x00, 0x07, 0x00, 0x88, 0x7E, 0xC0,
+    0x3F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x03, 0x00, 0x8A, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0xF8, 0x07, 0x00, 0x04, 0x02, 0x00, 0x06, 0x00, 0x94, 0x42, 0x00, 0x7E, 0x00, 0xF2, 0x07,
+    0x42, 0x00, 0xC2, 0x0F, 0x42, 0x00, 0xFE, 0x03, 0x42, 0x00, 0x42, 0x00, 0x40, 0x00, 0x40, 0x05,
+    0x00, 0x0D, 0x00, 0x8E, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0xF8, 0x67, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0x04, 0x00, 0x04, 0x00, 0x81, 0xFE, 0x3F, 0x09, 0x00, 0x80, 0x78, 0x06, 0x00,
+    0x83, 0xF8, 0x07, 0xE0, 0x1F, 0x04, 0x00, 0x81, 0x02, 0x00, 0x03, 0x00, 0x9A, 0x05, 0x00, 0x05,
+    0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x11, 0x00, 0x11, 0xF0, 0x1F,
+    0xF8, 0x7F, 0x00, 0x10, 0x00, 0x10, 0x80, 0x07, 0x02, 0x00, 0x05, 0x00, 0x90, 0x20, 0x00, 0x20,
+    0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x02, 0x04, 0x02, 0x04, 0x0A, 0x00,
+    0x0C, 0x00, 0x88, 0x08, 0x00, 0xFE, 0x7F, 0x0A, 0x00, 0x0A, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x00,
+    0x85, 0x02, 0x00, 0x02, 0x20, 0x02, 0x20, 0x02, 0x02, 0x95, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03,
+    0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x01, 0x0A, 0x01, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x04, 0x00, 0x96, 0xE0, 0x7F, 0x00, 0x04, 0xF8, 0x05, 0x00, 0x05, 0x00, 0x05, 0x60, 0x05, 0x60,
+    0x05, 0xE0, 0x05, 0x40, 0x01, 0x40, 0x00, 0x40, 0x00, 0x40, 0x05, 0x00, 0x05, 0x00, 0x94, 0x02,
+    0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0xFC, 0x03, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x7E, 0x06, 0x00, 0x0E, 0x00, 0x8F, 0x08, 0x04, 0x28, 0x04, 0xFC, 0x05, 0x3C,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x02, 0x00, 0x09, 0x00, 0x80, 0x07, 0x04,
+    0x00, 0x80, 0xC0, 0x06, 0x00, 0x88, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x1C, 0x02,
+    0x00, 0x05, 0x00, 0x92, 0x38, 0x04, 0x08, 0x00, 0x08, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x08, 0x00,
+    0x0A, 0x00, 0x0A, 0x80, 0x7F, 0x00, 0x08, 0x08, 0x00, 0x07, 0x00, 0x80, 0x04, 0x0A, 0x00, 0x8B,
+    0xF8, 0x3F, 0x00, 0x40, 0xFE, 0x7F, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x02, 0x00, 0x02, 0x00,
+    0x99, 0x04, 0x00, 0x04, 0x00, 0x04, 0x1F, 0x0C, 0x00, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08,
+    0x02, 0x08, 0x02, 0x08, 0x02, 0xC8, 0x03, 0x08, 0x02, 0x00, 0x0E, 0x04, 0x00, 0x04, 0x00, 0x8C,
+    0xC4, 0x0F, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x07, 0x00, 0x87,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x8A, 0x04, 0x00, 0x04, 0x00, 0x3C,
+    0x1F, 0x04, 0x00, 0x04, 0x00, 0x04, 0x02, 0x00, 0x80, 0x7F, 0x0A, 0x00, 0x09, 0x00, 0x90, 0x01,
+    0x00, 0x61, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x00, 0x10, 0x7C,
+    0x03, 0x00, 0x80, 0x1E, 0x02, 0x00, 0x08, 0x00, 0x8F, 0xE0, 0x01, 0x00, 0x04, 0x00, 0x04, 0xE0,
+    0x05, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x03, 0x00, 0x82, 0x10, 0xF8, 0x07, 0x02,
+    0x00, 0x08, 0x00, 0x97, 0xFC, 0x0F, 0xFC, 0x7F, 0xFC, 0x3F, 0x14, 0x08, 0x14, 0x08, 0x14, 0x00,
+    0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x09, 0x00, 0x94, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x30, 0x08, 0x30, 0x08, 0x30, 0x07,
+    0x20, 0x00, 0xF0, 0x01, 0x02, 0x00, 0x04, 0x00, 0x97, 0x80, 0x00, 0x80, 0x00, 0x80, 0x10, 0xC0,
+    0x10, 0x40, 0x30, 0x40, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x20, 0x04, 0x00, 0x0A, 0x00, 0x81, 0xC0, 0x01, 0x0C, 0x00, 0x87, 0xF8, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0x09, 0x00, 0x82, 0x3C, 0x00, 0x70, 0x0C, 0x00, 0x84, 0x04, 0x00, 0x04, 0x00,
+    0x1C, 0x03, 0x00, 0x06, 0x00, 0x82, 0x80, 0x7F, 0x3C, 0x09, 0x00, 0x82, 0xF8, 0x00, 0xFC, 0x06,
+    0x00, 0x82, 0x7C, 0xFE, 0x7F, 0x02, 0x00, 0x04, 0x00, 0x98, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x08, 0x3E, 0x08, 0x22, 0x08, 0x30, 0x08, 0x30, 0x08, 0x30, 0x08, 0x30, 0x08,
+    0x20, 0x08, 0x20, 0x03, 0x00, 0x03, 0x00, 0x95, 0x04, 0x00, 0x04, 0x00, 0x04, 0x40, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0xE0, 0x7F, 0x06, 0x04, 0x00, 0x04, 0xFE, 0x02, 0x00,
+    0x80, 0x06, 0x04, 0x00, 0x04, 0x00, 0x81, 0xF8, 0x1F, 0x02, 0x00, 0x81, 0xF8, 0x01, 0x02, 0x00,
+    0x93, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x40, 0xF2, 0x5F, 0x02, 0x40, 0x02, 0x40, 0x00,
+    0x48, 0x00, 0x40, 0x00, 0x40, 0x04, 0x00, 0x80, 0xF0, 0x04, 0x00, 0x80, 0x38, 0x04, 0x00, 0x80,
+    0x06, 0x0A, 0x00, 0x80, 0x10, 0x06, 0x00, 0x0C, 0x00, 0x93, 0x80, 0x00, 0x80, 0x40, 0x80, 0x40,
+    0x80, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x80, 0x08, 0x00, 0x08, 0x80, 0x08, 0x80, 0x00, 0x11, 0x00,
+    0x8E, 0x20, 0x00, 0x20, 0x00, 0x20, 0x80, 0x28, 0x80, 0x28, 0x80, 0x28, 0xFE, 0x0F, 0x80, 0x08,
+    0x02, 0x00, 0x96, 0x04, 0x00, 0x44, 0x00, 0x44, 0x20, 0x44, 0x20, 0x44, 0x20, 0xC4, 0x27, 0x44,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x1F, 0x3E, 0x03, 0x00, 0x80, 0xC0, 0x03, 0x00,
+    0x04, 0x00, 0x99, 0x10, 0x00, 0x70, 0x04, 0xF0, 0x7F, 0xD0, 0x3F, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x1E, 0x02, 0x00, 0x03,
+    0x00, 0x98, 0x02, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x02, 0xFE, 0x03, 0x00, 0x42, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x04, 0x00, 0x03, 0x00, 0x9C,
+    0x04, 0xFE, 0x5F, 0x82, 0x45, 0x02, 0x44, 0x02, 0x44, 0x00, 0x44, 0x80, 0x47, 0x00, 0x44, 0x00,
+    0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x04, 0x05, 0x00, 0x8E,
+    0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x0C, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x03,
+    0x00, 0x86, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x3C, 0x02, 0x00, 0x02, 0x00, 0x9B, 0x10, 0x02,
+    0x10, 0x02, 0xF8, 0x03, 0x10, 0x03, 0x10, 0x03, 0x10, 0x03, 0x10, 0x03, 0x10, 0x03, 0x00, 0x03,
+    0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x02, 0x00, 0x05, 0x00, 0x80, 0x30,
+    0x07, 0x00, 0x80, 0x20, 0x03, 0x00, 0x8E, 0x02, 0x10, 0x02, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
+    0xF0, 0x0F, 0x10, 0x00, 0x10, 0x00, 0x06, 0x00, 0x81, 0xFC, 0x03, 0x02, 0x00, 0x81, 0xF0, 0x1F,
+    0x02, 0x00, 0x80, 0x70, 0x09, 0x00, 0x81, 0xFC, 0x07, 0x02, 0x00, 0x81, 0xE0, 0x3F, 0x02, 0x00,
+    0x0E, 0x00, 0x80, 0x3E, 0x05, 0x00, 0x8B, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x07, 0x00, 0x80, 0x07, 0x04, 0x00, 0x90, 0x80, 0x3F, 0x10, 0x00, 0x10, 0x00,
+    0x10, 0x08, 0x90, 0x08, 0x90, 0x08, 0x90, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x0A, 0x00, 0x81,
+    0xE0, 0x7F, 0x04, 0x00, 0x81, 0xE0, 0x7F, 0x06, 0x00, 0x80, 0x7C, 0x07, 0x00, 0x06, 0x00, 0x99,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x08, 0x12, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08,
+    0x02, 0x08, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x09, 0x00, 0x93, 0x01, 0x40, 0x01,
+    0x42, 0x01, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x60, 0x08, 0xE0, 0x7F, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x03, 0x00, 0x03, 0x00, 0x9A, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0xF8,
+    0x07, 0x80, 0x06, 0x80, 0x06, 0x80, 0x06, 0x80, 0x06, 0x88, 0x06, 0x88, 0x04, 0xE8, 0x07, 0x00,
+    0x04, 0x02, 0x00, 0x04, 0x00, 0x81, 0xF8, 0x1F, 0x09, 0x00, 0x90, 0x02, 0x00, 0x02, 0x00, 0x02,
+    0x08, 0x02, 0x08, 0x02, 0x00, 0x0F, 0x00, 0x02, 0xFE, 0x3F, 0x00, 0x02, 0x03, 0x00, 0x80, 0x04,
+    0x02, 0x00, 0x81, 0xF0, 0x07, 0x02, 0x00, 0x81, 0x3E, 0x08, 0x0C, 0x00, 0x80, 0x30, 0x07, 0x00,
+    0x02, 0x00, 0x99, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x28, 0xC8, 0x3F, 0xF8,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x00, 0x21, 0x00, 0x21, 0x00, 0x01, 0x04, 0x00, 0x05,
+    0x00, 0x96, 0x40, 0x00, 0x40, 0xC0, 0x47, 0x00, 0x40, 0x00, 0x40, 0xFC, 0x4F, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x4C, 0x00, 0x44, 0x00, 0x44, 0x00, 0x04, 0x04, 0x00, 0x03, 0x00, 0x99, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0x02, 0x20, 0x42, 0x20, 0xFA, 0x20, 0x42, 0x20, 0xFE, 0x21, 0x42, 0x20, 0x42,
+    0x07, 0x42, 0x00, 0x42, 0x00, 0x02, 0x00, 0x02, 0x03, 0x00, 0x04, 0x00, 0x96, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x08, 0x80, 0x08, 0xA0, 0x08, 0xA0, 0x08, 0xA0, 0x08, 0xA0, 0x08, 0xA0,
+    0x08, 0xA0, 0x08, 0xA0, 0x05, 0x00, 0x0F, 0x00, 0x80, 0x3C, 0x02, 0x00, 0x81, 0xFC, 0x03, 0x08,
+    0x00, 0x80, 0x7E, 0x03, 0x00, 0x0C, 0x00, 0x82, 0xFE, 0x01, 0x08, 0x08, 0x00, 0x86, 0x01, 0x00,
+    0x01, 0xE0, 0x1F, 0xF8, 0x0F, 0x02, 0x00, 0x0B, 0x00, 0x80, 0x04, 0x02, 0x00, 0x84, 0xF0, 0x07,
+    0x40, 0x00, 0x40, 0x0D, 0x00, 0x04, 0x00, 0x83, 0xFC, 0x3F, 0xE0, 0x01, 0x03, 0x00, 0x92, 0x40,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x02, 0x40, 0x00, 0x40,
+    0x00, 0x40, 0x02, 0x00, 0x05, 0x00, 0x90, 0x40, 0x00, 0x40, 0x00, 0x40, 0xF8, 0x7F, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x40, 0xFE, 0x43, 0xE0, 0x4F, 0x0A, 0x00, 0x02, 0x00, 0x94, 0x10, 0x00, 0x12,
+    0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x03, 0x00, 0x83, 0xE0, 0x07, 0xFC, 0x03, 0x02, 0x00, 0x07, 0x00, 0x96, 0x7F, 0x04,
+    0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0xF4, 0x7F, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x02, 0x00, 0x0D, 0x00, 0x8A, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0xFE, 0x3F, 0x04, 0x00, 0x81, 0x80, 0x03, 0x02, 0x00, 0x04, 0x00, 0x90, 0x20,
+    0x00, 0xF8, 0x7F, 0x28, 0x00, 0x3E, 0x08, 0x28, 0x00, 0x28, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20,
+    0x0B, 0x00, 0x05, 0x00, 0x98, 0x40, 0xF8, 0x47, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0xFC, 0x43,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0xC0, 0x5F, 0x00, 0x40, 0x02, 0x00,
+    0x03, 0x00, 0x98, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0xFE, 0x01, 0x00, 0x01, 0x00, 0x1F, 0x80, 0x01, 0x04, 0x00, 0x0A, 0x00,
+    0x81, 0xF8, 0x3F, 0x07, 0x00, 0x80, 0x70, 0x05, 0x00, 0x80, 0x0E, 0x06, 0x00, 0x05, 0x00, 0x80,
+    0x10, 0x07, 0x00, 0x90, 0x02, 0x00, 0x02, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x02, 0x00, 0x05, 0x00, 0x9A, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x0E, 0x05, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x08, 0x00, 0x95, 0xF0, 0x0F, 0x00, 0x04, 0x00, 0x04, 0x00, 0x3E,
+    0x00, 0x0C, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x3C, 0x00, 0x08, 0x80, 0x0B, 0x02, 0x00,
+    0x06, 0x00, 0x8E, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0xE0, 0x1F, 0x20, 0x00, 0xA0, 0x7F, 0x20,
+    0x00, 0x20, 0x04, 0x00, 0x84, 0x02, 0xFC, 0x0F, 0x00, 0x7E, 0x02, 0x00, 0x06, 0x00, 0x99, 0x20,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x82, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x90, 0x00, 0x98, 0x00, 0x80, 0x00, 0x02, 0x00, 0x9D, 0x80, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x90, 0x00, 0x80, 0x01, 0xA0, 0x01, 0xBC, 0x01, 0xF0, 0x1F,
+    0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x00, 0x20, 0x00, 0x03, 0x00, 0x9A, 0x01, 0xC0, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x0F, 0x80, 0x01, 0xBE, 0x01, 0x80, 0x01,
+    0x80, 0x61, 0x3C, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x18, 0x00, 0x81, 0xC0, 0x3F, 0x02,
+    0x00, 0x81, 0xF8, 0x7F, 0x02, 0x00, 0x02, 0x00, 0x98, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
+    0x00, 0x0A, 0x00, 0x02, 0x00, 0x82, 0x00, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 0x82, 0x00, 0x82,
+    0x00, 0x80, 0x05, 0x00, 0x06, 0x00, 0x95, 0x08, 0x10, 0x08, 0x10, 0xE8, 0x17, 0x08, 0x12, 0x08,
+    0x52, 0x78, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x02, 0x00, 0x02, 0x00, 0x02, 0x04, 0x00, 0x02,
+    0x00, 0x91, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x05, 0x10, 0x83, 0x00, 0x10, 0x00, 0x10, 0x03, 0x00, 0x07, 0x00, 0x98,
+    0x01, 0x00, 0x01, 0xFE, 0x01, 0x00, 0x11, 0x00, 0x11, 0x04, 0x11, 0x04, 0x01, 0x06, 0x05, 0x06,
+    0x05, 0x0E, 0x05, 0x0A, 0x05, 0x02, 0x04, 0x02, 0x00, 0x05, 0x00, 0x86, 0x10, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x10, 0x0D, 0x00, 0x86, 0x10, 0x00, 0x10, 0xFC, 0x10, 0x00, 0x10, 0x08, 0x00, 0x97,
+    0xFC, 0x07, 0x80, 0x03, 0x00, 0x12, 0x00, 0x02, 0x38, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x0A, 0x03, 0x00, 0x98, 0x0C, 0x00, 0x0C, 0x00, 0x3C,
+    0x00, 0x0C, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x80, 0x0F, 0x00, 0x08, 0xFC, 0x0B,
+    0xE0, 0x3F, 0x00, 0x08, 0x04, 0x00, 0x03, 0x00, 0x9A, 0x01, 0x00, 0x01, 0x38, 0x11, 0x00, 0x11,
+    0x00, 0x11, 0x00, 0x11, 0x60, 0x11, 0x00, 0x13, 0x00, 0x13, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0xC0, 0x01, 0x02, 0x00, 0x04, 0x00, 0x9B, 0x20, 0x10, 0x20, 0x12, 0x20, 0x12, 0x20,
+    0x12, 0x20, 0x12, 0x20, 0x10, 0x20, 0x10, 0x20, 0x38, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0xE0, 0x03, 0x20, 0x00, 0x03, 0x00, 0x84, 0x01, 0x00, 0x01, 0x00, 0x01, 0x04, 0x00, 0x90,
+    0x12, 0x00, 0x14, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x3F, 0x04, 0x08, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x03, 0x00, 0x05, 0x00, 0x98, 0x02, 0x00, 0x02, 0x00, 0x02, 0x04, 0x0A, 0x04, 0x02, 0x04,
+    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x02,
+    0x00, 0x06, 0x00, 0x8D, 0x08, 0x00, 0x08, 0x00, 0x48, 0x00, 0x48, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x02, 0x08, 0x81, 0x88, 0x0F, 0x06, 0x08, 0x02, 0x00, 0x06, 0x00, 0x80, 0x06, 0x02,
+    0x00, 0x82, 0x08, 0x00, 0x08, 0x0D, 0x00, 0x84, 0x7E, 0xFE, 0x1F, 0xE0, 0x7F, 0x02, 0x00, 0x05,
+    0x00, 0x88, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x02, 0x00, 0x81, 0xC0, 0x01,
+    0x04, 0x00, 0x80, 0x30, 0x09, 0x00, 0x03, 0x00, 0x9A, 0x0A, 0x00, 0x7A, 0x00, 0x0A, 0x00, 0x0A,
+    0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0xF8, 0x42,
+    0x00, 0x42, 0x00, 0x40, 0x02, 0x00, 0x05, 0x00, 0x85, 0x40, 0x00, 0x40, 0x00, 0x04, 0x00, 0x10,
+    0x04, 0x81, 0x07, 0x34, 0x03, 0x04, 0x07, 0x00, 0x98, 0x06, 0xC0, 0x7F, 0x04, 0x40, 0x04, 0x40,
+    0x04, 0x40, 0x04, 0x40, 0x06, 0x40, 0x06, 0x40, 0x06, 0x40, 0xFE, 0x4F, 0x02, 0x40, 0x02, 0x00,
+    0x02, 0x00, 0x04, 0x00, 0x98, 0x08, 0x00, 0x08, 0x00, 0x48, 0x00, 0x48, 0x00, 0xFE, 0x3F, 0xF8,
+    0x7F, 0x48, 0x00, 0x48, 0x03, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x08, 0x00, 0x08, 0x03, 0x00,
+    0x04, 0x00, 0x81, 0x80, 0x1F, 0x09, 0x00, 0x86, 0x01, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x01, 0x0A,
+    0x00, 0x06, 0x00, 0x93, 0x40, 0x00, 0x40, 0x00, 0x40, 0x04, 0xF0, 0x1F, 0x78, 0x04, 0x60, 0x04,
+    0x40, 0x04, 0x40, 0x04, 0x40, 0x04, 0x00, 0x04, 0x06, 0x00, 0x05, 0x00, 0x80, 0x7F, 0x03, 0x00,
+    0x90, 0x08, 0x00, 0x08, 0x00, 0x08, 0x0E, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x08, 0x06, 0x00, 0x08, 0x00, 0x91, 0xFE, 0x01, 0xF0, 0x03, 0xC0, 0x2F, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x06, 0x00, 0x02, 0x00, 0x98, 0x40, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xFE, 0x21,
+    0x60, 0x21, 0xA0, 0x01, 0xA0, 0x00, 0x1C, 0x05, 0x00, 0x05, 0x00, 0x9A, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0x80, 0x20, 0x00, 0x20, 0x04, 0x00, 0x99, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x7E, 0x04, 0x00, 0xC6, 0x7F, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x02, 0x00, 0xC0, 0x3F, 0x02, 0x00, 0x05, 0x00, 0x98, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x3F, 0x00, 0x21,
+    0x00, 0x3F, 0x02, 0x00, 0x02, 0x00, 0x9B, 0x02, 0x00, 0x02, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42,
+    0x00, 0xE2, 0x7F, 0xE2, 0x07, 0x42, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0xF0,
+    0x7F, 0x00, 0x01, 0x02, 0x00, 0x02, 0x00, 0x82, 0x40, 0x00, 0x40, 0x04, 0x00, 0x96, 0x3F, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x02, 0x20, 0x02, 0x00, 0x0B, 0x00, 0x94, 0x02, 0x00, 0x02, 0x08, 0x02, 0x08, 0x06, 0x08,
+    0x06, 0x08, 0x04, 0x1C, 0x04, 0xF0, 0x0F, 0x00, 0x04, 0x00, 0x04, 0x02, 0x04, 0x0A, 0x00, 0x95,
+    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xC0, 0x07, 0x82, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x9C, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05,
+    0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0xE0, 0x0F,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x14, 0x00, 0x85, 0x02, 0x00, 0x02, 0x00, 0xF8, 0x07, 0x02,
+    0x00, 0x81, 0xE0, 0x01, 0x02, 0x00, 0x03, 0x00, 0x97, 0x01, 0x80, 0x01, 0x80, 0x09, 0x80, 0x09,
+    0x80, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x08, 0x10, 0x08, 0x10, 0x08,
+    0x10, 0x05, 0x00, 0x03, 0x00, 0x9C, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0x43, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x01, 0x00, 0x01, 0x7C, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x03, 0x00, 0x8A, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x06, 0xE0, 0x05, 0xFC,
+    0x05, 0x08, 0x04, 0x89, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x00, 0x04, 0x06, 0x00,
+    0x81, 0xF8, 0x7F, 0x02, 0x00, 0x81, 0xF0, 0x3F, 0x04, 0x00, 0x80, 0x70, 0x05, 0x00, 0x82, 0x08,
+    0x00, 0xFE, 0x07, 0x00, 0x04, 0x00, 0x80, 0xFC, 0x08, 0x00, 0x80, 0x1C, 0x09, 0x00, 0x80, 0x18,
+    0x08, 0x00, 0x0E, 0x00, 0x81, 0xFE, 0x0F, 0x03, 0x00, 0x8A, 0x44, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0xFE, 0x3F, 0x02, 0x00, 0x08, 0x00, 0x80, 0xE0, 0x08, 0x00, 0x82, 0x01, 0x00,
+    0x01, 0x04, 0x00, 0x81, 0xF0, 0x01, 0x06, 0x00, 0x05, 0x00, 0x88, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x80, 0x7F, 0x00, 0x7E, 0x06, 0x00, 0x81, 0xC0, 0x7F, 0x03, 0x00, 0x80, 0x30, 0x06, 0x00, 0x14,
+    0x00, 0x81, 0xEC, 0x3F, 0x04, 0x00, 0x81, 0xC0, 0x3F, 0x04, 0x00, 0x04, 0x00, 0x97, 0x40, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0xC0, 0x00, 0xC2, 0x00, 0xFE, 0x07, 0x42, 0x00, 0x40, 0x01, 0x40, 0x01,
+    0x40, 0x01, 0x40, 0x01, 0x00, 0x01, 0x04, 0x00, 0x04, 0x00, 0x83, 0x20, 0x00, 0xF0, 0x07, 0x14,
+    0x00, 0x81, 0xFC, 0x03, 0x02, 0x00, 0x05, 0x00, 0x80, 0x78, 0x0A, 0x00, 0x80, 0x20, 0x02, 0x00,
+    0x8C, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x04, 0x60, 0x04, 0x00, 0x04, 0x00, 0x04, 0x0D, 0x00,
+    0x80, 0x3C, 0x03, 0x00, 0x85, 0x0F, 0x04, 0x00, 0x04, 0x00, 0x04, 0x03, 0x00, 0x81, 0xF8, 0x07,
+    0x04, 0x00, 0x05, 0x00, 0x98, 0x40, 0x00, 0x40, 0x00, 0x40, 0xFE, 0x7F, 0x00, 0x60, 0x00, 0x62,
+    0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x42, 0x00, 0x42, 0xE0, 0x1F, 0x02, 0x00,
+    0x08, 0x00, 0x81, 0xC0, 0x7F, 0x03, 0x00, 0x92, 0x08, 0x00, 0x08, 0x04, 0x20, 0x06, 0x20, 0x06,
+    0x20, 0x06, 0x20, 0x06, 0x24, 0x04, 0x24, 0x80, 0x21, 0x00, 0x20, 0x0E, 0x00, 0x81, 0xF8, 0x03,
+    0x04, 0x00, 0x84, 0x1E, 0x00, 0x08, 0x00, 0x08, 0x07, 0x00, 0x07, 0x00, 0x80, 0x7F, 0x06, 0x00,
+    0x91, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0xFE, 0x3F, 0x10, 0x00, 0x78, 0x00, 0x50, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x04, 0x00, 0x80, 0x04, 0x03, 0x00, 0x81, 0x80, 0x7F, 0x04, 0x00, 0x80, 0x02,
+    0x09, 0x00, 0x81, 0xF8, 0x7F, 0x06, 0x00, 0x04, 0x00, 0x9B, 0xF0, 0x3F, 0x10, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x02, 0x18, 0x02, 0x18, 0x02, 0x18, 0x02, 0xF8, 0x1F,
+    0x10, 0x02, 0x10, 0x02, 0x10, 0x00, 0x02, 0x00, 0x8B, 0x04, 0x01, 0x24, 0x01, 0x24, 0x01, 0x20,
+    0x01, 0x20, 0x01, 0x20, 0x00, 0x04, 0x20, 0x8D, 0x70, 0x30, 0x20, 0x30, 0x20, 0x10, 0x20, 0x10,
+    0x20, 0x10, 0x20, 0x1C, 0x20, 0x00, 0x0A, 0x00, 0x95, 0x08, 0x00, 0x08, 0x40, 0x08, 0x40, 0x08,
+    0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x48, 0x40, 0x48, 0x00, 0x68, 0x00, 0x40, 0x00, 0x07,
+    0x00, 0x80, 0x20, 0x02, 0x00, 0x81, 0x80, 0x1F, 0x02, 0x00, 0x84, 0x10, 0x00, 0x10, 0x00, 0x10,
+    0x03, 0x00, 0x83, 0xFE, 0x7F, 0x00, 0x04, 0x03, 0x00, 0x80, 0x0C, 0x02, 0x00, 0x04, 0x00, 0x9B,
+    0x02, 0x40, 0x02, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0xF0, 0x4F, 0x04, 0x40,
+    0x04, 0x40, 0x04, 0x40, 0x04, 0x40, 0xF4, 0x47, 0x04, 0x40, 0x04, 0x40, 0x03, 0x00, 0x9C, 0x04,
+    0x00, 0x04, 0x00, 0x04, 0x02, 0x44, 0x02, 0x44, 0x02, 0x04, 0x82, 0x00, 0x82, 0x00, 0x82, 0x40,
+    0xC0, 0x7F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x02, 0x00, 0x96, 0x08,
+    0x00, 0xC8, 0x00, 0x08, 0x20, 0x08, 0x28, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x2A, 0x08,
+    0x2A, 0x88, 0x08, 0x88, 0x08, 0x88, 0x02, 0x08, 0x84, 0x00, 0x08, 0x00, 0x08, 0x00, 0x02, 0x00,
+    0x9A, 0x40, 0x00, 0x40, 0x00, 0x40, 0x02, 0x00, 0x06, 0x00, 0x06, 0x80, 0x06, 0x80, 0x06, 0x80,
+    0x06, 0xA0, 0x06, 0xA0, 0x06, 0xA0, 0x04, 0x80, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00,
+    0x8E, 0x10, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11,
+    0x0E, 0x00, 0x02, 0x00, 0x8C, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0xF0, 0x0F, 0x48, 0x00, 0x48,
+    0x00, 0x48, 0x03, 0x08, 0x8D, 0x18, 0x08, 0x18, 0x08, 0xFC, 0x1F, 0x18, 0x08, 0x18, 0x00, 0x18,
+    0x00, 0x08, 0x00, 0x08, 0x00, 0x93, 0xFC, 0x03, 0x10, 0x00, 0x10, 0x00, 0xF0, 0x01, 0x56, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x20, 0x00, 0x20, 0x00, 0xE0, 0x01, 0x04, 0x00, 0x06, 0x00, 0x81, 0xC0,
+    0x1F, 0x05, 0x00, 0x8A, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x19, 0x00, 0x19, 0xF8, 0x0F, 0x02,
+    0x00, 0x83, 0xC0, 0x00, 0xFE, 0x0F, 0x02, 0x00, 0x0B, 0x00, 0x90, 0x20, 0x38, 0x20, 0x00, 0x20,
+    0x7C, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0xF0, 0x21, 0x00, 0x20, 0x04, 0x00, 0x04, 0x00,
+    0x98, 0x60, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x0A, 0x20, 0x0A, 0x20, 0x08,
+    0x20, 0xFE, 0x1F, 0x08, 0x02, 0x08, 0x02, 0x08, 0x00, 0x08, 0x03, 0x00, 0x04, 0x00, 0x81, 0x80,
+    0x1F, 0x03, 0x00, 0x90, 0x10, 0x00, 0x10, 0xF8, 0x16, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
+    0x7C, 0x00, 0x10, 0x00, 0x10, 0x06, 0x00, 0x02, 0x00, 0x9D, 0x08, 0x00, 0xFE, 0x03, 0x0A, 0x00,
+    0x0A, 0x00, 0x0A, 0x30, 0x0A, 0x00, 0x0E, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
+    0x0A, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x08, 0x00, 0x05, 0x00, 0x82, 0x20, 0x00, 0x20, 0x02, 0x00,
+    0x81, 0xFE, 0x0F, 0x04, 0x00, 0x81, 0x80, 0x01, 0x0E, 0x00, 0x04, 0x00, 0x9B, 0x44, 0x00, 0x44,
+    0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x40, 0x04, 0x40, 0x04, 0xFE, 0x1F, 0x48,
+    0x04, 0xC0, 0x3F, 0x40, 0x04, 0x40, 0x04, 0x00, 0x04, 0x02, 0x00, 0x9D, 0x10, 0x00, 0xD0, 0x0F,
+    0x10, 0x78, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x18, 0x00, 0x18, 0x00, 0x10, 0x00, 0x0B, 0x00, 0x8E, 0x10, 0x00, 0x1E,
+    0x00, 0x04, 0xF8, 0x07, 0x00, 0x04, 0x00, 0x04, 0xF8, 0x1F, 0x00, 0x0E, 0x06, 0x00, 0x05, 0x00,
+    0x98, 0x08, 0x00, 0x08, 0x04, 0x7E, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0xFC, 0x0F,
+    0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x00, 0x07, 0x02, 0x00, 0x02, 0x00, 0x9A, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+    0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0xF0, 0x03, 0x00, 0x04, 0x00, 0x91, 0xFE,
+    0x1F, 0x00, 0x3C, 0x00, 0x3A, 0x00, 0x02, 0x00, 0x1E, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x02, 0x00, 0x80, 0x60, 0x07, 0x00, 0x06, 0x00, 0x81, 0xE0, 0x7F, 0x08, 0x00, 0x83, 0xE0,
+    0x7F, 0xF0, 0x07, 0x02, 0x00, 0x81, 0x80, 0x07, 0x08, 0x00, 0x07, 0x00, 0x94, 0x0A, 0x00, 0x0A,
+    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x7A,
+    0x00, 0x02, 0x04, 0x00, 0x07, 0x00, 0x8F, 0x02, 0x80, 0x0F, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0A,
+    0x00, 0x0A, 0x18, 0x0A, 0x00, 0x0A, 0x0C, 0x03, 0x00, 0x85, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x0C, 0x00, 0x80, 0xF0, 0x06, 0x00, 0x8C, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20,
+    0xFC, 0x39, 0x80, 0x20, 0x0A, 0x00, 0x82, 0x08, 0x00, 0x08, 0x06, 0x00, 0x8A, 0x20, 0x08, 0x20,
+    0x08, 0x20, 0x00, 0x20, 0x38, 0x24, 0x00, 0x24, 0x02, 0x00, 0x08, 0x00, 0x81, 0xF8, 0x3F, 0x07,
+    0x00, 0x80, 0x1F, 0x03, 0x00, 0x80, 0x1C, 0x02, 0x00, 0x80, 0x38, 0x03, 0x00, 0x83, 0x02, 0x00,
+    0x02, 0x00, 0x04, 0x00, 0x9B, 0xFC, 0x1F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88,
+    0x00, 0x88, 0x1F, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x60, 0x80,
+    0x02, 0x02, 0x00, 0x9D, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x38, 0x04, 0x10, 0x04, 0x10,
+    0x06, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0xF4, 0x1F, 0x38, 0x10,
+    0x00, 0x10, 0x07, 0x00, 0x82, 0x0E, 0xFE, 0x0F, 0x09, 0x00, 0x82, 0x3F, 0x38, 0x3F, 0x0A, 0x00,
+    0x08, 0x00, 0x94, 0x02, 0x00, 0x22, 0x00, 0x22, 0x00, 0x02, 0x1E, 0x02, 0x00, 0x02, 0x10, 0x02,
+    0x10, 0x02, 0x10, 0x02, 0x10, 0x02, 0x00, 0x02, 0x03, 0x00, 0x07, 0x00, 0x91, 0x50, 0xFC, 0x3F,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x7C, 0x07,
+    0x00, 0x04, 0x00, 0x80, 0xFE, 0x03, 0x00, 0x97, 0x10, 0x01, 0x10, 0x11, 0x10, 0x11, 0x10, 0x11,
+    0xF0, 0x1F, 0x90, 0x11, 0x10, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x00,
+    0x09, 0x00, 0x80, 0x1C, 0x02, 0x00, 0x81, 0xFC, 0x01, 0x0F, 0x00, 0x80, 0x1F, 0x02, 0x00, 0x0A,
+    0x00, 0x91, 0x04, 0x00, 0xFE, 0x07, 0x04, 0x00, 0x04, 0x08, 0x04, 0x00, 0x06, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x80, 0x1F, 0x04, 0x00, 0x06, 0x00, 0x81, 0xE0, 0x03, 0x02, 0x00, 0x83, 0x0C, 0x00,
+    0xF0, 0x01, 0x02, 0x00, 0x8D, 0x02, 0x00, 0x02, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x02, 0x00, 0x07, 0x00, 0x8D, 0x40, 0xF0, 0x03, 0x20, 0x02, 0xF0, 0x02, 0xFC,
+    0x3F, 0x20, 0x00, 0x20, 0x00, 0x20, 0x0B, 0x00, 0x05, 0x00, 0x96, 0x08, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x08, 0xE0, 0x1F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x10, 0x08, 0x38, 0x08,
+    0x10, 0x08, 0x04, 0x00, 0x06, 0x00, 0x94, 0x80, 0x00, 0x80, 0x00, 0x80, 0x20, 0x90, 0x7F, 0x90,
+    0x20, 0x9A, 0x00, 0x9A, 0x00, 0x1A, 0x00, 0xDA, 0x1F, 0x1A, 0x00, 0x0A, 0x05, 0x00, 0x07, 0x00,
+    0x94, 0x0F, 0x10, 0x00, 0xFE, 0x3F, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x04, 0x00, 0x06, 0x00, 0x83, 0xF8, 0x1F, 0xFE, 0x1F, 0x05,
+    0x00, 0x8B, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x08, 0x01, 0x08, 0x1F, 0x08, 0x05, 0x00,
+    0x06, 0x00, 0x8D, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xE0,
+    0x1F, 0x0C, 0x00, 0x02, 0x00, 0x9B, 0x08, 0x10, 0x08, 0x10, 0x08, 0x7F, 0x08, 0x10, 0x08, 0x10,
+    0x08, 0x10, 0xF8, 0x17, 0x08, 0x10, 0x08, 0x10, 0x48, 0x10, 0x48, 0x10, 0x48, 0x10, 0x40, 0x10,
+    0x40, 0x10, 0x02, 0x00, 0x04, 0x00, 0x99, 0x04, 0x00, 0x7C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x7C, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0xFE,
+    0x0F, 0x02, 0x00, 0x02, 0x00, 0x9D, 0x04, 0x00, 0x04, 0x00, 0x04, 0x20, 0x44, 0x20, 0x44, 0x00,
+    0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0xFE, 0x01, 0xE0, 0x03, 0x40, 0x10, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x06, 0x00, 0x80, 0x0C, 0x07, 0x00, 0x81, 0xFE, 0x03, 0x08, 0x00, 0x81,
+    0xFE, 0x7F, 0x06, 0x00, 0x09, 0x00, 0x8F, 0x01, 0x08, 0x03, 0x08, 0x01, 0x08, 0x79, 0x08, 0x01,
+    0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x04, 0x00, 0x82, 0x08, 0x00, 0x08, 0x03, 0x00, 0x98,
+    0x08, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x08, 0x00, 0x08, 0xFE, 0x09, 0x00, 0x08, 0x00, 0x08, 0xF0,
+    0x0F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0xF8, 0x0F, 0x04, 0x00, 0x02, 0x00, 0x9A, 0x80, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xF0, 0x1F,
+    0xFE, 0x07, 0xC0, 0x00, 0x40, 0x00, 0x42, 0x00, 0x42, 0x03, 0x00, 0x07, 0x00, 0x8C, 0x40, 0x00,
+    0x40, 0x7C, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x48, 0x0C, 0x00, 0x08, 0x00, 0x91,
+    0xFE, 0x7F, 0x40, 0x00, 0x40, 0x00, 0xE0, 0x3F, 0x40, 0x20, 0x40, 0x20, 0x40, 0x20, 0x40, 0x00,
+    0x80, 0x03, 0x06, 0x00, 0x04, 0x00, 0x8C, 0x20, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28,
+    0x00, 0xA8, 0x7F, 0x28, 0x05, 0x20, 0x81, 0xA0, 0x3F, 0x04, 0x20, 0x83, 0x00, 0x20, 0x00, 0x20,
+    0x04, 0x00, 0x97, 0xF0, 0x1F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x7F, 0xFE,
+    0x0B, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x04, 0x00, 0x08, 0x00, 0x8B,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFA, 0x3F, 0x0C, 0x00, 0x03, 0x00,
+    0x9C, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x42, 0x00, 0x5E, 0x00, 0x42, 0x00, 0x02, 0x00, 0x02,
+    0x00, 0x02, 0x80, 0x1F, 0x80, 0x02, 0x80, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x02, 0x00,
+    0x98, 0x04, 0x00, 0x74, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x01, 0x84, 0x1F, 0x04, 0x01, 0x04,
+    0x01, 0x04, 0x01, 0x04, 0x00, 0xF4, 0x0F, 0x04, 0x10, 0x04, 0x05, 0x00, 0x0A, 0x00, 0x82, 0x20,
+    0x00, 0x20, 0x07, 0x00, 0x81, 0xF0, 0x01, 0x02, 0x00, 0x81, 0xC0, 0x07, 0x06, 0x00, 0x07, 0x00,
+    0x98, 0x10, 0x40, 0x10, 0xFC, 0x3F, 0x40, 0x08, 0x40, 0x08, 0xE0, 0x08, 0xE8, 0x08, 0xE8, 0x08,
+    0xC0, 0x08, 0xC0, 0x08, 0xC0, 0x08, 0xC0, 0x08, 0x80, 0x00, 0x04, 0x00, 0x91, 0x80, 0x00, 0x80,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x0A,
+    0x00, 0x04, 0x00, 0x99, 0x40, 0x00, 0x40, 0x00, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x09,
+    0x44, 0x09, 0xC4, 0x03, 0x44, 0x01, 0x40, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00,
+    0x10, 0x00, 0x8B, 0x02, 0x00, 0x02, 0x01, 0xFE, 0x01, 0xFE, 0x7F, 0x00, 0x01, 0x00, 0x01, 0x04,
+    0x00, 0x03, 0x00, 0x91, 0x02, 0x00, 0x7E, 0x00, 0x02, 0xF0, 0x03, 0x10, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x02, 0x00, 0x88, 0x01, 0xF0, 0x07, 0x00, 0x01, 0x00, 0x07,
+    0x00, 0x01, 0x02, 0x00, 0x9B, 0x02, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x50, 0x00, 0x50, 0x00,
+    0x40, 0x10, 0x48, 0x10, 0x48, 0x10, 0x48, 0x10, 0x48, 0x10, 0x68, 0x10, 0x68, 0x40, 0x60, 0x40,
+    0x20, 0x02, 0x00, 0x03, 0x00, 0x9C, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xFE, 0x47, 0xD0,
+    0x41, 0x90, 0x43, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
+    0x7C, 0x08, 0x00, 0x0C, 0x00, 0x8A, 0x08, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x02, 0x00,
+    0x02, 0x02, 0x00, 0x80, 0x1F, 0x03, 0x00, 0x80, 0x03, 0x02, 0x00, 0x04, 0x00, 0x98, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xC2, 0x3F, 0x02, 0x00, 0x02, 0x00, 0x02, 0x78, 0xFA, 0x01,
+    0x02, 0x00, 0x02, 0x7C, 0x02, 0x00, 0x02, 0x03, 0x00, 0x06, 0x00, 0x81, 0xFE, 0x3F, 0x02, 0x00,
+    0x89, 0x80, 0x0F, 0x02, 0x00, 0x02, 0x00, 0x02, 0x78, 0xE2, 0x3F, 0x0C, 0x00, 0x04, 0x00, 0x82,
+    0x02, 0x00, 0x02, 0x0B, 0x00, 0x89, 0x7C, 0x00, 0x38, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+    0x04, 0x00, 0x06, 0x00, 0x81, 0x80, 0x03, 0x03, 0x00, 0x90, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0xFC, 0x03, 0x04, 0x00, 0x05, 0x00, 0x97,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x70, 0x00, 0x40, 0x00, 0x40, 0x60,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x7C, 0x03, 0x00, 0x03, 0x00, 0x98, 0x01, 0x40, 0x03,
+    0x40, 0x01, 0x40, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x0C, 0x09, 0x00, 0x09, 0x00, 0x09, 0x04, 0x00, 0x02, 0x00, 0x9B, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x86, 0x00, 0x80, 0x00, 0xB0, 0x40, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0xBE,
+    0x08, 0x80, 0x08, 0x80, 0x08, 0x00, 0x08, 0x02, 0x00, 0x07, 0x00, 0x98, 0x06, 0x78, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x04, 0x03, 0x00, 0x92, 0x01, 0x00, 0x01, 0x00, 0x01, 0xFC, 0x3F, 0x20,
+    0x08, 0x20, 0x08, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0xFC, 0x3F, 0x03, 0x20, 0x84, 0x30, 0x20,
+    0x30, 0x00, 0x10, 0x02, 0x00, 0x0E, 0x00, 0x81, 0xFC, 0x07, 0x02, 0x00, 0x85, 0xE0, 0x1F, 0x00,
+    0x20, 0x00, 0x20, 0x08, 0x00, 0x06, 0x00, 0x99, 0x80, 0x00, 0x84, 0x00, 0x84, 0x04, 0xFE, 0x1F,
+    0x84, 0x04, 0xFC, 0x07, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x82, 0x04, 0x80, 0x04, 0x80, 0x04,
+    0x80, 0x04, 0x08, 0x00, 0x8E, 0x02, 0x00, 0xF2, 0x01, 0x02, 0x00, 0x02, 0x10, 0x02, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x02, 0x06, 0x00, 0x80, 0x7E, 0x02, 0x00, 0x03, 0x00, 0x84, 0x40, 0x00, 0x40,
+    0xF0, 0x40, 0x02, 0x00, 0x81, 0xFE, 0x1F, 0x14, 0x00, 0x02, 0x00, 0x9D, 0x10, 0x00, 0x10, 0x00,
+    0x10, 0x07, 0x10, 0x0F, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05,
+    0x00, 0x05, 0x00, 0x05, 0x04, 0x01, 0x04, 0x01, 0x04, 0x00, 0x04, 0x00, 0x87, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x02, 0x10, 0x8F, 0x00, 0x10, 0x00, 0x10, 0x00, 0x18, 0x00, 0x18,
+    0x00, 0x38, 0x00, 0x08, 0x00, 0x08, 0x80, 0x09, 0x02, 0x00, 0x14, 0x00, 0x8B, 0x7E, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0x80, 0x2F, 0x00, 0x20, 0x00, 0x20, 0x0D, 0x00, 0x92, 0x18, 0x00, 0x1C, 0x00,
+    0x0F, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x08, 0xFC, 0x1F, 0xE0, 0x3F, 0x00, 0x08, 0x02,
+    0x00, 0x80, 0x08, 0x02, 0x00, 0x90, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x10, 0x22, 0x10, 0x02, 0x00, 0x02, 0x0A, 0x00, 0x08, 0x00, 0x95, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x01, 0x80, 0x03, 0xF8, 0x3F, 0x00, 0x01,
+    0x00, 0x01, 0x02, 0x00, 0x04, 0x00, 0x8B, 0xE2, 0x0F, 0x02, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x10, 0x00, 0x02, 0x00, 0x8E, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+    0x4C, 0x00, 0x48, 0x00, 0x48, 0x00, 0x08, 0x0F, 0x00, 0x0A, 0x00, 0x84, 0xE0, 0x3F, 0x00, 0x20,
+    0x08, 0x05, 0x20, 0x82, 0xFE, 0x25, 0x20, 0x09, 0x00, 0x0D, 0x00, 0x8E, 0x20, 0x00, 0x20, 0x80,
+    0x3F, 0x00, 0x7E, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x04, 0x00, 0x07, 0x00, 0x83,
+    0x08, 0x00, 0x08, 0x00, 0x04, 0x08, 0x81, 0x00, 0x08, 0x02, 0x00, 0x8A, 0x10, 0x00, 0x10, 0x80,
+    0x3F, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x02, 0x00, 0x0A, 0x00, 0x95, 0x80, 0x7D, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x00, 0xF0, 0x0F, 0x80, 0x00, 0x82, 0x00, 0x82, 0x00, 0xF2, 0x03, 0x02, 0x00,
+    0x02, 0x00, 0x05, 0x00, 0x80, 0x1E, 0x0A, 0x00, 0x80, 0x0C, 0x03, 0x00, 0x83, 0xF8, 0x7F, 0xC0,
+    0x07, 0x07, 0x00, 0x80, 0x20, 0x06, 0x00, 0x99, 0x08, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xC0, 0x02,
+    0x00, 0x02, 0x07, 0x00, 0x96, 0x04, 0xF8, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04,
+    0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x00, 0x04, 0x02, 0x00, 0x06, 0x00,
+    0x92, 0xF0, 0x07, 0xA0, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x20, 0x00, 0x20, 0x07, 0x00, 0x04, 0x00, 0x80, 0x20, 0x0D, 0x00, 0x81, 0xFC, 0x0F, 0x0C,
+    0x00, 0x0B, 0x00, 0x8E, 0x7E, 0x20, 0x00, 0x20, 0x00, 0xFC, 0x00, 0x20, 0x04, 0x20, 0x00, 0x20,
+    0x00, 0xA0, 0x01, 0x06, 0x00, 0x09, 0x00, 0x88, 0x20, 0xFC, 0x23, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x06, 0x00, 0x81, 0xC0, 0x07, 0x06, 0x00, 0x12, 0x00, 0x80, 0x3C, 0x02, 0x00, 0x80, 0x04,
+    0x03, 0x00, 0x83, 0x02, 0x08, 0x02, 0x08, 0x03, 0x00, 0x0C, 0x00, 0x93, 0xFC, 0x07, 0x40, 0x00,
+    0x7C, 0x00, 0x40, 0x00, 0x40, 0x00, 0x4E, 0x7C, 0x42, 0x00, 0x42, 0x10, 0x42, 0x10, 0x42, 0x00,
+    0x04, 0x00, 0x8E, 0x10, 0x00, 0x3E, 0x02, 0x10, 0x02, 0x10, 0x02, 0x10, 0x02, 0xF8, 0x03, 0x10,
+    0x02, 0x10, 0x03, 0x00, 0x86, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x03, 0x00, 0x04, 0x00,
+    0x82, 0x08, 0x00, 0x08, 0x14, 0x00, 0x81, 0x78, 0x3C, 0x03, 0x00, 0x03, 0x00, 0x02, 0x08, 0x90,
+    0x18, 0x08, 0x18, 0x0C, 0x18, 0x0C, 0x78, 0x0C, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04,
+    0x08, 0x04, 0x00, 0x81, 0xFC, 0x03, 0x04, 0x00, 0x07, 0x00, 0x98, 0x08, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x0C, 0x10, 0x0C, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08,
+    0x10, 0x08, 0x10, 0x08, 0x03, 0x00, 0x8A, 0x10, 0xF0, 0x13, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x05, 0x00, 0x84, 0x3F, 0xF8, 0x1F, 0xC0, 0x7F, 0x04, 0x00, 0x80, 0x3E, 0x03, 0x00,
+    0x06, 0x00, 0x05, 0x40, 0x80, 0x46, 0x04, 0x40, 0x8F, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x12, 0x00, 0x8D, 0x14, 0x00, 0x14, 0x06,
+    0x0C, 0x00, 0x8C, 0x1F, 0x0C, 0x10, 0x00, 0x10, 0x00, 0x10, 0x0C, 0x00, 0x81, 0xC0, 0x03, 0x02,
+    0x00, 0x89, 0x60, 0x00, 0x80, 0x00, 0xFC, 0x03, 0x90, 0x00, 0x90, 0x30, 0x06, 0x00, 0x08, 0x00,
+    0x81, 0x80, 0x3F, 0x02, 0x00, 0x8E, 0x40, 0x00, 0x40, 0x00, 0x48, 0x00, 0x48, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x05, 0x00, 0x05, 0x00, 0x95, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+    0x40, 0xFC, 0x4F, 0xF0, 0x47, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x20, 0x00, 0x20,
+    0x05, 0x00, 0x04, 0x00, 0x83, 0xF8, 0x1F, 0x00, 0x07, 0x02, 0x00, 0x84, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x06, 0x00, 0x80, 0x07, 0x0A, 0x00, 0x0E, 0x00, 0x89, 0xC0, 0x1F, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x30, 0x00, 0x20, 0x02, 0x00, 0x80, 0x7E, 0x05, 0x00, 0x06, 0x00, 0x81, 0xF8, 0x0F, 0x08,
+    0x00, 0x82, 0x10, 0x70, 0x10, 0x0D, 0x00, 0x05, 0x00, 0x9A, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0xF8, 0x0F, 0x00, 0x02, 0x00, 0x02, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x04, 0x00, 0x90, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x08,
+    0x42, 0x28, 0xF0, 0x2F, 0x00, 0x28, 0x20, 0x27, 0x20, 0x0B, 0x00, 0x05, 0x00, 0x9A, 0x26, 0x00,
+    0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x30, 0x28, 0x00,
+    0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x04, 0x00, 0x81, 0xF0, 0x3F, 0x02, 0x00,
+    0x97, 0x10, 0x00, 0x78, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58,
+    0x00, 0x50, 0x20, 0x50, 0x20, 0x50, 0x00, 0x10, 0x00, 0x05, 0x00, 0x96, 0x28, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0xFE, 0x21, 0x00, 0x20, 0xF0, 0x3F, 0x00, 0x20, 0x00, 0x20, 0xC0,
+    0x2F, 0x00, 0x20, 0x04, 0x00, 0x08, 0x00, 0x91, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x38, 0x00, 0x20, 0x1F, 0x20, 0x00, 0xF8, 0x7F, 0x06, 0x00, 0x03, 0x00, 0x9C, 0x20,
+    0x00, 0x20, 0x80, 0x27, 0x00, 0x24, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0xFC, 0x7F,
+    0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x00, 0x0B, 0x00, 0x94, 0x04,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0xFC, 0x0F,
+    0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x97, 0x08, 0x00, 0xFE, 0x01, 0x90, 0x00, 0x90, 0x00, 0x90,
+    0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0xD0, 0x03, 0x04,
+    0x00, 0x05, 0x00, 0x96, 0x08, 0x02, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x04, 0x00, 0x06, 0x00, 0x8A,
+    0xE0, 0x7F, 0x1E, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x18, 0x04, 0x02, 0x00, 0x80, 0x7E, 0x0C,
+    0x00, 0x04, 0x00, 0x81, 0xF8, 0x03, 0x03, 0x00, 0x94, 0x78, 0x00, 0x20, 0x00, 0x20, 0x70, 0x20,
+    0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x20, 0x00, 0x20, 0xF8, 0x03, 0x80, 0x01, 0x02, 0x00,
+    0x0A, 0x00, 0x91, 0x02, 0x00, 0x02, 0x00, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x12, 0x08, 0x12,
+    0x08, 0x12, 0x08, 0x12, 0x08, 0x04, 0x00, 0x06, 0x00, 0x81, 0xF0, 0x07, 0x03, 0x00, 0x90, 0x7F,
+    0xFC, 0x21, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x60, 0x20, 0x00, 0x20, 0xE0, 0x1F,
+    0x04, 0x00, 0x02, 0x00, 0x88, 0x02, 0x00, 0x02, 0x00, 0xF2, 0x00, 0x02, 0x00, 0x02, 0x03, 0x00,
+    0x81, 0xFE, 0x0F, 0x06, 0x00, 0x80, 0x48, 0x02, 0x00, 0x82, 0x02, 0x0E, 0x02, 0x04, 0x00, 0x07,
+    0x00, 0x80, 0x1C, 0x05, 0x00, 0x80, 0x10, 0x05, 0x00, 0x8C, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x05, 0x00, 0x94, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x60, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, 0x03,
+    0x00, 0x80, 0x40, 0x02, 0x00, 0x03, 0x00, 0x9C, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x50, 0x00,
+    0x50, 0xFE, 0x53, 0x00, 0x40, 0x38, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x02, 0x00, 0x84, 0x04, 0x00, 0x04, 0x00, 0x04, 0x03, 0x00, 0x83,
+    0x38, 0x07, 0x00, 0x7E, 0x0A, 0x00, 0x82, 0x40, 0x00, 0x40, 0x05, 0x00, 0x03, 0x00, 0x9C, 0x08,
+    0x10, 0x08, 0x10, 0x0A, 0x90, 0x3F, 0xFC, 0x02, 0x10, 0x02, 0x10, 0x1F, 0x10, 0x02, 0x10, 0x02,
+    0x10, 0x02, 0x10, 0x02, 0x10, 0x02, 0x10, 0x02, 0xFE, 0x3F, 0x10, 0x00, 0x02, 0x00, 0x95, 0x80,
+    0x00, 0x80, 0x03, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x10, 0x80, 0x10, 0xF8,
+    0x10, 0x80, 0x10, 0xF0, 0x13, 0x08, 0x00, 0x07, 0x00, 0x93, 0x78, 0x08, 0x00, 0xC8, 0x07, 0x08,
+    0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xF8, 0x03, 0x88, 0x3F, 0x08, 0x00, 0x08, 0x05, 0x00,
+    0x05, 0x00, 0x84, 0x7C, 0x00, 0x04, 0x00, 0x04, 0x03, 0x08, 0x80, 0x3F, 0x04, 0x08, 0x80, 0x0E,
+    0x04, 0x08, 0x82, 0x0A, 0x08, 0x0A, 0x03, 0x08, 0x03, 0x00, 0x06, 0x00, 0x91, 0x40, 0x00, 0x40,
+    0x00, 0xC0, 0x3F, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x44, 0x02, 0x44, 0x02, 0xFC, 0x02, 0x05,
+    0x00, 0x80, 0x01, 0x02, 0x00, 0x05, 0x00, 0x80, 0x18, 0x0A, 0x00, 0x81, 0x80, 0x7F, 0x03, 0x00,
+    0x80, 0x02, 0x0A, 0x00, 0x09, 0x00, 0x93, 0x02, 0x42, 0x02, 0xFE, 0x02, 0x42, 0x00, 0x42, 0x00,
+    0x42, 0x20, 0x40, 0x00, 0x40, 0x18, 0x40, 0x00, 0x40, 0x00, 0x40, 0x03, 0x00, 0x05, 0x00, 0x98,
+    0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x7E, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x05, 0x00, 0x85, 0x10, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x03, 0x10, 0x91, 0x90, 0x10, 0xC0, 0x10, 0xC0, 0x10, 0xC4, 0x10, 0xFC,
+    0x11, 0xC4, 0x10, 0x84, 0x10, 0x04, 0x10, 0x04, 0x10, 0x06, 0x00, 0x93, 0x02, 0x7F, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x00, 0xF8, 0x7F,
+    0x06, 0x00, 0x07, 0x00, 0x92, 0x01, 0x00, 0x3F, 0x30, 0x21, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23,
+    0x00, 0x21, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0C, 0x06, 0x00, 0x0B, 0x00, 0x94, 0x40, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40,
+    0x00, 0x40, 0x05, 0x00, 0x8E, 0x01, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x80, 0x3F, 0x00, 0x08,
+    0x00, 0x08, 0x00, 0x08, 0x04, 0x00, 0x81, 0xF8, 0x07, 0x06, 0x00,
+};
+// clang-format on
@@ -0,0 +1,372 @@
+// Copyright 2024 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-font-image -i dejavusans16.png -f mono16 -u "°±µ"`
+
+#include <qp.h>
+
+const uint32_t font_dejavusans16_length = 5739;
+
+// clang-format off
+const uint8_t font_dejavusans16[5739] = {
+    0x00, 0xFF, 0x14, 0x00, 0x00, 0x51, 0x46, 0x46, 0x01, 0x6B, 0x16, 0x00, 0x00, 0x94, 0xE9, 0xFF,
+    0xFF, 0x11, 0x01, 0x03, 0x00, 0x02, 0x00, 0x01, 0xFF, 0x01, 0xFE, 0x1D, 0x01, 0x00, 0x05, 0x00,
+    0x00, 0x86, 0x00, 0x00, 0x07, 0x0B, 0x00, 0x8D, 0x0F, 0x00, 0xCA, 0x21, 0x00, 0x4F, 0x34, 0x00,
+    0x8C, 0x4C, 0x00, 0xC4, 0x5E, 0x00, 0x06, 0x62, 0x00, 0x06, 0x6E, 0x00, 0x08, 0x7A, 0x00, 0x4D,
+    0x83, 0x00, 0xC5, 0x8E, 0x00, 0x46, 0x92, 0x00, 0x45, 0x94, 0x00, 0x86, 0x96, 0x00, 0x8A, 0xA1,
+    0x00, 0x8A, 0xB1, 0x00, 0x8A, 0xC1, 0x00, 0xCA, 0xD2, 0x00, 0x0A, 0xE3, 0x00, 0xCA, 0xF2, 0x00,
+    0x4A, 0x03, 0x01, 0x0A, 0x13, 0x01, 0x0A, 0x23, 0x01, 0xCA, 0x32, 0x01, 0xC5, 0x42, 0x01, 0xC5,
+    0x46, 0x01, 0x0D, 0x4C, 0x01, 0x8D, 0x5A, 0x01, 0x0D, 0x5F, 0x01, 0xC9, 0x6C, 0x01, 0x90, 0x7A,
+    0x01, 0x8B, 0x97, 0x01, 0x4B, 0xAA, 0x01, 0xCB, 0xBC, 0x01, 0x4C, 0xCD, 0x01, 0x4A, 0xE2, 0x01,
+    0x89, 0xF2, 0x01, 0x4C, 0x02, 0x02, 0x4C, 0x15, 0x02, 0x05, 0x2B, 0x02, 0x85, 0x33, 0x02, 0x0B,
+    0x3E, 0x02, 0x09, 0x51, 0x02, 0x4E, 0x61, 0x02, 0x8C, 0x77, 0x02, 0xCD, 0x8A, 0x02, 0x0A, 0xA0,
+    0x02, 0x8D, 0xAF, 0x02, 0x4B, 0xC7, 0x02, 0x8A, 0xD9, 0x02, 0x0A, 0xEA, 0x02, 0xCC, 0xF9, 0x02,
+    0x8B, 0x0F, 0x03, 0x50, 0x22, 0x03, 0x4B, 0x3D, 0x03, 0x4A, 0x50, 0x03, 0xCB, 0x60, 0x03, 0x46,
+    0x72, 0x03, 0x06, 0x7E, 0x03, 0x86, 0x8A, 0x03, 0x4D, 0x96, 0x03, 0x09, 0x9D, 0x03, 0x08, 0x9F,
+    0x03, 0xCA, 0xA2, 0x03, 0x0A, 0xAF, 0x03, 0x09, 0xBF, 0x03, 0x0A, 0xCA, 0x03, 0x8A, 0xD9, 0x03,
+    0xC6, 0xE5, 0x03, 0x8A, 0xEF, 0x03, 0x4A, 0xFF, 0x03, 0x84, 0x0F, 0x04, 0x04, 0x17, 0x04, 0x8A,
+    0x1F, 0x04, 0x84, 0x30, 0x04, 0xD0, 0x37, 0x04, 0x0A, 0x4B, 0x04, 0x8A, 0x57, 0x04, 0x8A, 0x63,
+    0x04, 0x0A, 0x73, 0x04, 0x07, 0x83, 0x04, 0x48, 0x8D, 0x04, 0xC6, 0x97, 0x04, 0x8A, 0xA1, 0x04,
+    0x09, 0xAE, 0x04, 0x8D, 0xB9, 0x04, 0x89, 0xC9, 0x04, 0x09, 0xD6, 0x04, 0x88, 0xE5, 0x04, 0x8A,
+    0xF1, 0x04, 0x45, 0x03, 0x05, 0x0A, 0x0E, 0x05, 0x8D, 0x1F, 0x05, 0x02, 0xFD, 0x12, 0x00, 0x00,
+    0xB0, 0x00, 0x00, 0x48, 0x24, 0x05, 0xB1, 0x00, 0x00, 0x0D, 0x2A, 0x05, 0xB5, 0x00, 0x00, 0x8A,
+    0x35, 0x05, 0x04, 0xFB, 0x14, 0x15, 0x00, 0x2B, 0x00, 0x04, 0x00, 0x80, 0xF9, 0x02, 0x00, 0x80,
+    0xF9, 0x02, 0x00, 0x80, 0xF9, 0x02, 0x00, 0x80, 0xF9, 0x02, 0x00, 0x80, 0xF9, 0x02, 0x00, 0x80,
+    0xF8, 0x02, 0x00, 0x80, 0xE8, 0x02, 0x00, 0x80, 0xD7, 0x08, 0x00, 0x80, 0xF9, 0x02, 0x00, 0x80,
+    0xF9, 0x0D, 0x00, 0x04, 0x00, 0x8C, 0xD7, 0x80, 0x0C, 0x70, 0x0D, 0xC8, 0x00, 0xD7, 0x80, 0x0C,
+    0x70, 0x0D, 0xC8, 0x2B, 0x00, 0x0F, 0x00, 0x83, 0x60, 0x0D, 0xD0, 0x06, 0x03, 0x00, 0x82, 0x9A,
+    0x20, 0x2F, 0x03, 0x00, 0x82, 0xE0, 0x05, 0xD6, 0x02, 0x00, 0x80, 0xD0, 0x04, 0xFF, 0x80, 0x3F,
+    0x02, 0x00, 0x82, 0xC7, 0x00, 0x5E, 0x03, 0x00, 0x83, 0xA0, 0x09, 0xF2, 0x02, 0x03, 0x00, 0x82,
+    0x5E, 0x50, 0x0E, 0x02, 0x00, 0x80, 0xFC, 0x04, 0xFF, 0x85, 0x04, 0x00, 0x70, 0x0C, 0xD0, 0x05,
+    0x03, 0x00, 0x82, 0x8B, 0x30, 0x1F, 0x03, 0x00, 0x82, 0xE0, 0x04, 0xC6, 0x1D, 0x00, 0x07, 0x00,
+    0x80, 0x66, 0x04, 0x00, 0x80, 0x66, 0x03, 0x00, 0x8B, 0xC5, 0xFE, 0x5C, 0x00, 0x40, 0x6F, 0x76,
+    0xA4, 0x02, 0x90, 0x0C, 0x66, 0x02, 0x00, 0x82, 0x80, 0x2E, 0x66, 0x02, 0x00, 0x83, 0x10, 0xED,
+    0xAD, 0x04, 0x02, 0x00, 0x83, 0x50, 0xEA, 0xDF, 0x02, 0x02, 0x00, 0x82, 0x66, 0xD2, 0x0B, 0x02,
+    0x00, 0x8B, 0x66, 0xA0, 0x0C, 0x80, 0x27, 0x76, 0xE5, 0x07, 0x20, 0xC8, 0xEF, 0x6C, 0x03, 0x00,
+    0x80, 0x66, 0x04, 0x00, 0x80, 0x66, 0x0C, 0x00, 0x08, 0x00, 0x93, 0xB2, 0xCE, 0x03, 0x00, 0xA0,
+    0x09, 0x00, 0xC0, 0x19, 0xD7, 0x01, 0x40, 0x1E, 0x00, 0x10, 0x3F, 0x10, 0x3F, 0x00, 0x5D, 0x02,
+    0x00, 0x84, 0xF1, 0x03, 0xF1, 0x03, 0xB8, 0x03, 0x00, 0x84, 0x9C, 0x71, 0x1E, 0xE2, 0x02, 0x02,
+    0x00, 0x84, 0x20, 0xEB, 0x3C, 0xB0, 0x08, 0x05, 0x00, 0x84, 0x50, 0x1D, 0xB2, 0xCE, 0x04, 0x02,
+    0x00, 0x85, 0x10, 0x5D, 0xB0, 0x1A, 0xE7, 0x01, 0x02, 0x00, 0x84, 0xB8, 0x00, 0x4F, 0x00, 0x4F,
+    0x02, 0x00, 0x93, 0xE3, 0x02, 0xF0, 0x04, 0xF0, 0x04, 0x00, 0xB0, 0x07, 0x00, 0xAB, 0x71, 0x1E,
+    0x00, 0x60, 0x0D, 0x00, 0x20, 0xEB, 0x4C, 0x1F, 0x00, 0x07, 0x00, 0x82, 0x50, 0xEC, 0x5C, 0x03,
+    0x00, 0x83, 0xF4, 0x17, 0xA3, 0x02, 0x02, 0x00, 0x80, 0xD9, 0x05, 0x00, 0x81, 0xF8, 0x01, 0x04,
+    0x00, 0x81, 0xF3, 0x09, 0x04, 0x00, 0x81, 0xF7, 0x7F, 0x03, 0x00, 0xA3, 0x50, 0x6F, 0xF9, 0x07,
+    0x20, 0x5F, 0xC0, 0x0B, 0x80, 0x7F, 0x50, 0x1F, 0xE0, 0x08, 0x00, 0xF8, 0xC7, 0x0A, 0xC0, 0x0C,
+    0x00, 0x80, 0xEF, 0x02, 0x40, 0xAF, 0x12, 0xA3, 0xFF, 0x07, 0x00, 0xA3, 0xFE, 0x9D, 0x72, 0x7F,
+    0x18, 0x00, 0x02, 0x00, 0x87, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x18, 0x00, 0x04,
+    0x00, 0x9E, 0x90, 0x0B, 0x00, 0xF2, 0x03, 0x00, 0xC9, 0x00, 0x10, 0x6E, 0x00, 0x40, 0x3F, 0x00,
+    0x70, 0x0F, 0x00, 0x90, 0x0E, 0x00, 0x90, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0x40, 0x3F, 0x00, 0x10,
+    0x7E, 0x02, 0x00, 0x80, 0xC9, 0x02, 0x00, 0x84, 0xF2, 0x03, 0x00, 0x90, 0x0B, 0x06, 0x00, 0x03,
+    0x00, 0x84, 0x70, 0x0C, 0x00, 0x10, 0x6E, 0x02, 0x00, 0x80, 0xD8, 0x02, 0x00, 0x9E, 0xF3, 0x04,
+    0x00, 0xE0, 0x08, 0x00, 0xC0, 0x0B, 0x00, 0xA0, 0x0C, 0x00, 0xA0, 0x0C, 0x00, 0xC0, 0x0B, 0x00,
+    0xE0, 0x08, 0x00, 0xF3, 0x04, 0x00, 0xD8, 0x00, 0x10, 0x6E, 0x00, 0x70, 0x0C, 0x07, 0x00, 0x05,
+    0x00, 0x81, 0x70, 0x07, 0x02, 0x00, 0x95, 0x70, 0x07, 0x00, 0xA4, 0x73, 0x37, 0x4A, 0x20, 0xD9,
+    0x9D, 0x02, 0x20, 0xD9, 0x9D, 0x02, 0xA4, 0x73, 0x37, 0x4A, 0x00, 0x70, 0x07, 0x02, 0x00, 0x81,
+    0x70, 0x07, 0x21, 0x00, 0x1D, 0x00, 0x80, 0x5E, 0x05, 0x00, 0x81, 0xE0, 0x05, 0x05, 0x00, 0x80,
+    0x5E, 0x05, 0x00, 0x81, 0xE0, 0x05, 0x02, 0x00, 0x80, 0x40, 0x04, 0xFF, 0x80, 0xBF, 0x03, 0x00,
+    0x81, 0xE0, 0x05, 0x05, 0x00, 0x80, 0x5E, 0x05, 0x00, 0x81, 0xE0, 0x05, 0x05, 0x00, 0x80, 0x5E,
+    0x1D, 0x00, 0x1C, 0x00, 0x88, 0xF2, 0x08, 0x30, 0x7F, 0x00, 0xE6, 0x01, 0xA0, 0x07, 0x06, 0x00,
+    0x18, 0x00, 0x82, 0xF3, 0xFF, 0x0F, 0x18, 0x00, 0x1C, 0x00, 0x83, 0xF4, 0x05, 0x40, 0x5F, 0x0B,
+    0x00, 0x04, 0x00, 0x8C, 0x10, 0x3F, 0x00, 0x60, 0x0E, 0x00, 0xB0, 0x09, 0x00, 0xF1, 0x04, 0x00,
+    0xE5, 0x02, 0x00, 0x80, 0xAA, 0x02, 0x00, 0x8E, 0x5E, 0x00, 0x40, 0x1F, 0x00, 0x90, 0x0B, 0x00,
+    0xE0, 0x06, 0x00, 0xF3, 0x02, 0x00, 0xC8, 0x02, 0x00, 0x80, 0x7D, 0x0B, 0x00, 0x06, 0x00, 0x82,
+    0xA1, 0xEE, 0x3B, 0x02, 0x00, 0xB4, 0xCC, 0x12, 0xEA, 0x01, 0x60, 0x2F, 0x00, 0xE1, 0x08, 0xA0,
+    0x0D, 0x00, 0xA0, 0x0D, 0xD0, 0x0B, 0x00, 0x80, 0x1F, 0xE0, 0x0A, 0x00, 0x70, 0x1F, 0xE0, 0x0A,
+    0x00, 0x70, 0x1F, 0xD0, 0x0B, 0x00, 0x80, 0x1F, 0xA0, 0x0D, 0x00, 0xA0, 0x0D, 0x60, 0x2F, 0x00,
+    0xE1, 0x08, 0x00, 0xCC, 0x12, 0xEA, 0x02, 0x00, 0xA1, 0xEE, 0x3B, 0x15, 0x00, 0x06, 0x00, 0x87,
+    0x94, 0xFE, 0x02, 0x00, 0x30, 0x6B, 0xF7, 0x02, 0x03, 0x00, 0x81, 0xF7, 0x02, 0x03, 0x00, 0x81,
+    0xF7, 0x02, 0x03, 0x00, 0x81, 0xF7, 0x02, 0x03, 0x00, 0x81, 0xF7, 0x02, 0x03, 0x00, 0x81, 0xF7,
+    0x02, 0x03, 0x00, 0x81, 0xF7, 0x02, 0x03, 0x00, 0x81, 0xF7, 0x02, 0x03, 0x00, 0x81, 0xF7, 0x02,
+    0x03, 0x00, 0x81, 0xF7, 0x02, 0x02, 0x00, 0x03, 0xFF, 0x80, 0x0B, 0x14, 0x00, 0x05, 0x00, 0x8E,
+    0x20, 0xC8, 0xDE, 0x19, 0x00, 0xB0, 0x4D, 0x31, 0xDC, 0x01, 0x70, 0x01, 0x00, 0xF4, 0x06, 0x03,
+    0x00, 0x81, 0xF2, 0x07, 0x03, 0x00, 0x81, 0xF6, 0x05, 0x02, 0x00, 0x82, 0x10, 0xDD, 0x01, 0x02,
+    0x00, 0x81, 0xB0, 0x4F, 0x03, 0x00, 0x81, 0xFA, 0x05, 0x02, 0x00, 0x81, 0x80, 0x6F, 0x03, 0x00,
+    0x81, 0xF7, 0x07, 0x02, 0x00, 0x81, 0x60, 0x8F, 0x03, 0x00, 0x80, 0xC0, 0x03, 0xFF, 0x80, 0x09,
+    0x14, 0x00, 0x05, 0x00, 0x89, 0x10, 0xC6, 0xEE, 0x3B, 0x00, 0x60, 0x38, 0x21, 0xFA, 0x03, 0x03,
+    0x00, 0x81, 0xF1, 0x09, 0x03, 0x00, 0x81, 0xF1, 0x08, 0x02, 0x00, 0x86, 0x20, 0xEA, 0x02, 0x00,
+    0xC0, 0xFF, 0x3E, 0x03, 0x00, 0x82, 0x20, 0xEA, 0x04, 0x03, 0x00, 0x81, 0xD0, 0x0B, 0x03, 0x00,
+    0x81, 0xB0, 0x0D, 0x03, 0x00, 0x8A, 0xD0, 0x0B, 0x90, 0x25, 0x31, 0xFA, 0x03, 0x20, 0xD9, 0xDF,
+    0x2A, 0x15, 0x00, 0x07, 0x00, 0x81, 0xA0, 0x9F, 0x03, 0x00, 0x81, 0xE5, 0x9F, 0x02, 0x00, 0x82,
+    0x10, 0x6E, 0x9E, 0x02, 0x00, 0x82, 0xA0, 0x0C, 0x9E, 0x02, 0x00, 0x93, 0xF4, 0x03, 0x9E, 0x00,
+    0x10, 0x9D, 0x00, 0x9E, 0x00, 0x90, 0x1E, 0x00, 0x9E, 0x00, 0xF2, 0x05, 0x00, 0x9E, 0x00, 0xF3,
+    0x03, 0xFF, 0x80, 0x4F, 0x03, 0x00, 0x80, 0x9E, 0x04, 0x00, 0x80, 0x9E, 0x04, 0x00, 0x80, 0x9E,
+    0x15, 0x00, 0x05, 0x00, 0x80, 0x40, 0x02, 0xFF, 0x83, 0xEF, 0x00, 0x40, 0x3F, 0x03, 0x00, 0x81,
+    0x40, 0x3F, 0x03, 0x00, 0x81, 0x40, 0x3F, 0x03, 0x00, 0x80, 0x40, 0x02, 0xEF, 0x86, 0x29, 0x00,
+    0x40, 0x28, 0x41, 0xDD, 0x01, 0x03, 0x00, 0x81, 0xF3, 0x08, 0x03, 0x00, 0x81, 0xD0, 0x0B, 0x03,
+    0x00, 0x81, 0xD0, 0x0B, 0x03, 0x00, 0x8A, 0xF3, 0x08, 0x90, 0x25, 0x41, 0xDD, 0x01, 0x20, 0xD9,
+    0xDF, 0x29, 0x15, 0x00, 0x06, 0x00, 0x8A, 0x40, 0xEB, 0x8D, 0x01, 0x00, 0xE6, 0x15, 0x71, 0x06,
+    0x20, 0x5F, 0x03, 0x00, 0x81, 0x80, 0x0E, 0x03, 0x00, 0xA6, 0xB0, 0x7C, 0xFD, 0x6D, 0x00, 0xD0,
+    0xDF, 0x13, 0xF7, 0x07, 0xD0, 0x4F, 0x00, 0xB0, 0x0E, 0xC0, 0x1F, 0x00, 0x70, 0x2F, 0x90, 0x1F,
+    0x00, 0x70, 0x2F, 0x40, 0x4F, 0x00, 0xA0, 0x0E, 0x00, 0xDB, 0x13, 0xF6, 0x06, 0x00, 0x91, 0xFE,
+    0x6C, 0x15, 0x00, 0x05, 0x00, 0x80, 0xA0, 0x03, 0xFF, 0x80, 0x0C, 0x03, 0x00, 0x81, 0xF4, 0x08,
+    0x03, 0x00, 0x81, 0xF9, 0x02, 0x02, 0x00, 0x81, 0x10, 0xBE, 0x03, 0x00, 0x81, 0x50, 0x6F, 0x03,
+    0x00, 0x81, 0xB0, 0x1E, 0x03, 0x00, 0x81, 0xF1, 0x0A, 0x03, 0x00, 0x81, 0xF7, 0x04, 0x03, 0x00,
+    0x80, 0xDC, 0x03, 0x00, 0x81, 0x20, 0x8F, 0x03, 0x00, 0x81, 0x80, 0x2F, 0x03, 0x00, 0x81, 0xD0,
+    0x0B, 0x16, 0x00, 0x06, 0x00, 0xB9, 0xB4, 0xEE, 0x5C, 0x00, 0x30, 0x9F, 0x11, 0xF7, 0x06, 0x80,
+    0x1F, 0x00, 0xD0, 0x0B, 0x80, 0x1F, 0x00, 0xD0, 0x0B, 0x20, 0x9E, 0x11, 0xE7, 0x04, 0x00, 0xD3,
+    0xFF, 0x5E, 0x00, 0x30, 0x9E, 0x12, 0xF7, 0x06, 0xB0, 0x0D, 0x00, 0xA0, 0x0E, 0xD0, 0x0B, 0x00,
+    0x80, 0x1F, 0xC0, 0x0D, 0x00, 0xA0, 0x0E, 0x50, 0x9F, 0x11, 0xF7, 0x08, 0x00, 0xB4, 0xEE, 0x6C,
+    0x15, 0x00, 0x06, 0x00, 0xA6, 0xB4, 0xEE, 0x2A, 0x00, 0x40, 0x9F, 0x21, 0xDB, 0x01, 0xB0, 0x0D,
+    0x00, 0xF2, 0x07, 0xE0, 0x0A, 0x00, 0xD0, 0x0C, 0xE0, 0x0A, 0x00, 0xD0, 0x0E, 0xB0, 0x0D, 0x00,
+    0xF2, 0x1F, 0x40, 0x9F, 0x21, 0xFB, 0x0F, 0x00, 0xC5, 0xEF, 0x98, 0x0E, 0x03, 0x00, 0x81, 0xC0,
+    0x0A, 0x03, 0x00, 0x85, 0xF3, 0x04, 0x30, 0x28, 0x40, 0x9D, 0x02, 0x00, 0x82, 0xD7, 0xCF, 0x06,
+    0x15, 0x00, 0x0D, 0x00, 0x83, 0xF2, 0x08, 0x20, 0x8F, 0x0B, 0x00, 0x83, 0xF2, 0x08, 0x20, 0x8F,
+    0x0B, 0x00, 0x0D, 0x00, 0x83, 0xF2, 0x08, 0x20, 0x8F, 0x0B, 0x00, 0x88, 0xF2, 0x08, 0x30, 0x7F,
+    0x00, 0xE6, 0x01, 0xA0, 0x07, 0x06, 0x00, 0x1E, 0x00, 0x81, 0x20, 0x98, 0x03, 0x00, 0x83, 0x10,
+    0xC6, 0xEF, 0x07, 0x02, 0x00, 0x82, 0x94, 0xFE, 0x5B, 0x02, 0x00, 0x83, 0x71, 0xFD, 0x7C, 0x01,
+    0x02, 0x00, 0x82, 0x40, 0xEF, 0x06, 0x04, 0x00, 0x83, 0x71, 0xFD, 0x6C, 0x01, 0x04, 0x00, 0x82,
+    0xA4, 0xFE, 0x5A, 0x04, 0x00, 0x83, 0x10, 0xC6, 0xEF, 0x07, 0x04, 0x00, 0x81, 0x20, 0x98, 0x1B,
+    0x00, 0x27, 0x00, 0x80, 0x40, 0x04, 0xFF, 0x80, 0xBF, 0x0E, 0x00, 0x80, 0xF4, 0x04, 0xFF, 0x80,
+    0x0B, 0x2E, 0x00, 0x1A, 0x00, 0x81, 0x40, 0x5A, 0x05, 0x00, 0x82, 0xC2, 0xEF, 0x38, 0x04, 0x00,
+    0x83, 0x30, 0xE8, 0xCF, 0x16, 0x04, 0x00, 0x83, 0x50, 0xFA, 0xAF, 0x03, 0x04, 0x00, 0x81, 0xC2,
+    0xBF, 0x03, 0x00, 0x88, 0x40, 0xEA, 0xAF, 0x04, 0x00, 0x20, 0xD8, 0xCF, 0x16, 0x02, 0x00, 0x82,
+    0xC2, 0xEF, 0x38, 0x03, 0x00, 0x81, 0x40, 0x5B, 0x1F, 0x00, 0x05, 0x00, 0x87, 0xA3, 0xED, 0x3B,
+    0x00, 0xA0, 0x15, 0xB2, 0x1E, 0x03, 0x00, 0x81, 0xF4, 0x05, 0x02, 0x00, 0x81, 0x80, 0x3F, 0x02,
+    0x00, 0x81, 0x50, 0x9F, 0x02, 0x00, 0x81, 0x30, 0xAF, 0x03, 0x00, 0x80, 0xDB, 0x03, 0x00, 0x81,
+    0xD0, 0x09, 0x03, 0x00, 0x80, 0x9D, 0x08, 0x00, 0x80, 0xAE, 0x03, 0x00, 0x81, 0xE0, 0x0A, 0x14,
+    0x00, 0x12, 0x00, 0x83, 0x71, 0xEC, 0xDE, 0x39, 0x03, 0x00, 0x85, 0x40, 0x9E, 0x14, 0x20, 0xE7,
+    0x07, 0x02, 0x00, 0x81, 0xE4, 0x04, 0x02, 0x00, 0x9D, 0x20, 0x7D, 0x00, 0x10, 0x5E, 0x10, 0xFA,
+    0x8E, 0x5C, 0xF2, 0x03, 0x70, 0x0B, 0xA0, 0x2C, 0xB2, 0x5F, 0x90, 0x09, 0xB0, 0x05, 0xF1, 0x03,
+    0x30, 0x5F, 0x60, 0x0C, 0xD0, 0x03, 0xF3, 0x02, 0x00, 0x85, 0x5E, 0x40, 0x0D, 0xD0, 0x03, 0xF4,
+    0x02, 0x00, 0x99, 0x5E, 0x60, 0x0B, 0xC0, 0x05, 0xF1, 0x03, 0x20, 0x5F, 0xB0, 0x07, 0x70, 0x0A,
+    0xA0, 0x2C, 0xB2, 0x6F, 0xC8, 0x00, 0x10, 0x4E, 0x10, 0xEA, 0x8D, 0xCB, 0x07, 0x02, 0x00, 0x81,
+    0xE5, 0x03, 0x06, 0x00, 0x85, 0x50, 0x9E, 0x13, 0x31, 0xC6, 0x04, 0x03, 0x00, 0x84, 0x81, 0xEC,
+    0xDE, 0x6B, 0x01, 0x09, 0x00, 0x07, 0x00, 0x81, 0x90, 0x8F, 0x03, 0x00, 0x82, 0x10, 0xFE, 0x0E,
+    0x03, 0x00, 0x82, 0xF5, 0xF7, 0x04, 0x02, 0x00, 0x82, 0xB0, 0x0D, 0xAE, 0x02, 0x00, 0x83, 0x20,
+    0x8F, 0x90, 0x1F, 0x02, 0x00, 0x90, 0xF7, 0x03, 0xF3, 0x06, 0x00, 0xD0, 0x0D, 0x00, 0xCD, 0x00,
+    0x30, 0x7F, 0x00, 0x80, 0x2F, 0x00, 0xF9, 0x03, 0xFF, 0x82, 0x08, 0xE0, 0x0A, 0x02, 0x00, 0x82,
+    0xDB, 0x50, 0x5F, 0x02, 0x00, 0x82, 0x50, 0x4F, 0xEA, 0x03, 0x00, 0x81, 0xE1, 0x09, 0x16, 0x00,
+    0x06, 0x00, 0x9B, 0xF6, 0xFF, 0xDF, 0x2A, 0x00, 0x60, 0x2F, 0x00, 0xC3, 0x1D, 0x00, 0xF6, 0x02,
+    0x00, 0xF5, 0x04, 0x60, 0x2F, 0x00, 0x50, 0x4F, 0x00, 0xF6, 0x02, 0x30, 0xDC, 0x00, 0x60, 0x02,
+    0xFF, 0x89, 0xDF, 0x03, 0x00, 0xF6, 0x02, 0x20, 0xE9, 0x03, 0x60, 0x2F, 0x02, 0x00, 0x88, 0xAE,
+    0x00, 0xF6, 0x02, 0x00, 0xD0, 0x0C, 0x60, 0x2F, 0x02, 0x00, 0x87, 0xBE, 0x00, 0xF6, 0x02, 0x20,
+    0xF9, 0x04, 0x60, 0x02, 0xFF, 0x81, 0xBE, 0x04, 0x17, 0x00, 0x07, 0x00, 0x8B, 0xA3, 0xFD, 0xBD,
+    0x05, 0x00, 0xF6, 0x29, 0x20, 0xF7, 0x05, 0xF3, 0x08, 0x02, 0x00, 0x82, 0x43, 0xA0, 0x0E, 0x04,
+    0x00, 0x80, 0xBE, 0x04, 0x00, 0x81, 0xF1, 0x09, 0x03, 0x00, 0x81, 0x10, 0x9F, 0x04, 0x00, 0x81,
+    0xE0, 0x0B, 0x04, 0x00, 0x80, 0xEA, 0x04, 0x00, 0x81, 0x30, 0x7F, 0x02, 0x00, 0x8B, 0x30, 0x04,
+    0x60, 0x9F, 0x02, 0x72, 0x5F, 0x00, 0x30, 0xEA, 0xDF, 0x5B, 0x17, 0x00, 0x06, 0x00, 0x8D, 0x60,
+    0xFF, 0xEF, 0xAD, 0x05, 0x00, 0x60, 0x2F, 0x00, 0x72, 0xBE, 0x00, 0x60, 0x2F, 0x02, 0x00, 0x83,
+    0xF3, 0x09, 0x60, 0x2F, 0x02, 0x00, 0x83, 0xA0, 0x1F, 0x60, 0x2F, 0x02, 0x00, 0x83, 0x60, 0x4F,
+    0x60, 0x2F, 0x02, 0x00, 0x83, 0x50, 0x5F, 0x60, 0x2F, 0x02, 0x00, 0x83, 0x50, 0x5F, 0x60, 0x2F,
+    0x02, 0x00, 0x83, 0x60, 0x4F, 0x60, 0x2F, 0x02, 0x00, 0x83, 0xA0, 0x1F, 0x60, 0x2F, 0x02, 0x00,
+    0x8C, 0xF3, 0x09, 0x60, 0x2F, 0x00, 0x72, 0xBE, 0x00, 0x60, 0xFF, 0xEF, 0xAD, 0x05, 0x19, 0x00,
+    0x05, 0x00, 0x80, 0x60, 0x03, 0xFF, 0x82, 0x0E, 0x60, 0x2F, 0x03, 0x00, 0x81, 0x60, 0x2F, 0x03,
+    0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x80, 0x60, 0x03, 0xFF, 0x82,
+    0x0B, 0x60, 0x2F, 0x03, 0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x81,
+    0x60, 0x2F, 0x03, 0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x80, 0x60, 0x03, 0xFF, 0x80, 0x1F, 0x14,
+    0x00, 0x05, 0x00, 0x80, 0xF6, 0x02, 0xFF, 0x82, 0x4F, 0x60, 0x2F, 0x03, 0x00, 0x81, 0xF6, 0x02,
+    0x02, 0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x81, 0xF6, 0x02, 0x02, 0x00, 0x80, 0x60, 0x02, 0xFF,
+    0x83, 0xCF, 0x00, 0xF6, 0x02, 0x02, 0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x81, 0xF6, 0x02, 0x02,
+    0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x81, 0xF6, 0x02, 0x02, 0x00, 0x81, 0x60, 0x2F, 0x15, 0x00,
+    0x07, 0x00, 0x8C, 0x30, 0xDA, 0xEF, 0x8C, 0x02, 0x00, 0xF6, 0x39, 0x10, 0xD5, 0x0C, 0x30, 0x7F,
+    0x03, 0x00, 0x82, 0x07, 0xA0, 0x0E, 0x04, 0x00, 0x81, 0xE0, 0x0A, 0x04, 0x00, 0x81, 0xF1, 0x09,
+    0x04, 0x00, 0x87, 0xF1, 0x09, 0x00, 0xF1, 0xFF, 0x1F, 0xE0, 0x0A, 0x02, 0x00, 0x83, 0x70, 0x1F,
+    0xA0, 0x0E, 0x02, 0x00, 0x83, 0x70, 0x1F, 0x30, 0x7F, 0x02, 0x00, 0x8D, 0x70, 0x1F, 0x00, 0xF6,
+    0x39, 0x10, 0xB4, 0x1F, 0x00, 0x30, 0xDA, 0xEF, 0x9C, 0x03, 0x18, 0x00, 0x06, 0x00, 0x81, 0x60,
+    0x2F, 0x02, 0x00, 0x83, 0xF2, 0x07, 0x60, 0x2F, 0x02, 0x00, 0x83, 0xF2, 0x07, 0x60, 0x2F, 0x02,
+    0x00, 0x83, 0xF2, 0x07, 0x60, 0x2F, 0x02, 0x00, 0x83, 0xF2, 0x07, 0x60, 0x2F, 0x02, 0x00, 0x82,
+    0xF2, 0x07, 0x60, 0x04, 0xFF, 0x82, 0x07, 0x60, 0x2F, 0x02, 0x00, 0x83, 0xF2, 0x07, 0x60, 0x2F,
+    0x02, 0x00, 0x83, 0xF2, 0x07, 0x60, 0x2F, 0x02, 0x00, 0x83, 0xF2, 0x07, 0x60, 0x2F, 0x02, 0x00,
+    0x83, 0xF2, 0x07, 0x60, 0x2F, 0x02, 0x00, 0x83, 0xF2, 0x07, 0x60, 0x2F, 0x02, 0x00, 0x81, 0xF2,
+    0x07, 0x18, 0x00, 0x03, 0x00, 0x9C, 0xF6, 0x02, 0x60, 0x2F, 0x00, 0xF6, 0x02, 0x60, 0x2F, 0x00,
+    0xF6, 0x02, 0x60, 0x2F, 0x00, 0xF6, 0x02, 0x60, 0x2F, 0x00, 0xF6, 0x02, 0x60, 0x2F, 0x00, 0xF6,
+    0x02, 0x60, 0x2F, 0x0B, 0x00, 0x03, 0x00, 0xA4, 0x60, 0x2F, 0x00, 0xF6, 0x02, 0x60, 0x2F, 0x00,
+    0xF6, 0x02, 0x60, 0x2F, 0x00, 0xF6, 0x02, 0x60, 0x2F, 0x00, 0xF6, 0x02, 0x60, 0x2F, 0x00, 0xF6,
+    0x02, 0x60, 0x2F, 0x00, 0xF7, 0x02, 0x80, 0x1F, 0x30, 0xBE, 0xC0, 0x9D, 0x01, 0x03, 0x00, 0x06,
+    0x00, 0x93, 0xF6, 0x02, 0x00, 0xE3, 0x1C, 0x60, 0x2F, 0x00, 0xE3, 0x1C, 0x00, 0xF6, 0x02, 0xE4,
+    0x1C, 0x00, 0x60, 0x2F, 0xE4, 0x1B, 0x02, 0x00, 0x82, 0xF6, 0xF7, 0x1B, 0x02, 0x00, 0x82, 0x60,
+    0xFF, 0x0D, 0x03, 0x00, 0x82, 0xF6, 0xFB, 0x08, 0x02, 0x00, 0x83, 0x60, 0x2F, 0xF9, 0x07, 0x02,
+    0x00, 0x91, 0xF6, 0x02, 0xF9, 0x07, 0x00, 0x60, 0x2F, 0x00, 0xFA, 0x06, 0x00, 0xF6, 0x02, 0x00,
+    0xFA, 0x06, 0x60, 0x2F, 0x02, 0x00, 0x81, 0xFB, 0x05, 0x16, 0x00, 0x05, 0x00, 0x81, 0xF6, 0x02,
+    0x02, 0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x81, 0xF6, 0x02, 0x02, 0x00, 0x81, 0x60, 0x2F, 0x03,
+    0x00, 0x81, 0xF6, 0x02, 0x02, 0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x81, 0xF6, 0x02, 0x02, 0x00,
+    0x81, 0x60, 0x2F, 0x03, 0x00, 0x81, 0xF6, 0x02, 0x02, 0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x81,
+    0xF6, 0x02, 0x02, 0x00, 0x80, 0x60, 0x03, 0xFF, 0x80, 0x0C, 0x12, 0x00, 0x07, 0x00, 0xC7, 0x60,
+    0xFF, 0x02, 0x00, 0x40, 0xFF, 0x04, 0x60, 0xEF, 0x07, 0x00, 0xA0, 0xFE, 0x04, 0x60, 0xAF, 0x0C,
+    0x00, 0xE1, 0xFA, 0x04, 0x60, 0x5F, 0x2F, 0x00, 0xE5, 0xF5, 0x04, 0x60, 0x2F, 0x8D, 0x00, 0xAB,
+    0xF4, 0x04, 0x60, 0x2F, 0xD7, 0x10, 0x4F, 0xF4, 0x04, 0x60, 0x2F, 0xF2, 0x63, 0x0E, 0xF4, 0x04,
+    0x60, 0x2F, 0xC0, 0xC9, 0x09, 0xF4, 0x04, 0x60, 0x2F, 0x60, 0xFE, 0x03, 0xF4, 0x04, 0x60, 0x2F,
+    0x10, 0xDF, 0x00, 0xF4, 0x04, 0x60, 0x2F, 0x03, 0x00, 0x83, 0xF4, 0x04, 0x60, 0x2F, 0x03, 0x00,
+    0x81, 0xF4, 0x04, 0x1C, 0x00, 0x06, 0x00, 0xC7, 0x60, 0xEF, 0x01, 0x00, 0xF2, 0x06, 0x60, 0xFF,
+    0x07, 0x00, 0xF2, 0x06, 0x60, 0xBF, 0x1E, 0x00, 0xF2, 0x06, 0x60, 0x4F, 0x8F, 0x00, 0xF2, 0x06,
+    0x60, 0x2F, 0xE9, 0x01, 0xF2, 0x06, 0x60, 0x2F, 0xF2, 0x08, 0xF2, 0x06, 0x60, 0x2F, 0x80, 0x1E,
+    0xF2, 0x06, 0x60, 0x2F, 0x10, 0x9E, 0xF2, 0x06, 0x60, 0x2F, 0x00, 0xF8, 0xF4, 0x06, 0x60, 0x2F,
+    0x00, 0xE1, 0xFB, 0x06, 0x60, 0x2F, 0x00, 0x70, 0xFF, 0x06, 0x60, 0x2F, 0x00, 0x10, 0xFE, 0x06,
+    0x18, 0x00, 0x08, 0x00, 0x83, 0xB4, 0xFE, 0x8D, 0x01, 0x02, 0x00, 0x8D, 0xF7, 0x28, 0x30, 0xDC,
+    0x02, 0x00, 0xF3, 0x08, 0x00, 0x10, 0xCD, 0x00, 0xA0, 0x1E, 0x02, 0x00, 0x83, 0x60, 0x4F, 0x00,
+    0xBE, 0x03, 0x00, 0x83, 0xF2, 0x08, 0xF1, 0x09, 0x03, 0x00, 0x82, 0xAF, 0x10, 0x9F, 0x03, 0x00,
+    0x83, 0xF0, 0x0A, 0xE0, 0x0B, 0x02, 0x00, 0x83, 0x20, 0x8F, 0x00, 0xEA, 0x03, 0x00, 0x83, 0xF6,
+    0x04, 0x40, 0x8F, 0x02, 0x00, 0x87, 0xD1, 0x0C, 0x00, 0x70, 0x8F, 0x02, 0xC3, 0x2E, 0x02, 0x00,
+    0x83, 0x40, 0xEB, 0xDF, 0x19, 0x1C, 0x00, 0x05, 0x00, 0xA4, 0x60, 0xFF, 0xEF, 0x7C, 0x00, 0x60,
+    0x2F, 0x10, 0xF7, 0x08, 0x60, 0x2F, 0x00, 0xB0, 0x0E, 0x60, 0x2F, 0x00, 0x90, 0x1F, 0x60, 0x2F,
+    0x00, 0xB0, 0x0E, 0x60, 0x2F, 0x10, 0xF7, 0x08, 0x60, 0xFF, 0xEF, 0x7C, 0x00, 0x60, 0x2F, 0x03,
+    0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x81, 0x60, 0x2F, 0x03, 0x00, 0x81, 0x60, 0x2F, 0x03, 0x00,
+    0x81, 0x60, 0x2F, 0x17, 0x00, 0x08, 0x00, 0x83, 0xB4, 0xFE, 0x8D, 0x01, 0x02, 0x00, 0x8D, 0xF7,
+    0x28, 0x30, 0xDC, 0x02, 0x00, 0xF3, 0x08, 0x00, 0x10, 0xCD, 0x00, 0xA0, 0x1E, 0x02, 0x00, 0x83,
+    0x60, 0x4F, 0x00, 0xBE, 0x03, 0x00, 0x83, 0xF2, 0x08, 0xF1, 0x09, 0x03, 0x00, 0x82, 0xAF, 0x10,
+    0x9F, 0x03, 0x00, 0x83, 0xF0, 0x0A, 0xE0, 0x0B, 0x02, 0x00, 0x83, 0x20, 0x8F, 0x00, 0xEA, 0x03,
+    0x00, 0x83, 0xF6, 0x04, 0x40, 0x8F, 0x02, 0x00, 0x87, 0xD1, 0x0D, 0x00, 0x70, 0x8F, 0x02, 0xC3,
+    0x2E, 0x02, 0x00, 0x83, 0x40, 0xEB, 0xFF, 0x1C, 0x05, 0x00, 0x81, 0xF9, 0x04, 0x05, 0x00, 0x81,
+    0xEB, 0x03, 0x0E, 0x00, 0x06, 0x00, 0xA1, 0xF6, 0xFF, 0xDF, 0x07, 0x00, 0x60, 0x2F, 0x10, 0xF6,
+    0x08, 0x00, 0xF6, 0x02, 0x00, 0xEB, 0x00, 0x60, 0x2F, 0x00, 0x90, 0x1F, 0x00, 0xF6, 0x02, 0x00,
+    0xEB, 0x00, 0x60, 0x2F, 0x10, 0xF6, 0x08, 0x00, 0xF6, 0x02, 0xFF, 0x99, 0x09, 0x00, 0x60, 0x2F,
+    0x10, 0xF9, 0x04, 0x00, 0xF6, 0x02, 0x00, 0xDC, 0x00, 0x60, 0x2F, 0x00, 0x40, 0x6F, 0x00, 0xF6,
+    0x02, 0x00, 0xC0, 0x0D, 0x60, 0x2F, 0x02, 0x00, 0x81, 0xF4, 0x06, 0x16, 0x00, 0x06, 0x00, 0x8F,
+    0xB4, 0xEE, 0x7C, 0x01, 0x60, 0x8F, 0x12, 0xD5, 0x08, 0xC0, 0x0C, 0x00, 0x10, 0x06, 0xD0, 0x0A,
+    0x03, 0x00, 0x81, 0xA0, 0x4E, 0x03, 0x00, 0x83, 0x20, 0xFC, 0x9D, 0x16, 0x02, 0x00, 0x83, 0x30,
+    0xA7, 0xEE, 0x05, 0x03, 0x00, 0x81, 0xC1, 0x1E, 0x03, 0x00, 0x82, 0x60, 0x3F, 0x80, 0x02, 0x00,
+    0x8B, 0x80, 0x2F, 0xD0, 0x4C, 0x11, 0xE6, 0x0B, 0x20, 0xC8, 0xEE, 0x8C, 0x01, 0x14, 0x00, 0x05,
+    0x00, 0x80, 0xF1, 0x04, 0xFF, 0x02, 0x00, 0x81, 0xE0, 0x0A, 0x03, 0x00, 0x81, 0xE0, 0x0A, 0x03,
+    0x00, 0x81, 0xE0, 0x0A, 0x03, 0x00, 0x81, 0xE0, 0x0A, 0x03, 0x00, 0x81, 0xE0, 0x0A, 0x03, 0x00,
+    0x81, 0xE0, 0x0A, 0x03, 0x00, 0x81, 0xE0, 0x0A, 0x03, 0x00, 0x81, 0xE0, 0x0A, 0x03, 0x00, 0x81,
+    0xE0, 0x0A, 0x03, 0x00, 0x81, 0xE0, 0x0A, 0x03, 0x00, 0x81, 0xE0, 0x0A, 0x15, 0x00, 0x06, 0x00,
+    0x81, 0x90, 0x0F, 0x02, 0x00, 0x83, 0xF4, 0x05, 0x90, 0x0F, 0x02, 0x00, 0x83, 0xF4, 0x05, 0x90,
+    0x0F, 0x02, 0x00, 0x83, 0xF4, 0x05, 0x90, 0x0F, 0x02, 0x00, 0x83, 0xF4, 0x05, 0x90, 0x0F, 0x02,
+    0x00, 0x83, 0xF4, 0x05, 0x90, 0x0F, 0x02, 0x00, 0x83, 0xF4, 0x05, 0x90, 0x0F, 0x02, 0x00, 0x83,
+    0xF4, 0x05, 0x90, 0x0F, 0x02, 0x00, 0x83, 0xF4, 0x05, 0x80, 0x1F, 0x02, 0x00, 0x83, 0xF5, 0x04,
+    0x40, 0x5F, 0x02, 0x00, 0x86, 0xE9, 0x01, 0x00, 0xDB, 0x14, 0x72, 0x7F, 0x02, 0x00, 0x83, 0x81,
+    0xFD, 0xCE, 0x05, 0x19, 0x00, 0x05, 0x00, 0x81, 0xA0, 0x0E, 0x02, 0x00, 0x83, 0x10, 0x9E, 0xF5,
+    0x05, 0x02, 0x00, 0x82, 0xF6, 0x04, 0xAE, 0x02, 0x00, 0x96, 0xB0, 0x0D, 0x90, 0x1F, 0x00, 0x20,
+    0x8F, 0x00, 0xF3, 0x06, 0x00, 0xF7, 0x02, 0x00, 0xCD, 0x00, 0xD0, 0x0C, 0x00, 0x70, 0x2F, 0x30,
+    0x6F, 0x02, 0x00, 0x83, 0xF2, 0x08, 0xF9, 0x01, 0x02, 0x00, 0x82, 0xDB, 0xE0, 0x0A, 0x02, 0x00,
+    0x82, 0x50, 0x8F, 0x4F, 0x03, 0x00, 0x81, 0xE1, 0xEF, 0x04, 0x00, 0x81, 0xF9, 0x08, 0x18, 0x00,
+    0x08, 0x00, 0xAE, 0xF5, 0x04, 0x00, 0xF1, 0x0E, 0x00, 0x60, 0x3F, 0xF2, 0x07, 0x00, 0xE5, 0x2F,
+    0x00, 0xA0, 0x0E, 0xD0, 0x0B, 0x00, 0xB9, 0x6D, 0x00, 0xE0, 0x0A, 0x90, 0x0E, 0x00, 0x7C, 0xA9,
+    0x00, 0xF2, 0x07, 0x60, 0x3F, 0x10, 0x3F, 0xD6, 0x00, 0xF6, 0x03, 0x20, 0x7F, 0x50, 0x0E, 0xF2,
+    0x02, 0xE9, 0x02, 0x00, 0x85, 0xAD, 0x80, 0x0B, 0xE0, 0x06, 0xBD, 0x02, 0x00, 0x85, 0xEA, 0xC0,
+    0x08, 0xA0, 0x29, 0x7F, 0x02, 0x00, 0x85, 0xF6, 0xF3, 0x04, 0x70, 0x5D, 0x3F, 0x02, 0x00, 0x85,
+    0xF2, 0xFA, 0x01, 0x30, 0xAF, 0x0E, 0x02, 0x00, 0x81, 0xE0, 0xCF, 0x02, 0x00, 0x81, 0xFE, 0x0B,
+    0x02, 0x00, 0x81, 0xA0, 0x8F, 0x02, 0x00, 0x81, 0xFB, 0x07, 0x21, 0x00, 0x06, 0x00, 0x8E, 0xEA,
+    0x02, 0x00, 0xC0, 0x1D, 0x10, 0xAE, 0x00, 0x70, 0x3F, 0x00, 0x60, 0x5F, 0x20, 0x8F, 0x02, 0x00,
+    0x82, 0xB0, 0x1E, 0xDC, 0x03, 0x00, 0x82, 0xE2, 0xFD, 0x03, 0x03, 0x00, 0x81, 0xF7, 0x09, 0x03,
+    0x00, 0x82, 0xC0, 0xDF, 0x01, 0x02, 0x00, 0x82, 0x80, 0x6F, 0x8F, 0x02, 0x00, 0x83, 0x30, 0x8F,
+    0x70, 0x3F, 0x02, 0x00, 0x8B, 0xDC, 0x00, 0xC0, 0x0C, 0x00, 0xF8, 0x03, 0x00, 0xF3, 0x07, 0xF3,
+    0x08, 0x02, 0x00, 0x81, 0xF8, 0x03, 0x16, 0x00, 0x05, 0x00, 0x81, 0xB0, 0x1E, 0x02, 0x00, 0x82,
+    0xF3, 0x20, 0xAE, 0x02, 0x00, 0x8E, 0xCC, 0x00, 0xF6, 0x05, 0x80, 0x3F, 0x00, 0xB0, 0x1E, 0xF3,
+    0x08, 0x00, 0x20, 0x9E, 0xCC, 0x03, 0x00, 0x81, 0xF6, 0x3F, 0x03, 0x00, 0x81, 0xE0, 0x0B, 0x03,
+    0x00, 0x81, 0xE0, 0x0A, 0x03, 0x00, 0x81, 0xE0, 0x0A, 0x03, 0x00, 0x81, 0xE0, 0x0A, 0x03, 0x00,
+    0x81, 0xE0, 0x0A, 0x03, 0x00, 0x81, 0xE0, 0x0A, 0x15, 0x00, 0x05, 0x00, 0x80, 0x10, 0x04, 0xFF,
+    0x80, 0x1F, 0x03, 0x00, 0x81, 0x40, 0xDF, 0x03, 0x00, 0x82, 0x20, 0xEE, 0x03, 0x03, 0x00, 0x81,
+    0xFC, 0x06, 0x03, 0x00, 0x81, 0xF8, 0x09, 0x03, 0x00, 0x81, 0xF5, 0x1C, 0x03, 0x00, 0x81, 0xE2,
+    0x2E, 0x03, 0x00, 0x81, 0xC0, 0x5F, 0x03, 0x00, 0x81, 0x90, 0x9F, 0x03, 0x00, 0x81, 0x50, 0xCF,
+    0x03, 0x00, 0x82, 0x20, 0xEE, 0x02, 0x03, 0x00, 0x80, 0xF4, 0x04, 0xFF, 0x80, 0x04, 0x16, 0x00,
+    0x03, 0x00, 0xA9, 0x90, 0xFF, 0x0A, 0x90, 0x0C, 0x00, 0x90, 0x0C, 0x00, 0x90, 0x0C, 0x00, 0x90,
+    0x0C, 0x00, 0x90, 0x0C, 0x00, 0x90, 0x0C, 0x00, 0x90, 0x0C, 0x00, 0x90, 0x0C, 0x00, 0x90, 0x0C,
+    0x00, 0x90, 0x0C, 0x00, 0x90, 0x0C, 0x00, 0x90, 0x0C, 0x00, 0x90, 0xFF, 0x0A, 0x06, 0x00, 0x03,
+    0x00, 0x80, 0x7D, 0x02, 0x00, 0x80, 0xC8, 0x02, 0x00, 0x8A, 0xF3, 0x02, 0x00, 0xE0, 0x06, 0x00,
+    0x90, 0x0B, 0x00, 0x40, 0x1F, 0x02, 0x00, 0x80, 0x5E, 0x02, 0x00, 0x80, 0xAA, 0x02, 0x00, 0x80,
+    0xE5, 0x02, 0x00, 0x8A, 0xF1, 0x04, 0x00, 0xB0, 0x09, 0x00, 0x60, 0x0E, 0x00, 0x20, 0x3F, 0x09,
+    0x00, 0x03, 0x00, 0xA9, 0x70, 0xFF, 0x0D, 0x00, 0x90, 0x0D, 0x00, 0x90, 0x0D, 0x00, 0x90, 0x0D,
+    0x00, 0x90, 0x0D, 0x00, 0x90, 0x0D, 0x00, 0x90, 0x0D, 0x00, 0x90, 0x0D, 0x00, 0x90, 0x0D, 0x00,
+    0x90, 0x0D, 0x00, 0x90, 0x0D, 0x00, 0x90, 0x0D, 0x00, 0x90, 0x0D, 0x70, 0xFF, 0x0D, 0x06, 0x00,
+    0x09, 0x00, 0x81, 0xF9, 0x2D, 0x04, 0x00, 0x82, 0xE9, 0xC6, 0x3E, 0x03, 0x00, 0x8A, 0xDA, 0x03,
+    0xA0, 0x3E, 0x00, 0x10, 0xCB, 0x01, 0x00, 0x70, 0x4E, 0x4F, 0x00, 0x48, 0x00, 0x80, 0xF2, 0x03,
+    0xFF, 0x80, 0x0F, 0x81, 0x40, 0x4F, 0x03, 0x00, 0x81, 0xD6, 0x01, 0x02, 0x00, 0x81, 0x80, 0x0B,
+    0x39, 0x00, 0x14, 0x00, 0x83, 0x60, 0xFF, 0xDF, 0x2A, 0x03, 0x00, 0x81, 0x30, 0xCB, 0x04, 0x00,
+    0x9F, 0xF2, 0x03, 0x00, 0xD7, 0xFE, 0xFF, 0x05, 0x90, 0x4E, 0x01, 0xF2, 0x05, 0xE0, 0x08, 0x00,
+    0xF3, 0x05, 0xE0, 0x07, 0x00, 0xF9, 0x05, 0xA0, 0x3D, 0x61, 0xFA, 0x05, 0x10, 0xEA, 0x9E, 0xF2,
+    0x05, 0x14, 0x00, 0x05, 0x00, 0x81, 0x80, 0x0E, 0x03, 0x00, 0x81, 0x80, 0x0E, 0x03, 0x00, 0x81,
+    0x80, 0x0E, 0x03, 0x00, 0xAB, 0x80, 0x2E, 0xEB, 0x7D, 0x00, 0x80, 0xAE, 0x14, 0xF6, 0x06, 0x80,
+    0x5F, 0x00, 0x90, 0x0D, 0x80, 0x0F, 0x00, 0x50, 0x2F, 0x80, 0x0E, 0x00, 0x30, 0x4F, 0x80, 0x0F,
+    0x00, 0x50, 0x2F, 0x80, 0x5F, 0x00, 0x90, 0x0E, 0x80, 0xAE, 0x13, 0xF6, 0x06, 0x80, 0x2E, 0xEB,
+    0x7D, 0x15, 0x00, 0x13, 0x00, 0x89, 0xA3, 0xEE, 0x3B, 0x00, 0xE3, 0x2A, 0x41, 0x09, 0xB0, 0x0D,
+    0x03, 0x00, 0x80, 0x8F, 0x03, 0x00, 0x81, 0xF1, 0x07, 0x03, 0x00, 0x80, 0x8F, 0x03, 0x00, 0x81,
+    0xB0, 0x0D, 0x03, 0x00, 0x87, 0xE3, 0x2A, 0x41, 0x09, 0x00, 0xA3, 0xEE, 0x3B, 0x13, 0x00, 0x08,
+    0x00, 0x81, 0xB0, 0x0B, 0x03, 0x00, 0x81, 0xB0, 0x0B, 0x03, 0x00, 0xAE, 0xB0, 0x0B, 0x00, 0xD5,
+    0xCF, 0xB3, 0x0B, 0x40, 0x8F, 0x31, 0xCB, 0x0B, 0xB0, 0x0C, 0x00, 0xF2, 0x0B, 0xF0, 0x07, 0x00,
+    0xD0, 0x0B, 0xF1, 0x06, 0x00, 0xB0, 0x0B, 0xF0, 0x07, 0x00, 0xD0, 0x0B, 0xB0, 0x0B, 0x00, 0xF2,
+    0x0B, 0x40, 0x8F, 0x21, 0xCA, 0x0B, 0x00, 0xD5, 0xCF, 0xB3, 0x0B, 0x14, 0x00, 0x15, 0x00, 0x93,
+    0xA3, 0xFE, 0x4C, 0x00, 0x30, 0xAE, 0x12, 0xF7, 0x03, 0xB0, 0x0D, 0x00, 0xB0, 0x0A, 0xF0, 0x08,
+    0x00, 0x80, 0x0E, 0xF1, 0x03, 0xFF, 0x82, 0x0F, 0xF0, 0x07, 0x03, 0x00, 0x81, 0xB0, 0x0C, 0x03,
+    0x00, 0x89, 0x30, 0xAE, 0x12, 0x72, 0x08, 0x00, 0xA2, 0xFE, 0x8D, 0x02, 0x14, 0x00, 0x04, 0x00,
+    0xA1, 0xD6, 0xEF, 0x10, 0x7F, 0x00, 0x40, 0x3F, 0x00, 0xF9, 0xFF, 0x8F, 0x40, 0x3F, 0x00, 0x40,
+    0x3F, 0x00, 0x40, 0x3F, 0x00, 0x40, 0x3F, 0x00, 0x40, 0x3F, 0x00, 0x40, 0x3F, 0x00, 0x40, 0x3F,
+    0x00, 0x40, 0x3F, 0x0D, 0x00, 0x15, 0x00, 0xAB, 0xD5, 0xCF, 0xB3, 0x0B, 0x40, 0x8F, 0x21, 0xCA,
+    0x0B, 0xB0, 0x0B, 0x00, 0xF2, 0x0B, 0xF0, 0x07, 0x00, 0xD0, 0x0B, 0xF1, 0x06, 0x00, 0xB0, 0x0B,
+    0xF0, 0x07, 0x00, 0xD0, 0x0B, 0xB0, 0x0B, 0x00, 0xF2, 0x0B, 0x40, 0x7F, 0x21, 0xCA, 0x0B, 0x00,
+    0xD5, 0xCF, 0xC3, 0x0A, 0x03, 0x00, 0x8A, 0xE1, 0x08, 0x10, 0x39, 0x21, 0xEA, 0x02, 0x00, 0xC6,
+    0xEE, 0x3B, 0x06, 0x00, 0x05, 0x00, 0x81, 0x80, 0x0E, 0x03, 0x00, 0x81, 0x80, 0x0E, 0x03, 0x00,
+    0x81, 0x80, 0x0E, 0x03, 0x00, 0xAC, 0x80, 0x1E, 0xEA, 0x6D, 0x00, 0x80, 0xAE, 0x14, 0xF7, 0x03,
+    0x80, 0x4F, 0x00, 0xD0, 0x09, 0x80, 0x0F, 0x00, 0xB0, 0x0B, 0x80, 0x0E, 0x00, 0xA0, 0x0C, 0x80,
+    0x0E, 0x00, 0xA0, 0x0C, 0x80, 0x0E, 0x00, 0xA0, 0x0C, 0x80, 0x0E, 0x00, 0xA0, 0x0C, 0x80, 0x0E,
+    0x00, 0xA0, 0x0C, 0x14, 0x00, 0x02, 0x00, 0x83, 0x70, 0x0E, 0x70, 0x0E, 0x02, 0x00, 0x91, 0x70,
+    0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70,
+    0x0E, 0x08, 0x00, 0x03, 0x00, 0x82, 0xE7, 0x00, 0xE7, 0x03, 0x00, 0x96, 0xE7, 0x00, 0xE7, 0x00,
+    0xE7, 0x00, 0xE7, 0x00, 0xE7, 0x00, 0xE7, 0x00, 0xE7, 0x00, 0xE7, 0x00, 0xE7, 0x00, 0xD8, 0x10,
+    0xAC, 0xE4, 0x2B, 0x02, 0x00, 0x05, 0x00, 0x81, 0x80, 0x0E, 0x03, 0x00, 0x81, 0x80, 0x0E, 0x03,
+    0x00, 0x81, 0x80, 0x0E, 0x03, 0x00, 0x91, 0x80, 0x0E, 0x00, 0xF6, 0x07, 0x80, 0x0E, 0x70, 0x6F,
+    0x00, 0x80, 0x0E, 0xE8, 0x05, 0x00, 0x80, 0xAE, 0x4E, 0x02, 0x00, 0x82, 0x80, 0xEF, 0x0B, 0x02,
+    0x00, 0x82, 0x80, 0x4E, 0xAE, 0x02, 0x00, 0x8E, 0x80, 0x0E, 0xE4, 0x0A, 0x00, 0x80, 0x0E, 0x30,
+    0xAE, 0x00, 0x80, 0x0E, 0x00, 0xE3, 0x0A, 0x14, 0x00, 0x02, 0x00, 0x97, 0x70, 0x0E, 0x70, 0x0E,
+    0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E,
+    0x70, 0x0E, 0x70, 0x0E, 0x08, 0x00, 0x20, 0x00, 0xC7, 0x80, 0x1E, 0xEB, 0x4D, 0x40, 0xFC, 0x2B,
+    0x00, 0x80, 0xAE, 0x13, 0xE9, 0x94, 0x22, 0xAD, 0x00, 0x80, 0x4F, 0x00, 0xF1, 0x0D, 0x00, 0xF6,
+    0x01, 0x80, 0x0F, 0x00, 0xE0, 0x0A, 0x00, 0xF4, 0x03, 0x80, 0x0E, 0x00, 0xD0, 0x09, 0x00, 0xF3,
+    0x04, 0x80, 0x0E, 0x00, 0xD0, 0x08, 0x00, 0xF3, 0x04, 0x80, 0x0E, 0x00, 0xD0, 0x08, 0x00, 0xF3,
+    0x04, 0x80, 0x0E, 0x00, 0xD0, 0x08, 0x00, 0xF3, 0x04, 0x80, 0x0E, 0x00, 0xD0, 0x08, 0x00, 0xF3,
+    0x04, 0x20, 0x00, 0x14, 0x00, 0xAC, 0x80, 0x1E, 0xEA, 0x6D, 0x00, 0x80, 0xAE, 0x14, 0xF7, 0x03,
+    0x80, 0x4F, 0x00, 0xD0, 0x09, 0x80, 0x0F, 0x00, 0xB0, 0x0B, 0x80, 0x0E, 0x00, 0xA0, 0x0C, 0x80,
+    0x0E, 0x00, 0xA0, 0x0C, 0x80, 0x0E, 0x00, 0xA0, 0x0C, 0x80, 0x0E, 0x00, 0xA0, 0x0C, 0x80, 0x0E,
+    0x00, 0xA0, 0x0C, 0x14, 0x00, 0x15, 0x00, 0xAA, 0xC4, 0xEE, 0x2A, 0x00, 0x40, 0x9F, 0x21, 0xEB,
+    0x02, 0xC0, 0x0C, 0x00, 0xE1, 0x09, 0xF0, 0x08, 0x00, 0xB0, 0x0C, 0xF1, 0x07, 0x00, 0xA0, 0x0E,
+    0xF0, 0x08, 0x00, 0xB0, 0x0C, 0xC0, 0x0C, 0x00, 0xE1, 0x09, 0x40, 0x8F, 0x21, 0xEB, 0x02, 0x00,
+    0xC4, 0xEF, 0x2B, 0x15, 0x00, 0x14, 0x00, 0xAE, 0x80, 0x2E, 0xEB, 0x7D, 0x00, 0x80, 0xAE, 0x14,
+    0xF6, 0x06, 0x80, 0x5F, 0x00, 0x90, 0x0D, 0x80, 0x0F, 0x00, 0x50, 0x2F, 0x80, 0x0E, 0x00, 0x30,
+    0x4F, 0x80, 0x0F, 0x00, 0x50, 0x2F, 0x80, 0x5F, 0x00, 0x90, 0x0E, 0x80, 0xAE, 0x13, 0xF6, 0x06,
+    0x80, 0x2E, 0xEB, 0x7D, 0x00, 0x80, 0x0E, 0x03, 0x00, 0x81, 0x80, 0x0E, 0x03, 0x00, 0x81, 0x80,
+    0x0E, 0x08, 0x00, 0x15, 0x00, 0xAB, 0xD5, 0xCF, 0xB3, 0x0B, 0x40, 0x8F, 0x31, 0xCB, 0x0B, 0xB0,
+    0x0C, 0x00, 0xF2, 0x0B, 0xF0, 0x07, 0x00, 0xD0, 0x0B, 0xF1, 0x06, 0x00, 0xB0, 0x0B, 0xF0, 0x07,
+    0x00, 0xD0, 0x0B, 0xB0, 0x0B, 0x00, 0xF2, 0x0B, 0x40, 0x8F, 0x21, 0xCA, 0x0B, 0x00, 0xD5, 0xCF,
+    0xB3, 0x0B, 0x03, 0x00, 0x81, 0xB0, 0x0B, 0x03, 0x00, 0x81, 0xB0, 0x0B, 0x03, 0x00, 0x81, 0xB0,
+    0x0B, 0x05, 0x00, 0x0E, 0x00, 0x88, 0x80, 0x1E, 0xEA, 0x09, 0xE8, 0x4A, 0x00, 0x80, 0x5F, 0x02,
+    0x00, 0x80, 0xF8, 0x02, 0x00, 0x81, 0x80, 0x0E, 0x02, 0x00, 0x80, 0xE8, 0x02, 0x00, 0x81, 0x80,
+    0x0E, 0x02, 0x00, 0x80, 0xE8, 0x02, 0x00, 0x81, 0x80, 0x0E, 0x10, 0x00, 0x10, 0x00, 0x89, 0x20,
+    0xEA, 0xCE, 0x05, 0xC0, 0x2B, 0x31, 0x1A, 0xF0, 0x06, 0x02, 0x00, 0x8B, 0xD0, 0x5D, 0x01, 0x00,
+    0x20, 0xFB, 0xCF, 0x05, 0x00, 0x10, 0xA4, 0x4F, 0x03, 0x00, 0x88, 0x8F, 0xA2, 0x14, 0x61, 0x4F,
+    0x40, 0xEB, 0xCE, 0x05, 0x10, 0x00, 0x06, 0x00, 0x9C, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0xF8,
+    0xFF, 0xDF, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E,
+    0x00, 0x70, 0x0E, 0x00, 0x50, 0x4F, 0x02, 0x00, 0x81, 0xE9, 0xDF, 0x0C, 0x00, 0x14, 0x00, 0xAC,
+    0xA0, 0x0C, 0x00, 0xB0, 0x0A, 0xA0, 0x0C, 0x00, 0xB0, 0x0A, 0xA0, 0x0C, 0x00, 0xB0, 0x0A, 0xA0,
+    0x0C, 0x00, 0xB0, 0x0A, 0xA0, 0x0C, 0x00, 0xB0, 0x0A, 0x90, 0x0D, 0x00, 0xD0, 0x0A, 0x70, 0x1E,
+    0x00, 0xF2, 0x0A, 0x20, 0x9F, 0x31, 0xCA, 0x0A, 0x00, 0xD5, 0xBF, 0xB2, 0x0A, 0x14, 0x00, 0x12,
+    0x00, 0x9E, 0xF5, 0x03, 0x00, 0xB0, 0x0C, 0x8E, 0x00, 0x10, 0x7F, 0x90, 0x0D, 0x00, 0xF7, 0x01,
+    0xF4, 0x04, 0xC0, 0x0B, 0x00, 0x9D, 0x20, 0x5F, 0x00, 0x80, 0x1E, 0xE8, 0x01, 0x00, 0xF2, 0xD5,
+    0x09, 0x02, 0x00, 0x81, 0xDC, 0x4F, 0x02, 0x00, 0x81, 0x60, 0xDF, 0x14, 0x00, 0x1A, 0x00, 0xB2,
+    0xF3, 0x04, 0x60, 0x8F, 0x00, 0xF2, 0x04, 0x7E, 0x00, 0xEA, 0x0C, 0x60, 0x1F, 0xA0, 0x0B, 0xE0,
+    0xF8, 0x01, 0xCA, 0x00, 0xF7, 0x30, 0x1F, 0x4E, 0xE0, 0x08, 0x30, 0x4F, 0xC7, 0xB0, 0x38, 0x4F,
+    0x00, 0xE0, 0xB8, 0x08, 0xC7, 0xF6, 0x01, 0x00, 0xCA, 0x4E, 0x30, 0xBF, 0x0B, 0x00, 0x60, 0xFF,
+    0x01, 0xE0, 0x8F, 0x02, 0x00, 0x84, 0xF2, 0x0C, 0x00, 0xFA, 0x04, 0x1B, 0x00, 0x12, 0x00, 0x8C,
+    0xD1, 0x0C, 0x00, 0xF4, 0x06, 0xF3, 0x08, 0xE1, 0x0A, 0x00, 0xF7, 0xB4, 0x1D, 0x02, 0x00, 0x81,
+    0xFB, 0x4F, 0x02, 0x00, 0x81, 0x50, 0xCF, 0x02, 0x00, 0x82, 0x10, 0xCE, 0x7F, 0x02, 0x00, 0x8C,
+    0xDB, 0x81, 0x3F, 0x00, 0xF7, 0x04, 0xC0, 0x1D, 0xF3, 0x08, 0x00, 0xE2, 0x09, 0x12, 0x00, 0x12,
+    0x00, 0x99, 0xF5, 0x03, 0x00, 0xB0, 0x0C, 0x9E, 0x00, 0x20, 0x6F, 0x80, 0x0E, 0x00, 0xE8, 0x01,
+    0xF2, 0x05, 0xD0, 0x09, 0x00, 0xBB, 0x40, 0x3F, 0x00, 0x50, 0x2F, 0xCA, 0x02, 0x00, 0x82, 0xD0,
+    0xF9, 0x06, 0x02, 0x00, 0x81, 0xF8, 0x1E, 0x02, 0x00, 0x81, 0x20, 0x9F, 0x03, 0x00, 0x81, 0xF4,
+    0x03, 0x02, 0x00, 0x81, 0xC1, 0x0B, 0x02, 0x00, 0x81, 0xFB, 0x2C, 0x07, 0x00, 0x10, 0x00, 0x80,
+    0xF2, 0x02, 0xFF, 0x80, 0xBF, 0x02, 0x00, 0x81, 0x50, 0x8F, 0x02, 0x00, 0x88, 0xE3, 0x0C, 0x00,
+    0x10, 0xDD, 0x01, 0x00, 0xB0, 0x3E, 0x02, 0x00, 0x84, 0xF9, 0x05, 0x00, 0x60, 0x8F, 0x02, 0x00,
+    0x81, 0xF3, 0x0B, 0x02, 0x00, 0x80, 0xF5, 0x02, 0xFF, 0x80, 0xBF, 0x10, 0x00, 0x07, 0x00, 0x82,
+    0x91, 0xFE, 0x03, 0x02, 0x00, 0x81, 0xF6, 0x04, 0x03, 0x00, 0x80, 0xE8, 0x04, 0x00, 0x80, 0xD8,
+    0x04, 0x00, 0x80, 0xD8, 0x04, 0x00, 0x80, 0xCA, 0x03, 0x00, 0x81, 0x30, 0x9E, 0x03, 0x00, 0x81,
+    0xFF, 0x1C, 0x03, 0x00, 0x81, 0x30, 0x9E, 0x04, 0x00, 0x80, 0xC9, 0x04, 0x00, 0x80, 0xD8, 0x04,
+    0x00, 0x80, 0xD8, 0x04, 0x00, 0x80, 0xE8, 0x04, 0x00, 0x81, 0xF6, 0x04, 0x03, 0x00, 0x82, 0xA1,
+    0xFE, 0x03, 0x05, 0x00, 0x03, 0x00, 0xA7, 0xF0, 0x05, 0x00, 0x5F, 0x00, 0xF0, 0x05, 0x00, 0x5F,
+    0x00, 0xF0, 0x05, 0x00, 0x5F, 0x00, 0xF0, 0x05, 0x00, 0x5F, 0x00, 0xF0, 0x05, 0x00, 0x5F, 0x00,
+    0xF0, 0x05, 0x00, 0x5F, 0x00, 0xF0, 0x05, 0x00, 0x5F, 0x00, 0xF0, 0x05, 0x00, 0x5F, 0x00, 0x06,
+    0x00, 0x81, 0xEF, 0x2B, 0x03, 0x00, 0x81, 0x20, 0x9E, 0x04, 0x00, 0x80, 0xBB, 0x04, 0x00, 0x80,
+    0xBA, 0x04, 0x00, 0x80, 0xBA, 0x04, 0x00, 0x80, 0xCA, 0x04, 0x00, 0x81, 0xF6, 0x05, 0x03, 0x00,
+    0x82, 0xA0, 0xFF, 0x03, 0x02, 0x00, 0x81, 0xF6, 0x04, 0x03, 0x00, 0x80, 0xCA, 0x04, 0x00, 0x80,
+    0xBA, 0x04, 0x00, 0x80, 0xBA, 0x04, 0x00, 0x80, 0xBB, 0x03, 0x00, 0x81, 0x20, 0x9E, 0x03, 0x00,
+    0x81, 0xEF, 0x2B, 0x07, 0x00, 0x2E, 0x00, 0x8D, 0x70, 0xEC, 0x9D, 0x14, 0x61, 0x0A, 0x40, 0x3A,
+    0x30, 0xC7, 0xDE, 0x2A, 0x00, 0x01, 0x33, 0x00, 0x05, 0x00, 0x91, 0xE6, 0x6D, 0x00, 0x30, 0x2D,
+    0xD2, 0x03, 0x60, 0x08, 0x80, 0x07, 0x30, 0x2D, 0xD2, 0x04, 0x00, 0xE7, 0x7E, 0x2D, 0x00, 0x16,
+    0x00, 0x81, 0xE0, 0x05, 0x05, 0x00, 0x80, 0x5E, 0x05, 0x00, 0x81, 0xE0, 0x05, 0x02, 0x00, 0x80,
+    0x40, 0x04, 0xFF, 0x80, 0xBF, 0x03, 0x00, 0x81, 0xE0, 0x05, 0x05, 0x00, 0x80, 0x5E, 0x05, 0x00,
+    0x81, 0xE0, 0x05, 0x0F, 0x00, 0x80, 0x40, 0x04, 0xFF, 0x80, 0xBF, 0x1B, 0x00, 0x14, 0x00, 0xAE,
+    0xA0, 0x0C, 0x00, 0xB0, 0x0A, 0xA0, 0x0C, 0x00, 0xB0, 0x0A, 0xA0, 0x0C, 0x00, 0xB0, 0x0A, 0xA0,
+    0x0C, 0x00, 0xB0, 0x0A, 0xA0, 0x0C, 0x00, 0xB0, 0x0A, 0xA0, 0x0C, 0x00, 0xC0, 0x0A, 0xA0, 0x0E,
+    0x00, 0xE0, 0x0A, 0xA0, 0x7F, 0x11, 0xF8, 0x0C, 0xA0, 0x9C, 0xEE, 0x69, 0xAE, 0xA0, 0x0C, 0x03,
+    0x00, 0x81, 0xA0, 0x0C, 0x03, 0x00, 0x81, 0xA0, 0x0C, 0x08, 0x00,
+};
+// clang-format on
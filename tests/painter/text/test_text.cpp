@@ -0,0 +1,165 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "../painter_test_surface.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal_driver.h"
+#include "qp_surface.h"
+#include "dejavusans16.qff.h"
+#include "cjk16.qff.h"
+}
+
+#define PANEL_SIZE 240
+
+static uint8_t surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_SIZE, PANEL_SIZE, 16)];
+
+static const char *ascii_text   = "Hello, World! 0123456789";
+static const char *units_text   = "Temp: 21.5°C ±0.5 µs";
+static const char *cjk_text     = u8"\u4E00\u4E8C\u4E09\u4F60\u4E2D\u4FFF\u4F5C\u4E01";
+static const char *missing_text = u8"\u4E00\u5000";
+
+class DrawText : public testing::Test {
+   protected:
+    surface_painter_device_t surface_device;
+    painter_device_t         surface;
+    painter_font_handle_t    ascii_font;
+    painter_font_handle_t    cjk_font;
+
+    void SetUp() override {
+        memset(surface_buffer, 0, sizeof(surface_buffer));
+        surface = make_test_rgb565_surface(&surface_device, PANEL_SIZE, PANEL_SIZE, surface_buffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        ascii_font = qp_load_font_mem(font_dejavusans16);
+        cjk_font   = qp_load_font_mem(font_cjk16);
+        ASSERT_NE(ascii_font, nullptr);
+        ASSERT_NE(cjk_font, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_font(ascii_font);
+        qp_close_font(cjk_font);
+    }
+
+    static uint32_t surface_hash(void) {
+        // FNV-1a
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < sizeof(surface_buffer); ++i) {
+            hash = (hash ^ surface_buffer[i]) * 16777619u;
+        }
+        return hash;
+    }
+};
+
+/* Renders a fixed set of strings, checking against the output of the original linear glyph lookup. */
+TEST_F(DrawText, RenderMatchesReference) {
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, ascii_font, ascii_text), qp_textwidth(ascii_font, ascii_text));
+    EXPECT_GT(qp_drawtext_recolor(surface, 3, 20, ascii_font, units_text, 0, 255, 255, 170, 255, 64), 0);
+    EXPECT_GT(qp_drawtext(surface, 5, 40, cjk_font, cjk_text), 0);
+    EXPECT_GT(qp_drawtext_recolor(surface, 9, 60, cjk_font, cjk_text, 85, 255, 255, 0, 0, 0), 0);
+    EXPECT_EQ(surface_hash(), 0x7123e902u);
+}
+
+TEST_F(DrawText, TextWidth) {
+    EXPECT_EQ(qp_textwidth(ascii_font, ascii_text), 208);
+    EXPECT_EQ(qp_textwidth(ascii_font, units_text), 176);
+    EXPECT_EQ(qp_textwidth(cjk_font, cjk_text), 8 * 16);
+}
+
+/* Renders the same strings as text runs, which must match the direct rendering. */
+TEST_F(DrawText, RunMatchesReference) {
+    painter_text_run_t ascii_run, units_run, cjk_run;
+    EXPECT_EQ(qp_layout_text(&ascii_run, ascii_font, ascii_text), 208);
+    EXPECT_EQ(qp_layout_text(&units_run, ascii_font, units_text), 176);
+    EXPECT_EQ(qp_layout_text(&cjk_run, cjk_font, cjk_text), 8 * 16);
+    EXPECT_EQ(cjk_run.glyph_count, 8);
+
+    EXPECT_EQ(qp_drawtext_run(surface, 0, 0, &ascii_run), 208);
+    EXPECT_GT(qp_drawtext_run_recolor(surface, 3, 20, &units_run, 0, 255, 255, 170, 255, 64), 0);
+    EXPECT_GT(qp_drawtext_run(surface, 5, 40, &cjk_run), 0);
+    EXPECT_GT(qp_drawtext_run_recolor(surface, 9, 60, &cjk_run, 85, 255, 255, 0, 0, 0), 0);
+    EXPECT_EQ(surface_hash(), 0x7123e902u);
+}
+
+TEST_F(DrawText, RunLayoutFails) {
+    painter_text_run_t run;
+    char               too_long[QUANTUM_PAINTER_TEXT_RUN_MAX_GLYPHS + 2];
+    memset(too_long, 'x', sizeof(too_long) - 1);
+    too_long[sizeof(too_long) - 1] = 0;
+    EXPECT_EQ(qp_layout_text(&run, ascii_font, too_long), 0);
+    EXPECT_EQ(run.glyph_count, 0);
+
+    too_long[QUANTUM_PAINTER_TEXT_RUN_MAX_GLYPHS] = 0;
+    EXPECT_GT(qp_layout_text(&run, ascii_font, too_long), 0);
+    EXPECT_EQ(run.glyph_count, QUANTUM_PAINTER_TEXT_RUN_MAX_GLYPHS);
+
+    EXPECT_EQ(qp_layout_text(&run, cjk_font, missing_text), 0);
+    EXPECT_EQ(run.glyph_count, 0);
+}
+
+TEST_F(DrawText, MissingGlyphFails) {
+    EXPECT_EQ(qp_textwidth(cjk_font, missing_text), 0);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, cjk_font, missing_text), 0);
+    EXPECT_EQ(qp_textwidth(ascii_font, u8"\u4E00"), 0);
+}
+
+/* A dashboard redrawing three numeric fields, and a line of CJK text, reporting the time taken per redraw. */
+TEST_F(DrawText, Benchmark) {
+    const int          iterations = 2000;
+    char               fields[3][16];
+    const char *       cjk_fields[1] = {cjk_text};
+    painter_text_run_t runs[3];
+
+    auto time_loop = [&](const char *name, auto &&redraw) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            redraw();
+        }
+        double elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        std::cout << name << ": " << elapsed / iterations << "us per redraw" << std::endl;
+    };
+
+    snprintf(fields[0], sizeof(fields[0]), "%5.1f ms", 12.3);
+    snprintf(fields[1], sizeof(fields[1]), "%3d%%", 87);
+    snprintf(fields[2], sizeof(fields[2]), "%02d:%02d:%02d", 12, 34, 56);
+    const char *ascii_fields[3] = {fields[0], fields[1], fields[2]};
+
+    auto draw_fields = [&](painter_font_handle_t font, const char *const *strs, int count) {
+        return [=]() {
+            for (int f = 0; f < count; ++f) {
+                qp_drawtext(surface, 0, f * 20, font, strs[f]);
+            }
+        };
+    };
+    auto draw_runs = [&](int count) {
+        return [=, &runs]() {
+            for (int f = 0; f < count; ++f) {
+                qp_drawtext_run(surface, 0, f * 20, &runs[f]);
+            }
+        };
+    };
+    auto measure_fields = [&](painter_font_handle_t font, const char *const *strs, int count) {
+        return [=]() {
+            for (int f = 0; f < count; ++f) {
+                qp_textwidth(font, strs[f]);
+            }
+        };
+    };
+
+    time_loop("ascii dashboard", draw_fields(ascii_font, ascii_fields, 3));
+    time_loop("ascii dashboard textwidth", measure_fields(ascii_font, ascii_fields, 3));
+    for (int f = 0; f < 3; ++f) {
+        ASSERT_GT(qp_layout_text(&runs[f], ascii_font, ascii_fields[f]), 0);
+    }
+    time_loop("ascii dashboard run", draw_runs(3));
+
+    time_loop("cjk line", draw_fields(cjk_font, cjk_fields, 1));
+    time_loop("cjk line textwidth", measure_fields(cjk_font, cjk_fields, 1));
+    ASSERT_GT(qp_layout_text(&runs[0], cjk_font, cjk_text), 0);
+    time_loop("cjk line run", draw_runs(1));
+}
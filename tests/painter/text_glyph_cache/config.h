@@ -0,0 +1,8 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../text/config.h"
+
+#define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 32
@@ -0,0 +1,147 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#endif
+extern "C" {
+#include "quantum.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class ProcessRecordDispatch : public TestFixture {};
+
+TEST_F(ProcessRecordDispatch, BasicKeyPassesEveryHandler) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, AnyKeyHandlersObserveBasicKeys) {
+    TestDriver driver;
+    auto       caps_word = KeymapKey(0, 0, 0, QK_CAPS_WORD_TOGGLE);
+    auto       key_a     = KeymapKey(0, 1, 0, KC_A);
+    auto       key_space = KeymapKey(0, 2, 0, KC_SPC);
+    auto       repeat    = KeymapKey(0, 3, 0, QK_REPEAT_KEY);
+
+    set_keymap({caps_word, key_a, key_space, repeat});
+
+    // Caps Word stays on through letters and ends on space
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(caps_word);
+    EXPECT_TRUE(is_caps_word_on());
+    tap_key(key_a);
+    EXPECT_TRUE(is_caps_word_on());
+    tap_key(key_space);
+    EXPECT_FALSE(is_caps_word_on());
+    VERIFY_AND_CLEAR(driver);
+
+    // Repeat Key repeats the last basic key
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_keys(key_a, repeat);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, RangeHandlersStillHandleTheirKeycodes) {
+    TestDriver driver;
+    auto       grave_esc = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+    auto       lower     = KeymapKey(0, 1, 0, QK_TRI_LAYER_LOWER);
+    auto       dt_up     = KeymapKey(0, 2, 0, QK_DYNAMIC_TAPPING_TERM_UP);
+
+    set_keymap({grave_esc, lower, dt_up, KeymapKey{1, 1, 0, KC_TRNS}});
+
+    EXPECT_REPORT(driver, (KC_ESC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(grave_esc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    lower.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+    lower.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+    VERIFY_AND_CLEAR(driver);
+
+    const uint16_t tapping_term = g_tapping_term;
+    EXPECT_NO_REPORT(driver);
+    tap_key(dt_up);
+    EXPECT_EQ(g_tapping_term, tapping_term + DYNAMIC_TAPPING_TERM_INCREMENT);
+    VERIFY_AND_CLEAR(driver);
+    g_tapping_term = tapping_term;
+}
+
+TEST_F(ProcessRecordDispatch, KeycodesNextToARangeAreNotCaptured) {
+    TestDriver driver;
+    // The keycodes just below and above the tri layer keys
+    auto before = KeymapKey(0, 0, 0, QK_TRI_LAYER_LOWER - 1);
+    auto after  = KeymapKey(0, 1, 0, QK_TRI_LAYER_UPPER + 1);
+
+    set_keymap({before, after});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(before);
+    tap_key(after);
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+    EXPECT_FALSE(layer_state_is(get_tri_layer_upper_layer()));
+    VERIFY_AND_CLEAR(driver);
+}
+
+static inline uint64_t read_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+class ProcessRecordDispatchBenchmark : public TestFixture, public testing::WithParamInterface<uint16_t> {};
+
+TEST_P(ProcessRecordDispatchBenchmark, events) {
+    TestDriver     driver;
+    const uint16_t keycode    = GetParam();
+    const int      iterations = 100000;
+    keyrecord_t    record     = {};
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    record.event.type = KEY_EVENT;
+    uint64_t cycles   = 0;
+    for (int i = 0; i < iterations; i++) {
+        record.event.pressed = !(i & 1);
+        record.event.time    = timer_read();
+
+        uint64_t start = read_cycles();
+        process_record_quantum_helper(keycode, &record);
+        cycles += read_cycles() - start;
+    }
+    clear_keyboard();
+
+    std::cout << "keycode 0x" << std::hex << keycode << std::dec << ": " << (double)cycles / iterations << " cycles per event" << std::endl;
+    VERIFY_AND_CLEAR(driver);
+}
+
+INSTANTIATE_TEST_CASE_P(Keycodes, ProcessRecordDispatchBenchmark, testing::Values(KC_A, KC_LSFT, QK_USER_0));
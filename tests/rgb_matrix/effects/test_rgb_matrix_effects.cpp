@@ -0,0 +1,97 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iomanip>
+#include "gtest/gtest.h"
+#include "../rgb_matrix_test_fixture.hpp"
+
+#ifdef RGB_MATRIX_EFFECT_VIALRGB_DIRECT
+/* Normally owned by vialrgb.c, which the Vial host writes into */
+extern "C" HSV g_direct_mode_colors[RGB_MATRIX_LED_COUNT];
+HSV            g_direct_mode_colors[RGB_MATRIX_LED_COUNT];
+#endif
+
+class RgbMatrixEffects : public RgbMatrixTest {
+   public:
+    void SetUp() override {
+#ifdef RGB_MATRIX_EFFECT_VIALRGB_DIRECT
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            g_direct_mode_colors[i] = HSV{(uint8_t)(i * 2), (uint8_t)(255 - i), 200};
+        }
+#endif
+    }
+};
+
+struct EffectGolden {
+    uint8_t     mode;
+    const char *name;
+    uint32_t    hash;
+};
+
+/* Frame hashes recorded before the runners used cached LED geometry. */
+static const EffectGolden goldens[] = {
+    {RGB_MATRIX_SOLID_COLOR, "SOLID_COLOR", 0xbe22089a},
+    {RGB_MATRIX_ALPHAS_MODS, "ALPHAS_MODS", 0xbe22089a},
+    {RGB_MATRIX_GRADIENT_UP_DOWN, "GRADIENT_UP_DOWN", 0x4e573e26},
+    {RGB_MATRIX_GRADIENT_LEFT_RIGHT, "GRADIENT_LEFT_RIGHT", 0xf20ec5e6},
+    {RGB_MATRIX_BREATHING, "BREATHING", 0x980452ea},
+    {RGB_MATRIX_BAND_SAT, "BAND_SAT", 0x07de18ae},
+    {RGB_MATRIX_BAND_VAL, "BAND_VAL", 0x6c569cde},
+    {RGB_MATRIX_BAND_PINWHEEL_SAT, "BAND_PINWHEEL_SAT", 0xbb56abef},
+    {RGB_MATRIX_BAND_PINWHEEL_VAL, "BAND_PINWHEEL_VAL", 0x100061d9},
+    {RGB_MATRIX_BAND_SPIRAL_SAT, "BAND_SPIRAL_SAT", 0x82752a81},
+    {RGB_MATRIX_BAND_SPIRAL_VAL, "BAND_SPIRAL_VAL", 0xdbd79277},
+    {RGB_MATRIX_CYCLE_ALL, "CYCLE_ALL", 0x82ebe7a2},
+    {RGB_MATRIX_CYCLE_LEFT_RIGHT, "CYCLE_LEFT_RIGHT", 0xf7f154b2},
+    {RGB_MATRIX_CYCLE_UP_DOWN, "CYCLE_UP_DOWN", 0x1f4cfbc2},
+    {RGB_MATRIX_RAINBOW_MOVING_CHEVRON, "RAINBOW_MOVING_CHEVRON", 0x53cdf56d},
+    {RGB_MATRIX_CYCLE_OUT_IN, "CYCLE_OUT_IN", 0x6cbc302d},
+    {RGB_MATRIX_CYCLE_OUT_IN_DUAL, "CYCLE_OUT_IN_DUAL", 0x7d09e017},
+    {RGB_MATRIX_CYCLE_PINWHEEL, "CYCLE_PINWHEEL", 0x336c048e},
+    {RGB_MATRIX_CYCLE_SPIRAL, "CYCLE_SPIRAL", 0x41d85eef},
+    {RGB_MATRIX_DUAL_BEACON, "DUAL_BEACON", 0x2dc8fe74},
+    {RGB_MATRIX_RAINBOW_BEACON, "RAINBOW_BEACON", 0x3d474954},
+    {RGB_MATRIX_RAINBOW_PINWHEELS, "RAINBOW_PINWHEELS", 0x72d47fae},
+    {RGB_MATRIX_FLOWER_BLOOMING, "FLOWER_BLOOMING", 0xad60056a},
+    {RGB_MATRIX_RAINDROPS, "RAINDROPS", 0xc848d030},
+    {RGB_MATRIX_JELLYBEAN_RAINDROPS, "JELLYBEAN_RAINDROPS", 0xef917094},
+    {RGB_MATRIX_HUE_BREATHING, "HUE_BREATHING", 0x81d11b32},
+    {RGB_MATRIX_HUE_PENDULUM, "HUE_PENDULUM", 0x38d1ec3a},
+    {RGB_MATRIX_HUE_WAVE, "HUE_WAVE", 0x49ba463a},
+    {RGB_MATRIX_PIXEL_RAIN, "PIXEL_RAIN", 0x37bfb6ba},
+    {RGB_MATRIX_PIXEL_FLOW, "PIXEL_FLOW", 0x3870821a},
+    {RGB_MATRIX_PIXEL_FRACTAL, "PIXEL_FRACTAL", 0xeac93a1a},
+    {RGB_MATRIX_TYPING_HEATMAP, "TYPING_HEATMAP", 0x59e5a625},
+    {RGB_MATRIX_DIGITAL_RAIN, "DIGITAL_RAIN", 0x34bc3985},
+    {RGB_MATRIX_SOLID_REACTIVE_SIMPLE, "SOLID_REACTIVE_SIMPLE", 0x45aed9ab},
+    {RGB_MATRIX_SOLID_REACTIVE, "SOLID_REACTIVE", 0x1f501942},
+    {RGB_MATRIX_SOLID_REACTIVE_WIDE, "SOLID_REACTIVE_WIDE", 0x586307c9},
+    {RGB_MATRIX_SOLID_REACTIVE_MULTIWIDE, "SOLID_REACTIVE_MULTIWIDE", 0xd97a6ed7},
+    {RGB_MATRIX_SOLID_REACTIVE_CROSS, "SOLID_REACTIVE_CROSS", 0x607fbaa1},
+    {RGB_MATRIX_SOLID_REACTIVE_MULTICROSS, "SOLID_REACTIVE_MULTICROSS", 0xf3d58b35},
+    {RGB_MATRIX_SOLID_REACTIVE_NEXUS, "SOLID_REACTIVE_NEXUS", 0xe2e7bb69},
+    {RGB_MATRIX_SOLID_REACTIVE_MULTINEXUS, "SOLID_REACTIVE_MULTINEXUS", 0x392c5f53},
+    {RGB_MATRIX_SPLASH, "SPLASH", 0xae014fa0},
+    {RGB_MATRIX_MULTISPLASH, "MULTISPLASH", 0x5d093850},
+    {RGB_MATRIX_SOLID_SPLASH, "SOLID_SPLASH", 0x5d207365},
+    {RGB_MATRIX_SOLID_MULTISPLASH, "SOLID_MULTISPLASH", 0x0712acbf},
+    {RGB_MATRIX_STARLIGHT, "STARLIGHT", 0x9665ea40},
+    {RGB_MATRIX_STARLIGHT_DUAL_SAT, "STARLIGHT_DUAL_SAT", 0x4c2f03dd},
+    {RGB_MATRIX_STARLIGHT_DUAL_HUE, "STARLIGHT_DUAL_HUE", 0x5f854f46},
+    {RGB_MATRIX_RIVERFLOW, "RIVERFLOW", 0x31d5c9b0},
+    {RGB_MATRIX_VIALRGB_DIRECT, "VIALRGB_DIRECT", 0xa131db68},
+};
+
+TEST_F(RgbMatrixEffects, FramesMatchGolden) {
+    for (const auto &golden : goldens) {
+        /* Idle, then typing, at two speeds */
+        uint32_t hash = render(golden.mode, 4000, 0) * 16777619u ^ render(golden.mode, 4000, 60, 255);
+        EXPECT_EQ(hash, golden.hash) << golden.name << ": got 0x" << std::hex << std::setw(8) << std::setfill('0') << hash << ", expected 0x" << std::setw(8) << golden.hash;
+    }
+}
+
+TEST_F(RgbMatrixEffects, Benchmark) {
+    for (const auto &golden : goldens) {
+        std::cout << golden.name << ": " << (uint32_t)frames_per_second(golden.mode) << " frames/s" << std::endl;
+    }
+}
@@ -0,0 +1,13 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+# Only for the VIALRGB_DIRECT effect, vialrgb.c itself is not built
+OPT_DEFS += -DVIALRGB_ENABLE
+
+SRC += tests/rgb_matrix/rgb_matrix_test_driver.c
+
+# Same effects and goldens as the uncached build
+SRC += tests/rgb_matrix/effects/test_rgb_matrix_effects.cpp
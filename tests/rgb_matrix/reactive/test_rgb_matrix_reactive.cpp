@@ -0,0 +1,43 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iomanip>
+#include "gtest/gtest.h"
+#include "../rgb_matrix_test_fixture.hpp"
+
+class RgbMatrixReactive : public RgbMatrixTest {};
+
+struct ReactiveGolden {
+    uint8_t     mode;
+    const char *name;
+    uint32_t    hash;
+};
+
+/* Frame hashes recorded with the original per-LED, per-hit distance computation. */
+static const ReactiveGolden goldens[] = {
+    {RGB_MATRIX_SOLID_REACTIVE_WIDE, "SOLID_REACTIVE_WIDE", 0xa1b46281},
+    {RGB_MATRIX_SOLID_REACTIVE_MULTIWIDE, "SOLID_REACTIVE_MULTIWIDE", 0xad16bba5},
+    {RGB_MATRIX_SOLID_REACTIVE_CROSS, "SOLID_REACTIVE_CROSS", 0x30897ae2},
+    {RGB_MATRIX_SOLID_REACTIVE_MULTICROSS, "SOLID_REACTIVE_MULTICROSS", 0xab634503},
+    {RGB_MATRIX_SOLID_REACTIVE_NEXUS, "SOLID_REACTIVE_NEXUS", 0x28cb49ce},
+    {RGB_MATRIX_SOLID_REACTIVE_MULTINEXUS, "SOLID_REACTIVE_MULTINEXUS", 0xbdb72ed5},
+    {RGB_MATRIX_SPLASH, "SPLASH", 0xa98f260e},
+    {RGB_MATRIX_MULTISPLASH, "MULTISPLASH", 0x2df08e98},
+    {RGB_MATRIX_SOLID_SPLASH, "SOLID_SPLASH", 0xf40d38da},
+    {RGB_MATRIX_SOLID_MULTISPLASH, "SOLID_MULTISPLASH", 0x35e8e64e},
+};
+
+TEST_F(RgbMatrixReactive, FramesMatchGolden) {
+    for (const auto &golden : goldens) {
+        /* Fast typing, slow typing, and hits left to age out at full speed */
+        uint32_t hash = render(golden.mode, 3000, 45) ^ render(golden.mode, 70000, 700) ^ render(golden.mode, 70000, 9000, 255);
+        std::cout << golden.name << " 0x" << std::hex << std::setw(8) << std::setfill('0') << hash << std::dec << std::endl;
+        EXPECT_EQ(hash, golden.hash) << golden.name;
+    }
+}
+
+TEST_F(RgbMatrixReactive, Benchmark) {
+    for (const auto &golden : goldens) {
+        std::cout << golden.name << ": " << (uint32_t)frames_per_second(golden.mode) << " frames/s" << std::endl;
+    }
+}
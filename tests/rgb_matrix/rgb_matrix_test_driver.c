@@ -0,0 +1,46 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+#include "rgb_matrix_test_driver.h"
+
+led_config_t g_led_config;
+
+uint8_t  rgb_matrix_test_frame[RGB_MATRIX_LED_COUNT][3];
+uint32_t rgb_matrix_test_flushes;
+
+/* One LED per key, spread evenly over the 224x64 grid. */
+static void init(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t led                      = row * MATRIX_COLS + col;
+            g_led_config.matrix_co[row][col] = led;
+            g_led_config.point[led].x        = col * 224 / (MATRIX_COLS - 1);
+            g_led_config.point[led].y        = row * 64 / (MATRIX_ROWS - 1);
+            g_led_config.flags[led]          = LED_FLAG_KEYLIGHT;
+        }
+    }
+}
+
+static void set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    rgb_matrix_test_frame[index][0] = r;
+    rgb_matrix_test_frame[index][1] = g;
+    rgb_matrix_test_frame[index][2] = b;
+}
+
+static void set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        set_color(i, r, g, b);
+    }
+}
+
+static void flush(void) {
+    rgb_matrix_test_flushes++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = init,
+    .set_color     = set_color,
+    .set_color_all = set_color_all,
+    .flush         = flush,
+};
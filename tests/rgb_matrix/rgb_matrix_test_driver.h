@@ -0,0 +1,10 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/* Colours as last written by rgb_matrix, and the number of completed frames. */
+extern uint8_t  rgb_matrix_test_frame[RGB_MATRIX_LED_COUNT][3];
+extern uint32_t rgb_matrix_test_flushes;
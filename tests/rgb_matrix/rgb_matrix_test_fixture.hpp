@@ -0,0 +1,79 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <stdlib.h>
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include <lib/lib8tion/lib8tion.h>
+#include "rgb_matrix_test_driver.h"
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class RgbMatrixTest : public TestFixture {
+   public:
+    /* Starts `mode` from a clean state: no hits, seeded RNGs, time zero, and a frame just flushed. */
+    void start(uint8_t mode, uint8_t speed = RGB_MATRIX_DEFAULT_SPD) {
+        rgb_matrix_init();
+        rgb_matrix_mode_noeeprom(mode);
+        rgb_matrix_sethsv_noeeprom(96, 255, 200);
+        rgb_matrix_set_speed_noeeprom(speed);
+        uint32_t flushes = rgb_matrix_test_flushes;
+        while (rgb_matrix_test_flushes == flushes) {
+            advance_time(1);
+            rgb_matrix_task();
+        }
+        srand(1);
+        random16_set_seed(1337);
+        set_time(0);
+        rgb_matrix_task();
+    }
+
+    /* A deterministic typing pattern walking the board. */
+    static void hit(uint32_t n) {
+        process_rgb_matrix((n * 7) % MATRIX_ROWS, (n * 11) % MATRIX_COLS, true);
+    }
+
+    /* Renders `ms` milliseconds, typing a key every `interval` ms (never if 0), and returns an FNV-1a hash of every flushed frame. */
+    uint32_t render(uint8_t mode, uint32_t ms, uint32_t interval, uint8_t speed = RGB_MATRIX_DEFAULT_SPD) {
+        start(mode, speed);
+        uint32_t hash    = 2166136261u;
+        uint32_t flushes = rgb_matrix_test_flushes;
+        for (uint32_t t = 0; t < ms; t++) {
+            if (interval && t % interval == 0) {
+                hit(t / interval);
+            }
+            advance_time(1);
+            rgb_matrix_task();
+            if (rgb_matrix_test_flushes != flushes) {
+                flushes             = rgb_matrix_test_flushes;
+                const uint8_t *data = &rgb_matrix_test_frame[0][0];
+                for (size_t i = 0; i < sizeof(rgb_matrix_test_frame); i++) {
+                    hash = (hash ^ data[i]) * 16777619u;
+                }
+            }
+        }
+        return hash;
+    }
+
+    /* Frames per second of host time while typing a key every 40ms. */
+    double frames_per_second(uint8_t mode) {
+        start(mode);
+        uint32_t flushes = rgb_matrix_test_flushes;
+        auto     begin   = std::chrono::steady_clock::now();
+        for (uint32_t t = 0; t < 20000; t++) {
+            if (t % 40 == 0) {
+                hit(t / 40);
+            }
+            advance_time(1);
+            rgb_matrix_task();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+        return (rgb_matrix_test_flushes - flushes) / elapsed.count();
+    }
+};
@@ -0,0 +1,13 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define SENDSTRING_ASYNC
+#define SENDSTRING_ASYNC_MAX_SPEED
+
+#define UNICODE_SELECTED_MODES UNICODE_MODE_LINUX
+
+#define EEPROM_SIZE 4096
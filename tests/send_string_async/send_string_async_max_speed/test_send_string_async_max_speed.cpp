@@ -0,0 +1,82 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "send_string.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::Invoke;
+
+/* An endpoint which holds ENDPOINT_DEPTH reports, and is polled ENDPOINT_POLLS_PER_MS times per millisecond. */
+#define ENDPOINT_DEPTH 4
+#define ENDPOINT_POLLS_PER_MS 4
+/* Main loop passes per millisecond, faster than the endpoint drains. */
+#define SCANS_PER_MS 8
+
+static uint32_t endpoint_queued;
+static uint32_t endpoint_polled;
+
+static void endpoint_poll(void) {
+    uint32_t polls = timer_read32() * ENDPOINT_POLLS_PER_MS;
+    while (endpoint_polled < polls) {
+        endpoint_polled++;
+        if (endpoint_queued) {
+            endpoint_queued--;
+        }
+    }
+}
+
+extern "C" bool keyboard_report_ready(void) {
+    endpoint_poll();
+    return endpoint_queued < ENDPOINT_DEPTH;
+}
+
+class SendStringAsyncMaxSpeed : public TestFixture {};
+
+TEST_F(SendStringAsyncMaxSpeed, PacedByEndpoint) {
+    TestDriver               driver;
+    std::vector<std::string> reports;
+    uint32_t                 overflows = 0;
+    endpoint_queued                    = 0;
+    endpoint_polled                    = timer_read32() * ENDPOINT_POLLS_PER_MS;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+        endpoint_poll();
+        overflows += endpoint_queued >= ENDPOINT_DEPTH;
+        endpoint_queued++;
+        reports.emplace_back((const char *)&report, sizeof(report));
+    }));
+
+    std::string text;
+    // Fits in the queue, so nothing is typed out before send_string_async_with_delay() returns
+    for (int i = 0; i < 5; i++) {
+        text += "sphinx of black quartz ";
+    }
+    send_string_async_with_delay(text.c_str(), 0);
+
+    uint32_t start = timer_read32();
+    while (send_string_async_busy() && timer_read32() - start < 10000) {
+        for (int scan = 0; scan < SCANS_PER_MS; scan++) {
+            keyboard_task();
+        }
+        advance_time(1);
+    }
+    uint32_t elapsed = timer_read32() - start;
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    std::cout << reports.size() << " reports in " << elapsed << "ms" << std::endl;
+    EXPECT_FALSE(send_string_async_busy());
+    EXPECT_EQ(reports.size(), text.size() * 2);
+    EXPECT_EQ(overflows, 0u);
+    // Paced by the endpoint rather than one change per millisecond
+    EXPECT_LE(elapsed, reports.size() / ENDPOINT_POLLS_PER_MS + 1);
+}
@@ -0,0 +1,297 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "send_string.h"
+#include "unicode.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::Invoke;
+
+struct recorded_report_t {
+    report_keyboard_t report;
+    uint32_t          time;
+};
+
+class SendStringAsync : public TestFixture {
+   public:
+    std::vector<recorded_report_t> reports;
+
+    void record(TestDriver &driver) {
+        reports.clear();
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([this](report_keyboard_t &report) { reports.push_back({report, timer_read32()}); }));
+    }
+
+    /* Runs the main loop until the queue is empty, returning the longest time a single keyboard_task() took. */
+    uint32_t run_until_idle(uint32_t limit_ms = 10000) {
+        uint32_t longest = 0;
+        for (uint32_t ms = 0; ms < limit_ms && send_string_async_busy(); ms++) {
+            uint32_t start = timer_read32();
+            keyboard_task();
+            longest = std::max(longest, timer_read32() - start);
+            advance_time(1);
+        }
+        EXPECT_FALSE(send_string_async_busy());
+        return longest;
+    }
+
+    std::vector<recorded_report_t> record_sync(TestDriver &driver, std::function<void()> send) {
+        record(driver);
+        send();
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        return reports;
+    }
+
+    std::vector<recorded_report_t> record_async(TestDriver &driver, std::function<void()> send) {
+        record(driver);
+        send();
+        run_until_idle();
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        return reports;
+    }
+
+    /* Decodes the text a US layout host would see, with other modifiers shown as <mods:key>. */
+    static std::string typed_text(const std::vector<recorded_report_t> &reports) {
+        std::string       text;
+        report_keyboard_t previous = {};
+        for (auto &entry : reports) {
+            const report_keyboard_t &report = entry.report;
+            for (uint8_t key : report.keys) {
+                bool pressed = key != KC_NO;
+                for (uint8_t held : previous.keys) {
+                    pressed &= held != key;
+                }
+                if (!pressed) {
+                    continue;
+                }
+                bool shifted = report.mods & MOD_MASK_SHIFT;
+                char ascii   = 0;
+                for (int c = 0; c < 128 && !ascii; c++) {
+                    if (pgm_read_byte(&ascii_to_keycode_lut[c]) == key && ((ascii_to_shift_lut[c / 8] >> (c % 8)) & 1) == shifted) {
+                        ascii = c;
+                    }
+                }
+                if (report.mods & ~MOD_MASK_SHIFT || !ascii) {
+                    text += "<" + std::to_string(report.mods) + ":" + std::to_string(key) + ">";
+                } else {
+                    text += ascii;
+                }
+            }
+            previous = report;
+        }
+        return text;
+    }
+
+    static bool same_reports(const std::vector<recorded_report_t> &a, const std::vector<recorded_report_t> &b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < a.size(); i++) {
+            if (memcmp(&a[i].report, &b[i].report, sizeof(report_keyboard_t)) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(SendStringAsync, PlainTextMatchesSync) {
+    TestDriver driver;
+    auto       sync_reports  = record_sync(driver, [] { send_string("hello world 123"); });
+    auto       async_reports = record_async(driver, [] { send_string_async("hello world 123"); });
+
+    EXPECT_TRUE(same_reports(sync_reports, async_reports));
+    EXPECT_EQ(typed_text(async_reports), "hello world 123");
+}
+
+TEST_F(SendStringAsync, ShiftedTextBatchesModifiers) {
+    TestDriver        driver;
+    const std::string text          = "Hello, WORLD! (QMK) ~ a_b";
+    auto              sync_reports  = record_sync(driver, [&] { send_string(text.c_str()); });
+    auto              async_reports = record_async(driver, [&] { send_string_async(text.c_str()); });
+
+    std::cout << "shifted text: " << sync_reports.size() << " reports synchronously, " << async_reports.size() << " queued" << std::endl;
+    EXPECT_EQ(typed_text(sync_reports), text);
+    EXPECT_EQ(typed_text(async_reports), text);
+    EXPECT_LT(async_reports.size(), sync_reports.size());
+    EXPECT_EQ(get_mods(), 0);
+}
+
+TEST_F(SendStringAsync, SendStringCodesMatchSync) {
+    TestDriver  driver;
+    const char *macro         = "ab" SS_TAP(X_ENTER) SS_DOWN(X_LCTL) "c" SS_UP(X_LCTL) SS_DELAY(20) "d" SS_LSFT("e");
+    auto        sync_reports  = record_sync(driver, [&] { send_string(macro); });
+    auto        async_reports = record_async(driver, [&] { send_string_async(macro); });
+
+    EXPECT_TRUE(same_reports(sync_reports, async_reports));
+    EXPECT_EQ(typed_text(async_reports), "ab\n<1:6>dE");
+
+    // The delay comes between the release of Ctrl and the press of "d"
+    auto d_press = std::find_if(async_reports.begin(), async_reports.end(), [](const recorded_report_t &r) { return r.report.keys[0] == KC_D; });
+    ASSERT_NE(d_press, async_reports.end());
+    EXPECT_GE(d_press->time - (d_press - 1)->time, 20u);
+}
+
+TEST_F(SendStringAsync, OneChangePerFrame) {
+    TestDriver driver;
+    auto       async_reports = record_async(driver, [] { send_string_async("frames"); });
+
+    ASSERT_EQ(async_reports.size(), 12u);
+    for (size_t i = 1; i < async_reports.size(); i++) {
+        EXPECT_GE(async_reports[i].time - async_reports[i - 1].time, 1u);
+    }
+}
+
+TEST_F(SendStringAsync, IntervalSpacesChanges) {
+    TestDriver driver;
+    auto       async_reports = record_async(driver, [] { send_string_async_with_delay("ab", 10); });
+
+    ASSERT_EQ(async_reports.size(), 4u);
+    for (size_t i = 1; i < async_reports.size(); i++) {
+        EXPECT_GE(async_reports[i].time - async_reports[i - 1].time, 10u);
+    }
+}
+
+/* A long macro with a delay between characters, with a key pressed part way through. */
+TEST_F(SendStringAsync, KeysPressedWhileTyping) {
+    TestDriver  driver;
+    auto        key_z = KeymapKey(0, 0, 0, KC_Z);
+    std::string text;
+    for (int i = 0; i < 20; i++) {
+        text += "lorem ipsum ";
+    }
+    set_keymap({key_z});
+
+    uint32_t start = timer_read32();
+    record_sync(driver, [&] { send_string_with_delay(text.c_str(), 5); });
+    uint32_t sync_stall = timer_read32() - start;
+
+    record(driver);
+    send_string_async_with_delay(text.c_str(), 5);
+    idle_for(100);
+    key_z.press();
+    run_one_scan_loop();
+    key_z.release();
+    run_one_scan_loop();
+    EXPECT_TRUE(send_string_async_busy());
+    uint32_t async_stall = run_until_idle();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    std::cout << text.size() << " characters: " << sync_stall << "ms blocked synchronously, " << async_stall << "ms longest main loop pass queued" << std::endl;
+    EXPECT_EQ(async_stall, 0u);
+    std::string typed = typed_text(reports);
+    EXPECT_NE(typed.find('z'), std::string::npos);
+    typed.erase(typed.find('z'), 1);
+    EXPECT_EQ(typed, text);
+}
+
+/* Shift is held across a run of capitals, but a key pressed during the run must not pick it up. */
+TEST_F(SendStringAsync, KeysPressedDuringShiftedRun) {
+    TestDriver  driver;
+    auto        key_z = KeymapKey(0, 0, 0, KC_Z);
+    std::string text(60, 'Q');
+    set_keymap({key_z});
+
+    record(driver);
+    send_string_async_with_delay(text.c_str(), 5);
+    idle_for(100);
+    key_z.press();
+    run_one_scan_loop();
+    key_z.release();
+    run_one_scan_loop();
+    EXPECT_TRUE(send_string_async_busy());
+    run_until_idle();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    std::string typed = typed_text(reports);
+    ASSERT_NE(typed.find('z'), std::string::npos);
+    typed.erase(typed.find('z'), 1);
+    EXPECT_EQ(typed, text);
+    EXPECT_EQ(get_mods() | get_weak_mods(), 0);
+}
+
+TEST_F(SendStringAsync, QueueOverflowTypesFront) {
+    TestDriver  driver;
+    std::string text(200, 'x');
+    record(driver);
+    // Far more than the queue holds, so the front is typed out to make room
+    send_string_async(text.c_str());
+    EXPECT_TRUE(send_string_async_busy());
+    EXPECT_GT(reports.size(), 0u);
+    run_until_idle();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(typed_text(reports), text);
+}
+
+TEST_F(SendStringAsync, SyncSendWaitsForQueue) {
+    TestDriver driver;
+    record(driver);
+    send_string_async("ab");
+    send_string("cd");
+    EXPECT_FALSE(send_string_async_busy());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(typed_text(reports), "abcd");
+}
+
+TEST_F(SendStringAsync, UnicodeString) {
+    TestDriver driver;
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+    auto sync_reports  = record_sync(driver, [] {
+        for (uint32_t code_point : {0x03A8, 0x2013}) {
+            register_unicode(code_point);
+        }
+    });
+    auto async_reports = record_async(driver, [] { send_unicode_string_async("Ψ–"); });
+
+    EXPECT_TRUE(same_reports(sync_reports, async_reports));
+}
+
+TEST_F(SendStringAsync, SyncUnicodeWaitsForQueue) {
+    TestDriver driver;
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+    auto expected = record_sync(driver, [] {
+        send_string("ab");
+        register_unicode(0x03A8);
+    });
+
+    record(driver);
+    send_string_async("ab");
+    send_unicode_string("Ψ");
+    EXPECT_FALSE(send_string_async_busy());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_TRUE(same_reports(expected, reports));
+}
+
+TEST_F(SendStringAsync, DynamicMacro) {
+    TestDriver        driver;
+    const std::string macro = "Hi" SS_TAP(X_TAB) "there";
+    std::vector<uint8_t> buffer(macro.begin(), macro.end());
+    buffer.resize(dynamic_keymap_macro_get_buffer_size(), 0);
+    for (uint16_t offset = 0; offset < buffer.size(); offset += 28) {
+        dynamic_keymap_macro_set_buffer(offset, 28, &buffer[offset]);
+    }
+
+    auto sync_reports = record_sync(driver, [&] { send_string(macro.c_str()); });
+    record(driver);
+    dynamic_keymap_macro_send(0);
+    EXPECT_TRUE(send_string_async_busy());
+    run_until_idle();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(typed_text(reports), typed_text(sync_reports));
+    EXPECT_EQ(typed_text(reports), "Hi\tthere");
+}
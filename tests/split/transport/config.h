@@ -0,0 +1,12 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 8
+#define MATRIX_COLS 10
+
+#include "test_common.h"
+
+#define SPLIT_LAYER_STATE_ENABLE
+#define SPLIT_MODS_ENABLE
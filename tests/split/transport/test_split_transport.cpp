@@ -0,0 +1,171 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iostream>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "split_transport_loopback.h"
+#include "action_layer.h"
+#include "action_util.h"
+#include "timer.h"
+
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define ROWS_PER_HAND ((MATRIX_ROWS) / 2)
+
+/* Wire cost model for a full-duplex USART link at 460800 baud, with a fixed turnaround per round trip. */
+static const double BYTE_US       = 10.0 * 1000000.0 / 460800.0;
+static const double TURNAROUND_US = 30.0;
+
+class SplitTransport : public testing::Test {
+   protected:
+    matrix_row_t master_matrix[ROWS_PER_HAND];
+    matrix_row_t slave_matrix[ROWS_PER_HAND];
+    matrix_row_t received[ROWS_PER_HAND];
+
+    void SetUp() override {
+        set_time(0);
+        split_loopback_reset();
+        memset(master_matrix, 0, sizeof(master_matrix));
+        memset(slave_matrix, 0, sizeof(slave_matrix));
+        memset(received, 0, sizeof(received));
+        layer_state = 0;
+        clear_mods();
+        // Let both halves settle, including any full resync from the first exchange
+        for (int i = 0; i < 3; i++) {
+            scan();
+        }
+    }
+
+    bool scan() {
+        advance_time(1);
+        // Both halves share the layer and mod globals in the test, so keep the slave from clobbering the master's
+        layer_state_t layers = layer_state;
+        uint8_t       mods   = get_mods();
+        matrix_row_t  mirror[ROWS_PER_HAND];
+        split_loopback_slave(mirror, slave_matrix);
+        layer_state = layers;
+        set_mods(mods);
+        return transactions_master(master_matrix, received);
+    }
+
+    void expect_received() {
+        for (int row = 0; row < ROWS_PER_HAND; row++) {
+            EXPECT_EQ(received[row], slave_matrix[row]) << "row " << row;
+        }
+    }
+};
+
+TEST_F(SplitTransport, SlaveMatrixArrives) {
+    slave_matrix[2] = 0b100100;
+    EXPECT_TRUE(scan());
+    expect_received();
+
+    slave_matrix[2] = 0;
+    slave_matrix[0] = 0b1;
+    EXPECT_TRUE(scan());
+    expect_received();
+}
+
+TEST_F(SplitTransport, IdleScanCost) {
+    split_loopback_stats_t before = split_loopback_get_stats();
+    for (int i = 0; i < 50; i++) {
+        EXPECT_TRUE(scan());
+    }
+    split_loopback_stats_t after = split_loopback_get_stats();
+    std::cout << "50 idle scans: " << after.transactions - before.transactions << " round trips, " << after.bytes - before.bytes << " bytes" << std::endl;
+
+#ifdef SPLIT_TRANSPORT_BATCH
+    EXPECT_EQ(after.transactions - before.transactions, 50u);
+#else
+    // The periodic forced syncs add round trips on top of the matrix checksum
+    EXPECT_GE(after.transactions - before.transactions, 50u);
+#endif
+}
+
+TEST_F(SplitTransport, KeypressWithStateChanges) {
+    split_loopback_stats_t before = split_loopback_get_stats();
+
+    slave_matrix[1] = 0b10;
+    layer_state     = 1 << 2;
+    set_mods(MOD_BIT(KC_LSFT));
+    EXPECT_TRUE(scan());
+    expect_received();
+
+    split_loopback_stats_t after        = split_loopback_get_stats();
+    uint32_t               transactions = after.transactions - before.transactions;
+    uint32_t               bytes        = after.bytes - before.bytes;
+    std::cout << "keypress with layer and mods change: " << transactions << " round trips, " << bytes << " bytes" << std::endl;
+
+#ifdef SPLIT_TRANSPORT_BATCH
+    EXPECT_EQ(transactions, 1u);
+#else
+    // Matrix checksum, matrix data, layer state, mods
+    EXPECT_EQ(transactions, 4u);
+#endif
+}
+
+TEST_F(SplitTransport, StateReachesSlave) {
+    layer_state = 1 << 3;
+    set_mods(MOD_BIT(KC_LCTL));
+    matrix_row_t mirror[ROWS_PER_HAND];
+    EXPECT_TRUE(transactions_master(master_matrix, received));
+
+    // Wipe the shared globals and let the slave restore them from what it received
+    layer_state = 0;
+    clear_mods();
+    split_loopback_slave(mirror, slave_matrix);
+    EXPECT_EQ(layer_state, (layer_state_t)(1 << 3));
+    EXPECT_EQ(get_mods(), MOD_BIT(KC_LCTL));
+}
+
+TEST_F(SplitTransport, CorruptResponseIsNotApplied) {
+    slave_matrix[3] = 0b111;
+    split_loopback_corrupt_next_response();
+    EXPECT_TRUE(scan());
+    expect_received();
+
+    slave_matrix[3] = 0b001;
+    EXPECT_TRUE(scan());
+    expect_received();
+}
+
+/* Simulates 10s of 1ms scans while typing a key every 100ms, and measures the link cost. */
+TEST_F(SplitTransport, TypingThroughput) {
+    split_loopback_stats_t before     = split_loopback_get_stats();
+    uint32_t               scans      = 0;
+    uint32_t               keypresses = 0;
+    for (uint32_t t = 0; t < 10000; t++) {
+        uint32_t phase = t % 100;
+        uint8_t  row   = (t / 100) % ROWS_PER_HAND;
+        if (phase == 0) {
+            slave_matrix[row] |= 1 << (t / 100) % MATRIX_COLS;
+            keypresses++;
+        } else if (phase == 30) {
+            slave_matrix[row] = 0;
+        }
+        // Every fifth key is shifted
+        if ((t / 100) % 5 == 0) {
+            phase < 30 ? set_mods(MOD_BIT(KC_LSFT)) : clear_mods();
+        }
+        EXPECT_TRUE(scan());
+        expect_received();
+        scans++;
+    }
+    split_loopback_stats_t after = split_loopback_get_stats();
+
+    uint32_t transactions = after.transactions - before.transactions;
+    uint32_t bytes        = after.bytes - before.bytes;
+    double   scan_us      = (bytes * BYTE_US + transactions * TURNAROUND_US) / scans;
+    std::cout << scans << " scans: " << transactions << " round trips, " << bytes << " bytes, " << (double)bytes / keypresses << " bytes per keypress, " << (int)(1000000.0 / scan_us) << " scans/sec link limit" << std::endl;
+
+#ifdef SPLIT_TRANSPORT_BATCH
+    EXPECT_EQ(transactions, scans);
+#else
+    EXPECT_GT(transactions, scans);
+#endif
+}
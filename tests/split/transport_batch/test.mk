@@ -0,0 +1,12 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+SPLIT_KEYBOARD = yes
+SPLIT_TRANSPORT = custom
+
+COMMON_VPATH += $(QUANTUM_PATH)/split_common
+
+SRC += \
+	quantum/split_common/transactions.c \
+	platforms/test/split_transport_loopback.c \
+	tests/split/transport/test_split_transport.cpp
@@ -0,0 +1,10 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../transport/config.h"
+
+#define SPLIT_TRANSPORT_BATCH
+// Room for the layer state alongside the frame header, but not for the mods
+#define SPLIT_TRANSPORT_BATCH_SIZE 8
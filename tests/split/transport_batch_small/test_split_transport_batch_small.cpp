@@ -0,0 +1,62 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "split_transport_loopback.h"
+#include "transport.h"
+#include "action_layer.h"
+#include "action_util.h"
+
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define ROWS_PER_HAND ((MATRIX_ROWS) / 2)
+
+static_assert(sizeof(layer_state_t) <= SPLIT_TRANSPORT_BATCH_SIZE - SPLIT_BATCH_M2S_HEADER_SIZE, "layer state should fit in a batch");
+static_assert(sizeof(split_mods_sync_t) > SPLIT_TRANSPORT_BATCH_SIZE - SPLIT_BATCH_M2S_HEADER_SIZE, "mods should not fit in a batch");
+
+class SplitTransportBatchSmall : public testing::Test {
+   protected:
+    matrix_row_t master_matrix[ROWS_PER_HAND];
+    matrix_row_t slave_matrix[ROWS_PER_HAND];
+    matrix_row_t received[ROWS_PER_HAND];
+    matrix_row_t mirror[ROWS_PER_HAND];
+
+    void SetUp() override {
+        set_time(0);
+        split_loopback_reset();
+        memset(master_matrix, 0, sizeof(master_matrix));
+        memset(slave_matrix, 0, sizeof(slave_matrix));
+        memset(received, 0, sizeof(received));
+        layer_state = 0;
+        clear_mods();
+        for (int i = 0; i < 3; i++) {
+            advance_time(1);
+            split_loopback_slave(mirror, slave_matrix);
+            transactions_master(master_matrix, received);
+        }
+    }
+};
+
+/* Mods are too large for a batch frame here, so they have to go out in their own transaction rather than wait forever. */
+TEST_F(SplitTransportBatchSmall, OversizeStateIsSentOnItsOwn) {
+    split_loopback_stats_t before = split_loopback_get_stats();
+    layer_state                   = 1 << 3;
+    set_mods(MOD_BIT(KC_LCTL));
+    advance_time(1);
+    EXPECT_TRUE(transactions_master(master_matrix, received));
+    split_loopback_stats_t after = split_loopback_get_stats();
+    // The batch with the layer state, and the mods
+    EXPECT_EQ(after.transactions - before.transactions, 2u);
+
+    // Wipe the shared globals and let the slave restore them from what it received
+    layer_state = 0;
+    clear_mods();
+    split_loopback_slave(mirror, slave_matrix);
+    EXPECT_EQ(layer_state, (layer_state_t)(1 << 3));
+    EXPECT_EQ(get_mods(), MOD_BIT(KC_LCTL));
+}
@@ -0,0 +1,13 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define EEPROM_SIZE 2048
+#define DYNAMIC_KEYMAP_LAYER_COUNT 2
+#define DYNAMIC_KEYMAP_RAM_CACHE
+#define VIAL_KEYBOARD_UID {0x3E, 0x1F, 0x8A, 0x47, 0x0C, 0x9B, 0x22, 0x65}
+#define VIAL_TAP_DANCE_ENTRIES 4
+#define TAP_CODE_DELAY 10
@@ -0,0 +1,273 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <iostream>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "vial.h"
+
+void     set_time(uint32_t t);
+void     advance_time(uint32_t ms);
+uint32_t eeprom_test_get_read_count(void);
+
+void raw_hid_send(uint8_t *data, uint8_t length) {}
+}
+
+using testing::_;
+using testing::InSequence;
+
+enum { TD_TAP_HOLD, TD_TAP_DOUBLE, TD_TAP_ONLY };
+
+class VialTapDance : public TestFixture {
+   public:
+    KeymapKey key_tap_hold   = KeymapKey{0, 0, 0, TD(TD_TAP_HOLD)};
+    KeymapKey key_tap_double = KeymapKey{0, 1, 0, TD(TD_TAP_DOUBLE)};
+    KeymapKey key_tap_only   = KeymapKey{0, 2, 0, TD(TD_TAP_ONLY)};
+    KeymapKey key_x          = KeymapKey{0, 3, 0, KC_X};
+    uint32_t  max_stall;
+    uint32_t  total_stall;
+
+    void SetUp() override {
+        /* Time keeps moving forward across tests, so that no timer left over from a previous test looks recent */
+        static uint32_t test_time;
+        test_time += 100000;
+        set_time(test_time);
+
+        /* The test fixture doesn't run keyboard_setup(), which loads the entries */
+        vial_init();
+        set_keymap({key_tap_hold, key_tap_double, key_tap_only, key_x});
+        for (auto &key : {key_tap_hold, key_tap_double, key_tap_only, key_x}) {
+            dynamic_keymap_set_keycode(0, key.position.row, key.position.col, key.code);
+        }
+        set_tap_dance(TD_TAP_HOLD, {KC_A, KC_B, KC_NO, KC_NO, TAPPING_TERM});
+        set_tap_dance(TD_TAP_DOUBLE, {KC_C, KC_NO, KC_D, KC_NO, TAPPING_TERM});
+        set_tap_dance(TD_TAP_ONLY, {KC_E, KC_NO, KC_NO, KC_NO, TAPPING_TERM});
+        max_stall   = 0;
+        total_stall = 0;
+    }
+
+    /* Sets an entry the way the Vial host does */
+    static void set_tap_dance(uint8_t index, vial_tap_dance_entry_t td) {
+        uint8_t msg[VIAL_RAW_EPSIZE] = {0xFE, vial_dynamic_entry_op, dynamic_vial_tap_dance_set, index};
+        memcpy(&msg[4], &td, sizeof(td));
+        vial_handle_cmd(msg, sizeof(msg));
+    }
+
+    /* Runs the scan loop, tracking the longest time spent in a single scan */
+    void scan(unsigned ms) {
+        for (unsigned i = 0; i < ms; i++) {
+            uint32_t start = timer_read32();
+            keyboard_task();
+            uint32_t stall = timer_read32() - start;
+            max_stall      = std::max(max_stall, stall);
+            total_stall += stall;
+            advance_time(1);
+        }
+    }
+
+    void tap(KeymapKey &key) {
+        key.press();
+        scan(1);
+        key.release();
+        scan(1);
+    }
+};
+
+TEST_F(VialTapDance, TapReleasesWithoutStall) {
+    TestDriver driver;
+    InSequence s;
+
+    /* Tap and hold set, so the release finishes the dance */
+    key_tap_hold.press();
+    EXPECT_NO_REPORT(driver);
+    scan(1);
+    key_tap_hold.release();
+    EXPECT_REPORT(driver, (KC_A));
+    scan(1);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The release follows once the tap code delay has passed */
+    EXPECT_EMPTY_REPORT(driver);
+    scan(TAP_CODE_DELAY);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(max_stall, 0u);
+}
+
+TEST_F(VialTapDance, HoldSendsHoldKey) {
+    TestDriver driver;
+    InSequence s;
+
+    key_tap_hold.press();
+    EXPECT_REPORT(driver, (KC_B));
+    scan(TAPPING_TERM + 2);
+    VERIFY_AND_CLEAR(driver);
+
+    key_tap_hold.release();
+    EXPECT_EMPTY_REPORT(driver);
+    scan(TAP_CODE_DELAY + 1);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(max_stall, 0u);
+}
+
+TEST_F(VialTapDance, DoubleTapFallsBackToTaps) {
+    TestDriver driver;
+    InSequence s;
+
+    tap(key_tap_only);
+    tap(key_tap_only);
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    scan(TAPPING_TERM + 2 * TAP_CODE_DELAY);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(max_stall, 0u);
+}
+
+TEST_F(VialTapDance, TripleTapSendsThreeTaps) {
+    TestDriver driver;
+    InSequence s;
+
+    tap(key_tap_only);
+    tap(key_tap_only);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_REPORT(driver, (KC_E));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    tap(key_tap_only);
+    scan(TAPPING_TERM + 3 * TAP_CODE_DELAY);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(max_stall, 0u);
+}
+
+TEST_F(VialTapDance, DoubleTapKey) {
+    TestDriver driver;
+    InSequence s;
+
+    tap(key_tap_double);
+    key_tap_double.press();
+    scan(1);
+    key_tap_double.release();
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    scan(TAP_CODE_DELAY + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* A key pressed while a release is still pending must be sent after it */
+TEST_F(VialTapDance, NextKeyWaitsForPendingRelease) {
+    TestDriver driver;
+    InSequence s;
+
+    key_tap_hold.press();
+    scan(1);
+    key_tap_hold.release();
+    EXPECT_REPORT(driver, (KC_A));
+    scan(1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_X));
+    key_x.press();
+    scan(1);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_GT(max_stall, 0u);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_x.release();
+    scan(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(VialTapDance, InterruptedDanceKeepsOrder) {
+    TestDriver driver;
+    InSequence s;
+
+    tap(key_tap_only);
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_X));
+    key_x.press();
+    scan(1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_x.release();
+    scan(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Dances run from the RAM copy of the entries, which only a set from the host refreshes */
+TEST_F(VialTapDance, EntriesServedFromRam) {
+    TestDriver driver;
+    InSequence s;
+
+    uint32_t reads = eeprom_test_get_read_count();
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    tap(key_tap_only);
+    scan(TAPPING_TERM + TAP_CODE_DELAY);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(eeprom_test_get_read_count(), reads);
+
+    /* Changing EEPROM behind its back has no effect */
+    vial_tap_dance_entry_t td = {KC_F, KC_NO, KC_NO, KC_NO, TAPPING_TERM};
+    dynamic_keymap_set_tap_dance(TD_TAP_ONLY, &td);
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    tap(key_tap_only);
+    scan(TAPPING_TERM + TAP_CODE_DELAY);
+    VERIFY_AND_CLEAR(driver);
+
+    set_tap_dance(TD_TAP_ONLY, td);
+    EXPECT_REPORT(driver, (KC_F));
+    EXPECT_EMPTY_REPORT(driver);
+    tap(key_tap_only);
+    scan(TAPPING_TERM + TAP_CODE_DELAY);
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Resetting the keymap, as on the first boot or from VIA, rewrites the entries and has to refresh the RAM copy */
+TEST_F(VialTapDance, KeymapResetReloadsEntries) {
+    TestDriver driver;
+    InSequence s;
+
+    dynamic_keymap_reset();
+    EXPECT_NO_REPORT(driver);
+    tap(key_tap_only);
+    scan(TAPPING_TERM + TAP_CODE_DELAY);
+    VERIFY_AND_CLEAR(driver);
+
+    set_tap_dance(TD_TAP_ONLY, {KC_F, KC_NO, KC_NO, KC_NO, TAPPING_TERM});
+    EXPECT_REPORT(driver, (KC_F));
+    EXPECT_EMPTY_REPORT(driver);
+    tap(key_tap_only);
+    scan(TAPPING_TERM + TAP_CODE_DELAY);
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Types a mix of taps, holds and double taps, reporting the longest and total time the scan loop was blocked */
+TEST_F(VialTapDance, ScanLoopStall) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AnyNumber());
+
+    for (int i = 0; i < 50; i++) {
+        tap(key_tap_hold);
+        scan(TAP_CODE_DELAY);
+        tap(key_tap_only);
+        tap(key_tap_only);
+        scan(TAPPING_TERM + 2 * TAP_CODE_DELAY);
+        key_tap_hold.press();
+        scan(TAPPING_TERM + 2);
+        key_tap_hold.release();
+        scan(TAP_CODE_DELAY + 1);
+    }
+    std::cout << "scan loop stall: " << total_stall / 50 << "ms per sequence, longest " << max_stall << "ms" << std::endl;
+    EXPECT_EQ(max_stall, 0u);
+}
@@ -0,0 +1,284 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "test_common.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+/* Home row mods, with the rest of the alphabet on ordinary keys. */
+static const struct {
+    char     ascii;
+    uint8_t  col;
+    uint8_t  row;
+    uint16_t keycode;
+} layout[] = {
+    {'a', 0, 0, LGUI_T(KC_A)}, {'s', 1, 0, LALT_T(KC_S)}, {'d', 2, 0, LCTL_T(KC_D)}, {'f', 3, 0, LSFT_T(KC_F)}, {'j', 4, 0, RSFT_T(KC_J)}, {'k', 5, 0, RCTL_T(KC_K)}, {'l', 6, 0, RALT_T(KC_L)},
+    {'b', 0, 1, KC_B},         {'c', 1, 1, KC_C},         {'e', 2, 1, KC_E},         {'g', 3, 1, KC_G},         {'h', 4, 1, KC_H},         {'i', 5, 1, KC_I},         {'m', 6, 1, KC_M},
+    {'n', 7, 1, KC_N},         {'o', 8, 1, KC_O},         {'p', 9, 1, KC_P},         {'q', 0, 2, KC_Q},         {'r', 1, 2, KC_R},         {'t', 2, 2, KC_T},         {'u', 3, 2, KC_U},
+    {'v', 4, 2, KC_V},         {'w', 5, 2, KC_W},         {'x', 6, 2, KC_X},         {'y', 7, 2, KC_Y},         {'z', 8, 2, KC_Z},         {' ', 0, 3, KC_SPACE},
+};
+
+/* Words heavy in home row letters, so that mod-taps are often rolled over each other. */
+static const char *const words[] = {
+    "the", "and", "as", "said", "flask", "ask", "fads", "desk", "salad", "jazz", "skill", "lads", "falls", "dusk", "kids", "sled", "fold", "jokes", "walks", "adds", "deal", "flags", "sad", "asks", "lakes",
+};
+
+enum tap_hold_mode { DEFAULT_MODE, PERMISSIVE_HOLD_MODE, HOLD_ON_OTHER_KEY_PRESS_MODE };
+
+static tap_hold_mode mode;
+static uint16_t      quick_tap_term;
+
+extern "C" {
+bool get_permissive_hold(uint16_t keycode, keyrecord_t *record) {
+    return mode == PERMISSIVE_HOLD_MODE;
+}
+
+bool get_hold_on_other_key_press(uint16_t keycode, keyrecord_t *record) {
+    return mode == HOLD_ON_OTHER_KEY_PRESS_MODE;
+}
+
+uint16_t get_quick_tap_term(uint16_t keycode, keyrecord_t *record) {
+    return quick_tap_term;
+}
+}
+
+struct key_event_t {
+    uint32_t time;
+    size_t   key;
+    bool     pressed;
+};
+
+/* A modifier or keycode which went down in a report. */
+struct reported_t {
+    uint8_t  code;
+    bool     held;
+    uint32_t time;
+};
+
+struct roll_result_t {
+    std::vector<uint32_t> delays;
+    uint32_t              held;
+    uint32_t              modified;
+    uint32_t              lost;
+};
+
+class TapHoldLatency : public TestFixture {
+   public:
+    std::vector<KeymapKey> keys;
+    uint32_t               seed;
+
+    void SetUp() override {
+        mode           = DEFAULT_MODE;
+        quick_tap_term = QUICK_TAP_TERM;
+        seed           = 1;
+        for (auto &key : layout) {
+            keys.emplace_back(0, key.col, key.row, key.keycode);
+        }
+        set_keymap({});
+        for (auto &key : keys) {
+            add_key(key);
+        }
+    }
+
+    uint32_t random(uint32_t min, uint32_t max) {
+        seed = seed * 1103515245 + 12345;
+        return min + (seed >> 16) % (max - min + 1);
+    }
+
+    std::string random_text(int word_count) {
+        std::string text;
+        for (int i = 0; i < word_count; i++) {
+            text += words[random(0, sizeof(words) / sizeof(words[0]) - 1)];
+            text += ' ';
+        }
+        return text;
+    }
+
+    static size_t key_index(char ascii) {
+        for (size_t i = 0; i < sizeof(layout) / sizeof(layout[0]); i++) {
+            if (layout[i].ascii == ascii) {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    static uint8_t hold_mods(char ascii) {
+        uint16_t keycode = layout[key_index(ascii)].keycode;
+        if (!IS_QK_MOD_TAP(keycode)) {
+            return 0;
+        }
+        // Right hand modifiers sit in the upper nibble of the report
+        uint8_t mods = QK_MOD_TAP_GET_MODS(keycode);
+        return (mods & 0x10) ? (mods & 0xF) << 4 : mods;
+    }
+
+    static uint8_t tap_keycode(char ascii) {
+        uint16_t keycode = layout[key_index(ascii)].keycode;
+        return IS_QK_MOD_TAP(keycode) ? QK_MOD_TAP_GET_TAP_KEYCODE(keycode) : keycode;
+    }
+
+    /* Rolled typing: each key is held for 40-130ms, so the next key often goes down before the last one comes up. */
+    std::vector<key_event_t> roll(const std::string &text, uint32_t min_gap, uint32_t max_gap) {
+        std::vector<key_event_t> events;
+        uint32_t                 time = 10;
+        for (char c : text) {
+            size_t key = key_index(c);
+            // A key cannot go down again before it has come up
+            for (auto &event : events) {
+                if (event.key == key && !event.pressed && event.time >= time) {
+                    time = event.time + 1;
+                }
+            }
+            uint32_t hold = random(40, 130);
+            events.push_back({time, key, true});
+            events.push_back({time + hold, key, false});
+            time += random(min_gap, max_gap);
+        }
+        std::stable_sort(events.begin(), events.end(), [](const key_event_t &a, const key_event_t &b) { return a.time < b.time; });
+        return events;
+    }
+
+    /* Plays back the events one scan per millisecond, and times each press until the report which carries it. */
+    void play(TestDriver &driver, const std::vector<key_event_t> &events, roll_result_t &result) {
+        std::vector<reported_t> reports;
+        report_keyboard_t       previous = {};
+        uint32_t                start    = timer_read32();
+
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                if (report.mods & ~previous.mods & (1 << bit)) {
+                    reports.push_back({(uint8_t)(1 << bit), true, timer_read32() - start});
+                }
+            }
+            for (uint8_t key : report.keys) {
+                if (key != KC_NO && std::find(std::begin(previous.keys), std::end(previous.keys), key) == std::end(previous.keys)) {
+                    reports.push_back({key, false, timer_read32() - start});
+                    result.modified += report.mods != 0;
+                }
+            }
+            previous = report;
+        }));
+
+        size_t next = 0;
+        for (uint32_t time = 0; time < events.back().time + TAPPING_TERM * 2; time++) {
+            for (; next < events.size() && events[next].time == time; next++) {
+                KeymapKey &key = keys[events[next].key];
+                events[next].pressed ? key.press() : key.release();
+            }
+            run_one_scan_loop();
+        }
+        testing::Mock::VerifyAndClearExpectations(&driver);
+
+        // Every modifier or keycode reported belongs to the earliest press of its key which is still unaccounted for
+        std::vector<bool> matched(events.size(), false);
+        for (auto &output : reports) {
+            size_t press = 0;
+            while (press < events.size() && (matched[press] || !events[press].pressed || (output.held ? hold_mods : tap_keycode)(layout[events[press].key].ascii) != output.code)) {
+                press++;
+            }
+            ASSERT_LT(press, events.size()) << "reported a key which was not pressed";
+            ASSERT_LE(events[press].time, output.time) << "reported a key before it was pressed";
+            matched[press] = true;
+            result.delays.push_back(output.time - events[press].time);
+            result.held += output.held;
+        }
+        for (size_t i = 0; i < events.size(); i++) {
+            result.lost += events[i].pressed && !matched[i];
+        }
+    }
+
+    static uint32_t percentile(std::vector<uint32_t> values, uint32_t percent) {
+        if (values.empty()) {
+            return 0;
+        }
+        std::sort(values.begin(), values.end());
+        return values[(values.size() - 1) * percent / 100];
+    }
+
+    roll_result_t benchmark(TestDriver &driver, const char *name) {
+        roll_result_t total = {};
+        for (auto gap : {std::make_pair(60u, 120u), std::make_pair(30u, 80u), std::make_pair(15u, 50u)}) {
+            std::string   text   = random_text(60);
+            roll_result_t result = {};
+            play(driver, roll(text, gap.first, gap.second), result);
+
+            std::cout << name << ", " << gap.first << "-" << gap.second << "ms between presses: " << text.size() << " keys, press to report p50 " << percentile(result.delays, 50) << "ms, p90 " << percentile(result.delays, 90) << "ms, p99 " << percentile(result.delays, 99) << "ms, max " << percentile(result.delays, 100) << "ms, " << result.held << " held, " << result.modified << " typed with a modifier, " << result.lost << " lost" << std::endl;
+            total.delays.insert(total.delays.end(), result.delays.begin(), result.delays.end());
+            total.held += result.held;
+            total.modified += result.modified;
+            total.lost += result.lost;
+        }
+        return total;
+    }
+};
+
+TEST_F(TapHoldLatency, DefaultRolls) {
+    TestDriver driver;
+    auto       result = benchmark(driver, "default");
+
+    // Every key is a tap, settled no later than its own release
+    EXPECT_EQ(result.held, 0u);
+    EXPECT_EQ(result.modified, 0u);
+    EXPECT_EQ(result.lost, 0u);
+    EXPECT_LE(percentile(result.delays, 100), 130u);
+}
+
+TEST_F(TapHoldLatency, QuickTapTermRolls) {
+    TestDriver driver;
+    quick_tap_term = 0;
+    auto result    = benchmark(driver, "quick tap term 0");
+
+    EXPECT_EQ(result.held, 0u);
+    EXPECT_EQ(result.modified, 0u);
+    EXPECT_EQ(result.lost, 0u);
+    EXPECT_LE(percentile(result.delays, 100), 130u);
+}
+
+TEST_F(TapHoldLatency, PermissiveHoldRolls) {
+    TestDriver driver;
+    mode        = PERMISSIVE_HOLD_MODE;
+    auto result = benchmark(driver, "permissive hold");
+
+    // A key rolled fully inside a mod-tap turns it into a hold, but nothing waits longer than a tap
+    EXPECT_EQ(result.lost, 0u);
+    EXPECT_LE(percentile(result.delays, 100), 130u);
+}
+
+TEST_F(TapHoldLatency, HoldOnOtherKeyPressRolls) {
+    TestDriver driver;
+    mode        = HOLD_ON_OTHER_KEY_PRESS_MODE;
+    auto result = benchmark(driver, "hold on other key press");
+
+    EXPECT_GT(result.held, 0u);
+    EXPECT_EQ(result.lost, 0u);
+    EXPECT_LE(percentile(result.delays, 100), 130u);
+}
+
+/* A roll from the fast benchmark, which used to overflow the waiting buffer behind "s" and clear the keyboard. */
+TEST_F(TapHoldLatency, SettledReleasesDoNotWaitBehindNextKey) {
+    TestDriver               driver;
+    std::vector<key_event_t> events;
+    const struct {
+        uint32_t time;
+        char     ascii;
+        bool     pressed;
+    } trace[] = {
+        {10, 's', true}, {27, 'a', true}, {49, 'i', true}, {81, 'd', true}, {97, ' ', true}, {99, 'a', false}, {127, 'i', false}, {130, 't', true}, {137, 's', false}, {139, ' ', false}, {174, 'h', true}, {187, 't', false}, {189, 'e', true}, {210, 'd', false}, {255, 'h', false}, {283, 'e', false},
+    };
+    for (auto &event : trace) {
+        events.push_back({event.time, key_index(event.ascii), event.pressed});
+    }
+
+    roll_result_t result = {};
+    play(driver, events, result);
+
+    EXPECT_EQ(result.held, 0u);
+    EXPECT_EQ(result.lost, 0u);
+    EXPECT_LE(percentile(result.delays, 100), 130u);
+}
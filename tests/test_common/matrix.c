@@ -18,7 +18,8 @@
 #include "test_matrix.h"
 #include <string.h>
 
-static matrix_row_t matrix[MATRIX_ROWS] = {};
+static matrix_row_t      matrix[MATRIX_ROWS] = {};
+static matrix_row_mask_t dirty_rows          = 0;
 
 void matrix_init(void) {
     clear_all_keys();
@@ -26,6 +27,8 @@ void matrix_init(void) {
 }
 
 uint8_t matrix_scan(void) {
+    matrix_mark_dirty_rows(dirty_rows);
+    dirty_rows = 0;
     matrix_scan_kb();
     return 1;
 }
@@ -42,10 +45,12 @@ void matrix_scan_kb(void) {}
 
 void press_key(uint8_t col, uint8_t row) {
     matrix[row] |= (matrix_row_t)1 << col;
+    dirty_rows |= (matrix_row_mask_t)1 << row;
 }
 
 void release_key(uint8_t col, uint8_t row) {
     matrix[row] &= ~((matrix_row_t)1 << col);
+    dirty_rows |= (matrix_row_mask_t)1 << row;
 }
 
 bool matrix_is_on(uint8_t row, uint8_t col) {
@@ -54,6 +59,7 @@ bool matrix_is_on(uint8_t row, uint8_t col) {
 
 void clear_all_keys(void) {
     memset(matrix, 0, sizeof(matrix));
+    dirty_rows = matrix_row_mask_range(0, MATRIX_ROWS);
 }
 
 void led_set(uint8_t usb_led) {}
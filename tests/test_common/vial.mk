@@ -0,0 +1,14 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Builds Vial into a test, with KEYMAP_PATH pointing at the folder holding its vial.json
+
+VIA_ENABLE = yes
+VIAL_ENABLE = yes
+VIAL_INSECURE = yes
+
+# The Vial keyboard definition and version headers are generated into the test's build directory
+INTERMEDIATE_OUTPUT = $(BUILD_DIR)/test/$(TEST_OUTPUT)_vial
+VPATH += $(INTERMEDIATE_OUTPUT)/src
+$(shell mkdir -p $(INTERMEDIATE_OUTPUT)/src)
+$(shell printf '#pragma once\n#define QMK_BUILDDATE "2024-01-01-00:00:00"\n#define BUILD_ID ((uint32_t)0x00000000)\n' > $(INTERMEDIATE_OUTPUT)/src/version.h)
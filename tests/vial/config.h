@@ -0,0 +1,15 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define EEPROM_SIZE 8192
+#define DYNAMIC_KEYMAP_LAYER_COUNT 2
+#define DYNAMIC_KEYMAP_RAM_CACHE
+#define VIAL_KEYBOARD_UID {0x3E, 0x1F, 0x8A, 0x47, 0x0C, 0x9B, 0x22, 0x65}
+#define VIAL_TAP_DANCE_ENTRIES 64
+#define VIAL_COMBO_ENTRIES 255
+#define VIAL_KEY_OVERRIDE_ENTRIES 64
+#define COMBO_KEYCODE_INDEX
@@ -0,0 +1,7 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QMK_SETTINGS = no
+KEYMAP_PATH = tests/vial
+
+include tests/test_common/vial.mk
@@ -0,0 +1,153 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "vial.h"
+
+uint32_t eeprom_test_get_read_count(void);
+
+extern combo_t key_combos[];
+
+void raw_hid_send(uint8_t *data, uint8_t length) {}
+}
+
+using testing::_;
+using testing::InSequence;
+
+class VialDynamicEntries : public TestFixture {
+   public:
+    KeymapKey key_a = KeymapKey{0, 0, 0, KC_A};
+    KeymapKey key_b = KeymapKey{0, 1, 0, KC_B};
+    KeymapKey key_c = KeymapKey{0, 2, 0, KC_C};
+
+    void SetUp() override {
+        /* The test fixture doesn't run keyboard_setup(), which loads the entries */
+        vial_init();
+        set_keymap({key_a, key_b, key_c});
+        for (auto &key : {key_a, key_b, key_c}) {
+            dynamic_keymap_set_keycode(0, key.position.row, key.position.col, key.code);
+        }
+        for (uint16_t i = 0; i < VIAL_COMBO_ENTRIES; ++i) {
+            set_entry(dynamic_vial_combo_set, i, vial_combo_entry_t{});
+        }
+    }
+
+    /* Sends a set command the way the Vial host does */
+    template <typename T>
+    static void set_entry(uint8_t command, uint8_t index, T entry) {
+        uint8_t msg[VIAL_RAW_EPSIZE] = {0xFE, vial_dynamic_entry_op, command, index};
+        memcpy(&msg[4], &entry, sizeof(entry));
+        vial_handle_cmd(msg, sizeof(msg));
+    }
+
+    static void batch(uint8_t command) {
+        uint8_t msg[VIAL_RAW_EPSIZE] = {0xFE, vial_dynamic_entry_op, command};
+        vial_handle_cmd(msg, sizeof(msg));
+    }
+
+    /* A full upload from the configurator, with every combo using two of a handful of keys */
+    static void upload_combos(void) {
+        for (uint16_t i = 0; i < VIAL_COMBO_ENTRIES; ++i) {
+            vial_combo_entry_t entry = {{(uint16_t)(KC_D + i % 20), (uint16_t)(KC_D + (i / 20) % 20), COMBO_END, COMBO_END}, KC_Z};
+            set_entry(dynamic_vial_combo_set, i, entry);
+        }
+    }
+};
+
+/* Each set only reads back its own entry */
+TEST_F(VialDynamicEntries, SetReadsOnlyThatEntry) {
+    uint32_t reads = eeprom_test_get_read_count();
+    upload_combos();
+    uint32_t combo_reads = eeprom_test_get_read_count() - reads;
+
+    reads = eeprom_test_get_read_count();
+    for (uint8_t i = 0; i < VIAL_KEY_OVERRIDE_ENTRIES; ++i) {
+        set_entry(dynamic_vial_key_override_set, i, vial_key_override_entry_t{KC_1, KC_2, 1, MOD_BIT(KC_LSFT), 0, 0, vial_ko_enabled});
+    }
+    uint32_t override_reads = eeprom_test_get_read_count() - reads;
+
+    reads = eeprom_test_get_read_count();
+    for (uint8_t i = 0; i < VIAL_TAP_DANCE_ENTRIES; ++i) {
+        set_entry(dynamic_vial_tap_dance_set, i, vial_tap_dance_entry_t{KC_A, KC_B, KC_NO, KC_NO, TAPPING_TERM});
+    }
+    uint32_t tap_dance_reads = eeprom_test_get_read_count() - reads;
+
+    std::cout << VIAL_COMBO_ENTRIES << " combos: " << combo_reads / sizeof(vial_combo_entry_t) << " entries read, " << VIAL_KEY_OVERRIDE_ENTRIES << " key overrides: " << override_reads / sizeof(vial_key_override_entry_t) << " entries read, " << VIAL_TAP_DANCE_ENTRIES << " tap dances: " << tap_dance_reads / sizeof(vial_tap_dance_entry_t) << " entries read" << std::endl;
+    EXPECT_EQ(combo_reads, VIAL_COMBO_ENTRIES * sizeof(vial_combo_entry_t));
+    EXPECT_EQ(override_reads, VIAL_KEY_OVERRIDE_ENTRIES * sizeof(vial_key_override_entry_t));
+    EXPECT_EQ(tap_dance_reads, VIAL_TAP_DANCE_ENTRIES * sizeof(vial_tap_dance_entry_t));
+
+    EXPECT_EQ(key_combos[37].keycode, KC_Z);
+    EXPECT_EQ(key_combos[37].keys[0], KC_D + 17);
+    EXPECT_EQ(key_combos[37].keys[1], KC_D + 1);
+    EXPECT_EQ(key_combos[37].keys[2], COMBO_END);
+    EXPECT_EQ(key_overrides[5]->replacement, KC_2);
+}
+
+TEST_F(VialDynamicEntries, SetComboTriggers) {
+    TestDriver driver;
+    InSequence s;
+
+    set_entry(dynamic_vial_combo_set, 3, vial_combo_entry_t{{KC_A, KC_B, COMBO_END, COMBO_END}, KC_Z});
+    EXPECT_REPORT(driver, (KC_Z));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+
+    /* Replacing the combo drops its old keys */
+    set_entry(dynamic_vial_combo_set, 3, vial_combo_entry_t{{KC_B, KC_C, COMBO_END, COMBO_END}, KC_Y});
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_b, key_c});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Combos set within a batch work once it is committed, and if a key is pressed before that */
+TEST_F(VialDynamicEntries, BatchUpload) {
+    TestDriver driver;
+    InSequence s;
+
+    batch(dynamic_vial_batch_begin);
+    set_entry(dynamic_vial_combo_set, 0, vial_combo_entry_t{{KC_A, KC_B, COMBO_END, COMBO_END}, KC_Z});
+    EXPECT_REPORT(driver, (KC_Z));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+
+    set_entry(dynamic_vial_combo_set, 1, vial_combo_entry_t{{KC_B, KC_C, COMBO_END, COMBO_END}, KC_Y});
+    batch(dynamic_vial_batch_commit);
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_b, key_c});
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Times a full combo upload, one set at a time and as a batch */
+TEST_F(VialDynamicEntries, UploadBenchmark) {
+    auto time_upload = [](const char *name, bool batched) {
+        auto start = std::chrono::steady_clock::now();
+        if (batched) batch(dynamic_vial_batch_begin);
+        upload_combos();
+        if (batched) batch(dynamic_vial_batch_commit);
+        double elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        std::cout << name << ": " << elapsed << "us for " << VIAL_COMBO_ENTRIES << " combos" << std::endl;
+    };
+
+    time_upload("upload", false);
+    time_upload("batched upload", true);
+}
@@ -43,6 +43,7 @@
 #include "usb_device_state.h"
 #include "usb_descriptor.h"
 #include "usb_driver.h"
+#include "usb_report_queue.h"
 #include "usb_types.h"
 
 #ifdef NKRO_ENABLE
@@ -133,14 +134,57 @@ static void dummy_usb_cb(USBDriver *usbp, usbep_t ep) {
     (void)ep;
 }
 
+/* Report queues of the HID IN endpoints, indexed by endpoint number */
+static usb_report_queue_t *report_queues[MAX_ENDPOINTS + 1];
+
+static void start_report_transmit_i(usbep_t ep) {
+    if (usbGetTransmitStatusI(&USB_DRIVER, ep)) {
+        return;
+    }
+    const usb_report_t *report = usb_report_queue_next(report_queues[ep]);
+    if (report != NULL) {
+        usbStartTransmitI(&USB_DRIVER, ep, report->data, report->size);
+    }
+}
+
+/*
+ * IN notification callback of the HID endpoints, which sends the next queued
+ * report as soon as the host has collected the previous one.
+ */
+static void report_transmitted_cb(USBDriver *usbp, usbep_t ep) {
+    (void)usbp;
+    osalSysLockFromISR();
+    usb_report_queue_transmitted(report_queues[ep]);
+    start_report_transmit_i(ep);
+    osalSysUnlockFromISR();
+}
+
+/* Drops every queued report, including one whose transfer the bus reset or
+ * suspend has cut short, as its IN notification may never come. */
+static void clear_report_queues_i(void) {
+    for (usbep_t ep = 0; ep <= MAX_ENDPOINTS; ep++) {
+        if (report_queues[ep] != NULL) {
+            usb_report_queue_clear(report_queues[ep]);
+        }
+    }
+}
+
+static void init_report_endpoint_i(USBDriver *usbp, usbep_t ep, const USBEndpointConfig *config, usb_report_queue_t *queue) {
+    /* Anything still queued was meant for the previous configuration */
+    usb_report_queue_clear(queue);
+    report_queues[ep] = queue;
+    usbInitEndpointI(usbp, ep, config);
+}
+
 #ifndef KEYBOARD_SHARED_EP
 /* keyboard endpoint state structure */
 static USBInEndpointState kbd_ep_state;
+static usb_report_queue_t kbd_report_queue;
 /* keyboard endpoint initialization structure (IN) - see USBEndpointConfig comment at top of file */
 static const USBEndpointConfig kbd_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_transmitted_cb,  /* IN notification callback */
     NULL,                   /* OUT notification callback */
     KEYBOARD_EPSIZE,        /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -153,12 +197,13 @@ static const USBEndpointConfig kbd_ep_config = {
 #if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
 /* mouse endpoint state structure */
 static USBInEndpointState mouse_ep_state;
+static usb_report_queue_t mouse_report_queue;
 
 /* mouse endpoint initialization structure (IN) - see USBEndpointConfig comment at top of file */
 static const USBEndpointConfig mouse_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_transmitted_cb,  /* IN notification callback */
     NULL,                   /* OUT notification callback */
     MOUSE_EPSIZE,           /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -171,12 +216,13 @@ static const USBEndpointConfig mouse_ep_config = {
 #ifdef SHARED_EP_ENABLE
 /* shared endpoint state structure */
 static USBInEndpointState shared_ep_state;
+static usb_report_queue_t shared_report_queue;
 
 /* shared endpoint initialization structure (IN) - see USBEndpointConfig comment at top of file */
 static const USBEndpointConfig shared_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_transmitted_cb,  /* IN notification callback */
     NULL,                   /* OUT notification callback */
     SHARED_EPSIZE,          /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -189,12 +235,13 @@ static const USBEndpointConfig shared_ep_config = {
 #if defined(JOYSTICK_ENABLE) && !defined(JOYSTICK_SHARED_EP)
 /* joystick endpoint state structure */
 static USBInEndpointState joystick_ep_state;
+static usb_report_queue_t joystick_report_queue;
 
 /* joystick endpoint initialization structure (IN) - see USBEndpointConfig comment at top of file */
 static const USBEndpointConfig joystick_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_transmitted_cb,  /* IN notification callback */
     NULL,                   /* OUT notification callback */
     JOYSTICK_EPSIZE,        /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -207,12 +254,13 @@ static const USBEndpointConfig joystick_ep_config = {
 #if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
 /* digitizer endpoint state structure */
 static USBInEndpointState digitizer_ep_state;
+static usb_report_queue_t digitizer_report_queue;
 
 /* digitizer endpoint initialization structure (IN) - see USBEndpointConfig comment at top of file */
 static const USBEndpointConfig digitizer_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_transmitted_cb,  /* IN notification callback */
     NULL,                   /* OUT notification callback */
     DIGITIZER_EPSIZE,       /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -509,19 +557,19 @@ static void usb_event_cb(USBDriver *usbp, usbevent_t event) {
             osalSysLockFromISR();
             /* Enable the endpoints specified into the configuration. */
 #ifndef KEYBOARD_SHARED_EP
-            usbInitEndpointI(usbp, KEYBOARD_IN_EPNUM, &kbd_ep_config);
+            init_report_endpoint_i(usbp, KEYBOARD_IN_EPNUM, &kbd_ep_config, &kbd_report_queue);
 #endif
 #if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
-            usbInitEndpointI(usbp, MOUSE_IN_EPNUM, &mouse_ep_config);
+            init_report_endpoint_i(usbp, MOUSE_IN_EPNUM, &mouse_ep_config, &mouse_report_queue);
 #endif
 #ifdef SHARED_EP_ENABLE
-            usbInitEndpointI(usbp, SHARED_IN_EPNUM, &shared_ep_config);
+            init_report_endpoint_i(usbp, SHARED_IN_EPNUM, &shared_ep_config, &shared_report_queue);
 #endif
 #if defined(JOYSTICK_ENABLE) && !defined(JOYSTICK_SHARED_EP)
-            usbInitEndpointI(usbp, JOYSTICK_IN_EPNUM, &joystick_ep_config);
+            init_report_endpoint_i(usbp, JOYSTICK_IN_EPNUM, &joystick_ep_config, &joystick_report_queue);
 #endif
 #if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
-            usbInitEndpointI(usbp, DIGITIZER_IN_EPNUM, &digitizer_ep_config);
+            init_report_endpoint_i(usbp, DIGITIZER_IN_EPNUM, &digitizer_ep_config, &digitizer_report_queue);
 #endif
 #ifdef CONSOLE_ENABLE
             usbInitEndpointI(usbp, CONSOLE_IN_EPNUM, &console_ep_config);
@@ -550,6 +598,9 @@ static void usb_event_cb(USBDriver *usbp, usbevent_t event) {
             /* Falls into.*/
         case USB_EVENT_RESET:
             usb_event_queue_enqueue(event);
+            osalSysLockFromISR();
+            clear_report_queues_i();
+            osalSysUnlockFromISR();
             for (int i = 0; i < NUM_USB_DRIVERS; i++) {
                 chSysLockFromISR();
                 /* Disconnection event on suspend.*/
@@ -842,27 +893,47 @@ uint8_t keyboard_leds(void) {
     return keyboard_led_state;
 }
 
-void send_report(uint8_t endpoint, void *report, size_t size) {
+static void send_report_merge(uint8_t endpoint, void *report, size_t size, usb_report_merge_t merge) {
     osalSysLock();
     if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
         osalSysUnlock();
         return;
     }
 
-    if (usbGetTransmitStatusI(&USB_DRIVER, endpoint)) {
-        /* Need to either suspend, or loop and call unlock/lock during
-         * every iteration - otherwise the system will remain locked,
-         * no interrupts served, so USB not going through as well.
-         * Note: for suspend, need USB_USE_WAIT == TRUE in halconf.h */
-        if (osalThreadSuspendTimeoutS(&(&USB_DRIVER)->epc[endpoint]->in_state->thread, TIME_MS2I(10)) == MSG_TIMEOUT) {
+    usb_report_queue_t *queue = report_queues[endpoint];
+    if (queue == NULL || size > USB_REPORT_QUEUE_REPORT_SIZE) {
+        if (usbGetTransmitStatusI(&USB_DRIVER, endpoint)) {
+            /* Need to either suspend, or loop and call unlock/lock during
+             * every iteration - otherwise the system will remain locked,
+             * no interrupts served, so USB not going through as well.
+             * Note: for suspend, need USB_USE_WAIT == TRUE in halconf.h */
+            if (osalThreadSuspendTimeoutS(&(&USB_DRIVER)->epc[endpoint]->in_state->thread, TIME_MS2I(10)) == MSG_TIMEOUT) {
+                osalSysUnlock();
+                return;
+            }
+        }
+        usbStartTransmitI(&USB_DRIVER, endpoint, report, size);
+        osalSysUnlock();
+        return;
+    }
+
+    /* Only wait for the host when every slot of the queue is taken. A reset or
+     * suspend wakes the wait with MSG_RESET, and the report is dropped with
+     * the rest of the queue. */
+    while (!usb_report_queue_push(queue, report, size, merge)) {
+        if (osalThreadSuspendTimeoutS(&(&USB_DRIVER)->epc[endpoint]->in_state->thread, TIME_MS2I(10)) != MSG_OK) {
             osalSysUnlock();
             return;
         }
     }
-    usbStartTransmitI(&USB_DRIVER, endpoint, report, size);
+    start_report_transmit_i(endpoint);
     osalSysUnlock();
 }
 
+void send_report(uint8_t endpoint, void *report, size_t size) {
+    send_report_merge(endpoint, report, size, NULL);
+}
+
 /* prepare and start sending a report IN
  * not callable from ISR or locked state */
 void send_keyboard(report_keyboard_t *report) {
@@ -876,6 +947,18 @@ void send_keyboard(report_keyboard_t *report) {
     keyboard_report_sent = *report;
 }
 
+bool keyboard_report_ready(void) {
+#ifdef NKRO_ENABLE
+    uint8_t endpoint = keymap_config.nkro ? SHARED_IN_EPNUM : KEYBOARD_IN_EPNUM;
+#else
+    uint8_t endpoint = KEYBOARD_IN_EPNUM;
+#endif
+    osalSysLock();
+    bool ready = report_queues[endpoint] == NULL || !usb_report_queue_is_full(report_queues[endpoint]);
+    osalSysUnlock();
+    return ready;
+}
+
 void send_nkro(report_nkro_t *report) {
 #ifdef NKRO_ENABLE
     send_report(SHARED_IN_EPNUM, report, sizeof(report_nkro_t));
@@ -889,7 +972,8 @@ void send_nkro(report_nkro_t *report) {
 
 void send_mouse(report_mouse_t *report) {
 #ifdef MOUSE_ENABLE
-    send_report(MOUSE_IN_EPNUM, report, sizeof(report_mouse_t));
+    /* Movement reported while the host is busy is summed rather than queued */
+    send_report_merge(MOUSE_IN_EPNUM, report, sizeof(report_mouse_t), usb_report_merge_mouse);
     mouse_report_sent = *report;
 #endif
 }
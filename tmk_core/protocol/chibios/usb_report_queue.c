@@ -0,0 +1,94 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "usb_report_queue.h"
+#include "report.h"
+
+/* Movement limits declared by the mouse report descriptor */
+#ifdef MOUSE_EXTENDED_REPORT
+#    define MOUSE_XY_LIMIT 32767
+#else
+#    define MOUSE_XY_LIMIT 127
+#endif
+
+void usb_report_queue_clear(usb_report_queue_t *queue) {
+    queue->head      = 0;
+    queue->count     = 0;
+    queue->in_flight = false;
+}
+
+bool usb_report_queue_is_full(const usb_report_queue_t *queue) {
+    return queue->count == USB_REPORT_QUEUE_LENGTH;
+}
+
+bool usb_report_queue_push(usb_report_queue_t *queue, const void *report, uint8_t size, usb_report_merge_t merge) {
+    if (size > USB_REPORT_QUEUE_REPORT_SIZE) {
+        return false;
+    }
+
+    // The newest report can be merged into, unless the hardware is already sending it
+    if (merge != NULL && queue->count > (queue->in_flight ? 1 : 0)) {
+        usb_report_t *tail = &queue->reports[(queue->head + queue->count - 1) % USB_REPORT_QUEUE_LENGTH];
+        if (tail->merge == merge && tail->size == size && merge(tail->data, report, size)) {
+            return true;
+        }
+    }
+
+    if (queue->count == USB_REPORT_QUEUE_LENGTH) {
+        return false;
+    }
+
+    usb_report_t *entry = &queue->reports[(queue->head + queue->count) % USB_REPORT_QUEUE_LENGTH];
+    entry->merge        = merge;
+    entry->size         = size;
+    memcpy(entry->data, report, size);
+    queue->count++;
+    return true;
+}
+
+const usb_report_t *usb_report_queue_next(usb_report_queue_t *queue) {
+    if (queue->in_flight || queue->count == 0) {
+        return NULL;
+    }
+    queue->in_flight = true;
+    return &queue->reports[queue->head];
+}
+
+void usb_report_queue_transmitted(usb_report_queue_t *queue) {
+    // Transfers which did not come from the queue, such as idle reports, also end up here
+    if (!queue->in_flight) {
+        return;
+    }
+    queue->in_flight = false;
+    queue->head      = (queue->head + 1) % USB_REPORT_QUEUE_LENGTH;
+    queue->count--;
+}
+
+bool usb_report_merge_mouse(void *queued, const void *report, uint8_t size) {
+    report_mouse_t       *pending = (report_mouse_t *)queued;
+    const report_mouse_t *next    = (const report_mouse_t *)report;
+
+    // Button changes are transitions the host has to see, so they are never folded away
+    if (size != sizeof(report_mouse_t) || pending->buttons != next->buttons) {
+        return false;
+    }
+
+    int32_t x = (int32_t)pending->x + next->x;
+    int32_t y = (int32_t)pending->y + next->y;
+    int16_t v = (int16_t)pending->v + next->v;
+    int16_t h = (int16_t)pending->h + next->h;
+    if (x < -MOUSE_XY_LIMIT || x > MOUSE_XY_LIMIT || y < -MOUSE_XY_LIMIT || y > MOUSE_XY_LIMIT || v < -127 || v > 127 || h < -127 || h > 127) {
+        return false;
+    }
+
+    pending->x = x;
+    pending->y = y;
+    pending->v = v;
+    pending->h = h;
+#ifdef MOUSE_EXTENDED_REPORT
+    pending->boot_x = (x > 127) ? 127 : ((x < -127) ? -127 : x);
+    pending->boot_y = (y > 127) ? 127 : ((y < -127) ? -127 : y);
+#endif
+    return true;
+}
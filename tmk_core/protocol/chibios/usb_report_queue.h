@@ -0,0 +1,69 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Number of reports each HID IN endpoint can hold while the host has not yet
+ * collected the previous one. */
+#ifndef USB_REPORT_QUEUE_LENGTH
+#    define USB_REPORT_QUEUE_LENGTH 8
+#endif
+
+/* Largest report which can be queued; larger reports are sent unqueued. */
+#ifndef USB_REPORT_QUEUE_REPORT_SIZE
+#    define USB_REPORT_QUEUE_REPORT_SIZE 32
+#endif
+
+/**
+ * \brief Folds `report` into the pending report `queued`, which was pushed with the same merge function.
+ *
+ * \return true if the report was merged and no new entry is needed
+ */
+typedef bool (*usb_report_merge_t)(void *queued, const void *report, uint8_t size);
+
+typedef struct {
+    usb_report_merge_t merge;
+    uint8_t            size;
+    uint8_t            data[USB_REPORT_QUEUE_REPORT_SIZE];
+} usb_report_t;
+
+/* FIFO of reports for one IN endpoint. The head entry stays in place while
+ * the hardware is transmitting from it. None of these functions lock, so the
+ * caller must serialise them against the transfer complete interrupt. */
+typedef struct {
+    usb_report_t reports[USB_REPORT_QUEUE_LENGTH];
+    uint8_t      head;
+    uint8_t      count;
+    bool         in_flight;
+} usb_report_queue_t;
+
+void usb_report_queue_clear(usb_report_queue_t *queue);
+
+bool usb_report_queue_is_full(const usb_report_queue_t *queue);
+
+/**
+ * \brief Adds a report to the queue, or merges it into the newest pending report if `merge` allows it.
+ *
+ * \return false if the queue is full
+ */
+bool usb_report_queue_push(usb_report_queue_t *queue, const void *report, uint8_t size, usb_report_merge_t merge);
+
+/**
+ * \brief Marks the oldest report as being transmitted.
+ *
+ * \return the report to transmit, or NULL if a transfer is already in flight or the queue is empty
+ */
+const usb_report_t *usb_report_queue_next(usb_report_queue_t *queue);
+
+/**
+ * \brief Releases the report handed out by usb_report_queue_next(), once its transfer has completed.
+ */
+void usb_report_queue_transmitted(usb_report_queue_t *queue);
+
+/**
+ * \brief Merge function for report_mouse_t, summing the movement of reports with the same buttons held.
+ */
+bool usb_report_merge_mouse(void *queued, const void *report, uint8_t size);
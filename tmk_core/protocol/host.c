@@ -249,6 +249,22 @@ void host_programmable_button_send(uint32_t data) {
 
 __attribute__((weak)) void send_programmable_button(report_programmable_button_t *report) {}
 
+/* Whether a keyboard report sent now would go out without waiting for the host */
+bool host_keyboard_ready(void) {
+#ifdef BLUETOOTH_ENABLE
+    if (where_to_send() == OUTPUT_BLUETOOTH) {
+        return true;
+    }
+#endif
+
+    if (!driver) return false;
+    return keyboard_report_ready();
+}
+
+__attribute__((weak)) bool keyboard_report_ready(void) {
+    return true;
+}
+
 uint16_t host_last_system_usage(void) {
     return last_system_usage;
 }
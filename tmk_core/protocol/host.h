@@ -43,6 +43,7 @@ void    host_mouse_send(report_mouse_t *report);
 void    host_system_send(uint16_t usage);
 void    host_consumer_send(uint16_t usage);
 void    host_programmable_button_send(uint32_t data);
+bool    host_keyboard_ready(void);
 
 uint16_t host_last_system_usage(void);
 uint16_t host_last_consumer_usage(void);